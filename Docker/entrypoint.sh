@@ -15,4 +15,11 @@ export AWS_REGION="${AWS_REGION:-$REGION}"
 : "${REGION:?Set REGION}"
 : "${PUBLIC_IP:?Set PUBLIC_IP}"
 
-exec java -jar /gamelift/agent.jar -c "${COMPUTE_NAME}" -f "${FLEET_ID}" -loc "${LOCATION}" -r "${REGION}" -ip-address "${PUBLIC_IP}"
\ No newline at end of file
+# Without a local runtime-config.json the launcher reads the one set on the fleet
+RUNTIME_CONFIG_ARGS=()
+if [[ -f /gamelift/runtime-config.json ]]; then
+  RUNTIME_CONFIG_ARGS=(-rc /gamelift/runtime-config.json)
+fi
+
+exec /gamelift/odin-launcher -c "${COMPUTE_NAME}" -f "${FLEET_ID}" -loc "${LOCATION}" -r "${REGION}" -ip-address "${PUBLIC_IP}" \
+  -warm-pool-min "${WARM_POOL_MIN:-0}" -warm-pool-max "${WARM_POOL_MAX:-0}" -pin-cpus "${PIN_CPUS:-0}" "${RUNTIME_CONFIG_ARGS[@]}"
\ No newline at end of file
@@ -0,0 +1,171 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CpuPlacement.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <sched.h>
+
+using namespace OdinFleet::Launcher;
+
+namespace {
+std::string ReadLine(const std::string &path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+} // namespace
+
+CpuTopology CpuTopology::Detect() {
+    std::vector<int> allowedCpus;
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    if (sched_getaffinity(0, sizeof(affinity), &affinity) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &affinity)) {
+                allowedCpus.push_back(cpu);
+            }
+        }
+    }
+    const std::set<int> allowed(allowedCpus.begin(), allowedCpus.end());
+
+    std::map<int, int> cpuNodes;
+    for (int node : ParseCpuList(ReadLine("/sys/devices/system/node/online"))) {
+        for (int cpu : ParseCpuList(ReadLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"))) {
+            cpuNodes[cpu] = node;
+        }
+    }
+
+    CpuTopology topology;
+    std::set<int> placed;
+    for (int cpu : allowedCpus) {
+        if (placed.count(cpu) != 0) {
+            continue;
+        }
+        std::vector<int> core;
+        for (int sibling : ParseCpuList(ReadLine("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/thread_siblings_list"))) {
+            if (allowed.count(sibling) != 0 && placed.count(sibling) == 0) {
+                core.push_back(sibling);
+            }
+        }
+        if (std::find(core.begin(), core.end(), cpu) == core.end()) {
+            core = {cpu};
+        }
+        placed.insert(core.begin(), core.end());
+
+        const int nodeId = cpuNodes.count(cpu) != 0 ? cpuNodes[cpu] : 0;
+        auto node = std::find_if(topology.m_nodes.begin(), topology.m_nodes.end(), [nodeId](const Node &candidate) { return candidate.Id == nodeId; });
+        if (node == topology.m_nodes.end()) {
+            topology.m_nodes.push_back(Node{nodeId, {}});
+            node = topology.m_nodes.end() - 1;
+        }
+        node->Cores.push_back(core);
+    }
+    return topology;
+}
+
+Aws::GameLift::Outcome<std::vector<CpuAssignment>, std::string> CpuTopology::Assign(int processCount, int dedicatedCores) const {
+    if (dedicatedCores < 1) {
+        return std::string("Each process needs at least one dedicated core");
+    }
+
+    // Cores handed out so far per node; the rest of each node is shared.
+    std::vector<size_t> usedCores(m_nodes.size(), 0);
+    std::vector<size_t> processNodes;
+    for (int process = 0; process < processCount; process++) {
+        // The node with the most cores left, which spreads processes and memory traffic evenly.
+        size_t best = m_nodes.size();
+        for (size_t node = 0; node < m_nodes.size(); node++) {
+            const size_t remaining = m_nodes[node].Cores.size() - usedCores[node];
+            if (remaining > static_cast<size_t>(dedicatedCores) && (best == m_nodes.size() || remaining > m_nodes[best].Cores.size() - usedCores[best])) {
+                best = node;
+            }
+        }
+        if (best == m_nodes.size()) {
+            return "Pinning " + std::to_string(processCount) + " process(es) to " + std::to_string(dedicatedCores) +
+                   " dedicated core(s) each, plus a shared core per NUMA node, needs more than the " + std::to_string(GetCoreCount()) +
+                   " core(s) available";
+        }
+        processNodes.push_back(best);
+        usedCores[best] += dedicatedCores;
+    }
+
+    std::vector<size_t> nextCore(m_nodes.size(), 0);
+    std::vector<CpuAssignment> assignments;
+    for (size_t node : processNodes) {
+        CpuAssignment assignment;
+        assignment.NumaNode = m_nodes.size() > 1 ? m_nodes[node].Id : -1;
+        for (int core = 0; core < dedicatedCores; core++) {
+            const std::vector<int> &cpus = m_nodes[node].Cores[nextCore[node]++];
+            assignment.GameThreadCpus.insert(assignment.GameThreadCpus.end(), cpus.begin(), cpus.end());
+        }
+        assignment.ProcessCpus = assignment.GameThreadCpus;
+        for (size_t core = usedCores[node]; core < m_nodes[node].Cores.size(); core++) {
+            const std::vector<int> &cpus = m_nodes[node].Cores[core];
+            assignment.ProcessCpus.insert(assignment.ProcessCpus.end(), cpus.begin(), cpus.end());
+        }
+        std::sort(assignment.GameThreadCpus.begin(), assignment.GameThreadCpus.end());
+        std::sort(assignment.ProcessCpus.begin(), assignment.ProcessCpus.end());
+        assignments.push_back(assignment);
+    }
+    return assignments;
+}
+
+CpuAssignment CpuTopology::GetSharedAssignment(const std::vector<CpuAssignment> &assignments) {
+    std::set<int> shared;
+    for (const CpuAssignment &assignment : assignments) {
+        for (int cpu : assignment.ProcessCpus) {
+            if (std::find(assignment.GameThreadCpus.begin(), assignment.GameThreadCpus.end(), cpu) == assignment.GameThreadCpus.end()) {
+                shared.insert(cpu);
+            }
+        }
+    }
+    CpuAssignment assignment;
+    assignment.ProcessCpus.assign(shared.begin(), shared.end());
+    return assignment;
+}
+
+int CpuTopology::GetCoreCount() const {
+    int count = 0;
+    for (const Node &node : m_nodes) {
+        count += static_cast<int>(node.Cores.size());
+    }
+    return count;
+}
+
+std::string CpuTopology::FormatCpuList(const std::vector<int> &cpus) {
+    std::string cpuList;
+    for (size_t index = 0; index < cpus.size();) {
+        size_t end = index;
+        while (end + 1 < cpus.size() && cpus[end + 1] == cpus[end] + 1) {
+            end++;
+        }
+        cpuList += (cpuList.empty() ? "" : ",") + std::to_string(cpus[index]);
+        if (end > index) {
+            cpuList += "-" + std::to_string(cpus[end]);
+        }
+        index = end + 1;
+    }
+    return cpuList;
+}
+
+std::vector<int> CpuTopology::ParseCpuList(const std::string &cpuList) {
+    std::vector<int> cpus;
+    std::istringstream ranges(cpuList);
+    for (std::string range; std::getline(ranges, range, ',');) {
+        if (range.empty()) {
+            continue;
+        }
+        const size_t dash = range.find('-');
+        const int first = std::atoi(range.c_str());
+        const int last = dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+        for (int cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
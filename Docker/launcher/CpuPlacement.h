@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <aws/gamelift/common/Outcome.h>
+#include <string>
+#include <vector>
+
+namespace OdinFleet {
+namespace Launcher {
+
+// Where one server process runs. Empty CPU lists leave the process to the scheduler.
+struct CpuAssignment {
+    // The NUMA node the process allocates its memory on, -1 to leave it to the kernel.
+    int NumaNode = -1;
+    // Dedicated to the process's game thread; no other server process may run on them.
+    std::vector<int> GameThreadCpus;
+    // GameThreadCpus plus the node's shared CPUs, for the process's other threads.
+    std::vector<int> ProcessCpus;
+};
+
+/**
+ * The cores and NUMA nodes the launcher may place server processes on: the CPUs of its own affinity
+ * mask (the container's cpuset), grouped into physical cores by their SMT siblings and into nodes by
+ * /sys/devices/system/node. Without that information every CPU is a core of its own on node 0.
+ */
+class CpuTopology {
+public:
+    static CpuTopology Detect();
+
+    /**
+     * Spreads processCount processes over the nodes, each getting dedicatedCores whole cores for its
+     * game thread. The cores left on a node are shared by the other threads of that node's processes,
+     * so every node used keeps at least one.
+     * @return One assignment per process, or why the cores do not suffice.
+     */
+    Aws::GameLift::Outcome<std::vector<CpuAssignment>, std::string> Assign(int processCount, int dedicatedCores) const;
+
+    // The shared CPUs of every node in the assignments, for processes that have no slot yet.
+    static CpuAssignment GetSharedAssignment(const std::vector<CpuAssignment> &assignments);
+
+    int GetCoreCount() const;
+    int GetNodeCount() const { return static_cast<int>(m_nodes.size()); }
+
+    // Formats CPUs as a cpulist, e.g. "0-3,8".
+    static std::string FormatCpuList(const std::vector<int> &cpus);
+    static std::vector<int> ParseCpuList(const std::string &cpuList);
+
+private:
+    struct Node {
+        int Id = 0;
+        // Each core's CPUs, SMT siblings together.
+        std::vector<std::vector<int>> Cores;
+    };
+
+    std::vector<Node> m_nodes;
+};
+
+} // namespace Launcher
+} // namespace OdinFleet
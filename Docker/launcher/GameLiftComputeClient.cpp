@@ -0,0 +1,245 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameLiftComputeClient.h"
+#include <aws/gamelift/internal/security/AwsSigV4Utility.h>
+#include <asio.hpp>
+#include <asio/ssl.hpp>
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <ctime>
+#include <initializer_list>
+#include <map>
+#include <sstream>
+#include <utility>
+
+using namespace OdinFleet::Launcher;
+using Aws::GameLift::Outcome;
+using Aws::GameLift::Internal::AwsCredentials;
+
+constexpr std::chrono::seconds GameLiftComputeClient::REQUEST_TIMEOUT;
+
+namespace {
+constexpr const char *CONTENT_TYPE = "application/x-amz-json-1.1";
+constexpr const char *TARGET_PREFIX = "GameLift.";
+
+std::string ToJsonObject(std::initializer_list<std::pair<const char *, std::string>> members) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    for (const auto &member : members) {
+        writer.Key(member.first);
+        writer.String(member.second.c_str(), static_cast<rapidjson::SizeType>(member.second.size()));
+    }
+    writer.EndObject();
+    return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+// Splits a raw HTTP/1.1 response into its status code and body, undoing chunked transfer encoding.
+Outcome<std::pair<int, std::string>, std::string> ParseHttpResponse(const std::string &response) {
+    const size_t headerEnd = response.find("\r\n\r\n");
+    if (response.compare(0, 5, "HTTP/") != 0 || headerEnd == std::string::npos) {
+        return std::string("Malformed HTTP response");
+    }
+    const size_t statusStart = response.find(' ');
+    const int statusCode = std::atoi(response.c_str() + statusStart + 1);
+
+    std::string headers = response.substr(0, headerEnd);
+    std::transform(headers.begin(), headers.end(), headers.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    std::string body = response.substr(headerEnd + 4);
+    if (headers.find("transfer-encoding: chunked") == std::string::npos) {
+        return std::make_pair(statusCode, std::move(body));
+    }
+
+    std::string decoded;
+    size_t position = 0;
+    while (position < body.size()) {
+        const size_t lineEnd = body.find("\r\n", position);
+        if (lineEnd == std::string::npos) {
+            return std::string("Truncated chunked HTTP response");
+        }
+        const size_t chunkSize = std::strtoul(body.c_str() + position, nullptr, 16);
+        if (chunkSize == 0) {
+            break;
+        }
+        decoded.append(body, lineEnd + 2, chunkSize);
+        position = lineEnd + 2 + chunkSize + 2;
+    }
+    return std::make_pair(statusCode, std::move(decoded));
+}
+
+// Sends one request over a fresh TLS connection and reads the response until the server closes it.
+Outcome<std::pair<int, std::string>, std::string> SendHttpsRequest(const std::string &host, const std::string &request, std::chrono::seconds timeout) {
+    asio::io_context ioContext;
+    asio::ssl::context tlsContext(asio::ssl::context::tls_client);
+    tlsContext.set_default_verify_paths();
+    tlsContext.set_verify_mode(asio::ssl::verify_peer);
+
+    asio::ssl::stream<asio::ip::tcp::socket> stream(ioContext, tlsContext);
+    SSL_set_tlsext_host_name(stream.native_handle(), host.c_str());
+    stream.set_verify_callback(asio::ssl::host_name_verification(host));
+
+    asio::ip::tcp::resolver resolver(ioContext);
+    asio::streambuf responseBuffer;
+    std::error_code failure;
+    bool completed = false;
+
+    resolver.async_resolve(host, "443", [&](const std::error_code &error, const asio::ip::tcp::resolver::results_type &endpoints) {
+        if (error) {
+            failure = error;
+            return;
+        }
+        asio::async_connect(stream.lowest_layer(), endpoints, [&](const std::error_code &error, const asio::ip::tcp::endpoint &) {
+            if (error) {
+                failure = error;
+                return;
+            }
+            stream.async_handshake(asio::ssl::stream_base::client, [&](const std::error_code &error) {
+                if (error) {
+                    failure = error;
+                    return;
+                }
+                asio::async_write(stream, asio::buffer(request), [&](const std::error_code &error, size_t) {
+                    if (error) {
+                        failure = error;
+                        return;
+                    }
+                    asio::async_read(stream, responseBuffer, [&](const std::error_code &error, size_t) {
+                        // Servers commonly close without a TLS close_notify once the response is complete.
+                        if (error && error != asio::error::eof && error != asio::ssl::error::stream_truncated) {
+                            failure = error;
+                            return;
+                        }
+                        completed = true;
+                    });
+                });
+            });
+        });
+    });
+
+    ioContext.run_for(timeout);
+    if (failure) {
+        return "Request to " + host + " failed: " + failure.message();
+    }
+    if (!completed) {
+        return "Request to " + host + " timed out";
+    }
+    return ParseHttpResponse(std::string(asio::buffers_begin(responseBuffer.data()), asio::buffers_end(responseBuffer.data())));
+}
+} // namespace
+
+GameLiftComputeClient::GameLiftComputeClient(const std::string &region, const AwsCredentials &credentials)
+    : m_region(region), m_host("gamelift." + region + ".amazonaws.com"), m_credentials(credentials) {}
+
+Outcome<AwsCredentials, std::string> GameLiftComputeClient::CredentialsFromEnvironment() {
+    const char *accessKey = std::getenv("AWS_ACCESS_KEY_ID");
+    const char *secretKey = std::getenv("AWS_SECRET_ACCESS_KEY");
+    const char *sessionToken = std::getenv("AWS_SESSION_TOKEN");
+    if (accessKey == nullptr || secretKey == nullptr || accessKey[0] == '\0' || secretKey[0] == '\0') {
+        return std::string("AWS_ACCESS_KEY_ID and AWS_SECRET_ACCESS_KEY are required");
+    }
+    return AwsCredentials(accessKey, secretKey, sessionToken == nullptr ? "" : sessionToken);
+}
+
+Outcome<RegisteredCompute, std::string> GameLiftComputeClient::RegisterCompute(const std::string &fleetId, const std::string &computeName,
+                                                                               const std::string &location, const std::string &ipAddress) {
+    rapidjson::Document document;
+    Outcome<std::nullptr_t, std::string> outcome = Call(
+        "RegisterCompute", ToJsonObject({{"FleetId", fleetId}, {"ComputeName", computeName}, {"Location", location}, {"IpAddress", ipAddress}}), document);
+    if (!outcome.IsSuccess()) {
+        return outcome.GetError();
+    }
+    if (!document.HasMember("Compute") || !document["Compute"].IsObject()) {
+        return std::string("RegisterCompute returned no compute");
+    }
+    const rapidjson::Value &compute = document["Compute"];
+    if (!compute.HasMember("GameLiftServiceSdkEndpoint") || !compute["GameLiftServiceSdkEndpoint"].IsString()) {
+        return std::string("RegisterCompute returned no GameLiftServiceSdkEndpoint");
+    }
+
+    RegisteredCompute registeredCompute;
+    registeredCompute.ComputeName = computeName;
+    registeredCompute.GameLiftServiceSdkEndpoint = compute["GameLiftServiceSdkEndpoint"].GetString();
+    return registeredCompute;
+}
+
+Outcome<ComputeAuthToken, std::string> GameLiftComputeClient::GetComputeAuthToken(const std::string &fleetId, const std::string &computeName) {
+    rapidjson::Document document;
+    Outcome<std::nullptr_t, std::string> outcome = Call("GetComputeAuthToken", ToJsonObject({{"FleetId", fleetId}, {"ComputeName", computeName}}), document);
+    if (!outcome.IsSuccess()) {
+        return outcome.GetError();
+    }
+    if (!document.HasMember("AuthToken") || !document["AuthToken"].IsString() ||
+        !document.HasMember("ExpirationTimestamp") || !document["ExpirationTimestamp"].IsNumber()) {
+        return std::string("GetComputeAuthToken returned no token");
+    }
+
+    ComputeAuthToken token;
+    token.AuthToken = document["AuthToken"].GetString();
+    token.Expiration = std::chrono::system_clock::from_time_t(static_cast<std::time_t>(document["ExpirationTimestamp"].GetDouble()));
+    return token;
+}
+
+Outcome<RuntimeConfiguration, std::string> GameLiftComputeClient::DescribeRuntimeConfiguration(const std::string &fleetId) {
+    rapidjson::Document document;
+    Outcome<std::nullptr_t, std::string> outcome = Call("DescribeRuntimeConfiguration", ToJsonObject({{"FleetId", fleetId}}), document);
+    if (!outcome.IsSuccess()) {
+        return outcome.GetError();
+    }
+    if (!document.HasMember("RuntimeConfiguration") || !document["RuntimeConfiguration"].IsObject()) {
+        return std::string("DescribeRuntimeConfiguration returned no runtime configuration");
+    }
+    return RuntimeConfiguration::FromJsonValue(document["RuntimeConfiguration"]);
+}
+
+Outcome<std::nullptr_t, std::string> GameLiftComputeClient::DeregisterCompute(const std::string &fleetId, const std::string &computeName) {
+    rapidjson::Document document;
+    return Call("DeregisterCompute", ToJsonObject({{"FleetId", fleetId}, {"ComputeName", computeName}}), document);
+}
+
+Outcome<std::nullptr_t, std::string> GameLiftComputeClient::Call(const std::string &operation, const std::string &payload, rapidjson::Document &response) {
+    const std::string target = TARGET_PREFIX + operation;
+    std::map<std::string, std::string> headers;
+    headers["host"] = m_host;
+    headers["content-type"] = CONTENT_TYPE;
+    headers["x-amz-target"] = target;
+
+    std::time_t requestTime = std::time(nullptr);
+    std::tm utcTime = {};
+    gmtime_r(&requestTime, &utcTime);
+    Aws::GameLift::Internal::SigV4Parameters sigV4Parameters(m_region, m_credentials, std::map<std::string, std::string>(), utcTime);
+    Outcome<std::map<std::string, std::string>, std::string> sigV4HeadersOutcome =
+        Aws::GameLift::Internal::AwsSigV4Utility::GenerateSigV4Headers(sigV4Parameters, "POST", "/", headers, payload);
+    if (!sigV4HeadersOutcome.IsSuccess()) {
+        return "Failed to sign " + operation + ": " + sigV4HeadersOutcome.GetError();
+    }
+
+    std::ostringstream request;
+    request << "POST / HTTP/1.1\r\n"
+            << "Host: " << m_host << "\r\n"
+            << "Content-Type: " << CONTENT_TYPE << "\r\n"
+            << "X-Amz-Target: " << target << "\r\n";
+    for (const auto &header : sigV4HeadersOutcome.GetResult()) {
+        request << header.first << ": " << header.second << "\r\n";
+    }
+    request << "Content-Length: " << payload.size() << "\r\n"
+            << "Connection: close\r\n\r\n"
+            << payload;
+
+    Outcome<std::pair<int, std::string>, std::string> responseOutcome = SendHttpsRequest(m_host, request.str(), REQUEST_TIMEOUT);
+    if (!responseOutcome.IsSuccess()) {
+        return operation + ": " + responseOutcome.GetError();
+    }
+    const std::pair<int, std::string> &httpResponse = responseOutcome.GetResult();
+    if (httpResponse.first < 200 || httpResponse.first >= 300) {
+        return operation + " failed with HTTP " + std::to_string(httpResponse.first) + ": " + httpResponse.second;
+    }
+    response.Parse(httpResponse.second.c_str());
+    if (response.HasParseError() || !response.IsObject()) {
+        return operation + " returned malformed JSON";
+    }
+    return nullptr;
+}
@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <aws/gamelift/common/Outcome.h>
+#include <aws/gamelift/internal/security/AwsCredentials.h>
+#include "RuntimeConfiguration.h"
+#include <rapidjson/document.h>
+#include <chrono>
+#include <string>
+
+namespace OdinFleet {
+namespace Launcher {
+
+struct RegisteredCompute {
+    std::string ComputeName;
+    // What server processes connect their SDK to, GAMELIFT_SDK_WEBSOCKET_URL.
+    std::string GameLiftServiceSdkEndpoint;
+};
+
+struct ComputeAuthToken {
+    std::string AuthToken;
+    std::chrono::system_clock::time_point Expiration;
+};
+
+/**
+ * The few Amazon GameLift Servers control plane calls an Anywhere compute needs, as JSON over HTTPS signed
+ * with SigV4. Calls block for at most REQUEST_TIMEOUT and are made from one thread.
+ */
+class GameLiftComputeClient {
+public:
+    static constexpr std::chrono::seconds REQUEST_TIMEOUT = std::chrono::seconds(30);
+
+    GameLiftComputeClient(const std::string &region, const Aws::GameLift::Internal::AwsCredentials &credentials);
+
+    /**
+     * Reads AWS_ACCESS_KEY_ID, AWS_SECRET_ACCESS_KEY and AWS_SESSION_TOKEN.
+     */
+    static Aws::GameLift::Outcome<Aws::GameLift::Internal::AwsCredentials, std::string> CredentialsFromEnvironment();
+
+    Aws::GameLift::Outcome<RegisteredCompute, std::string> RegisterCompute(const std::string &fleetId, const std::string &computeName,
+                                                                           const std::string &location, const std::string &ipAddress);
+
+    Aws::GameLift::Outcome<ComputeAuthToken, std::string> GetComputeAuthToken(const std::string &fleetId, const std::string &computeName);
+
+    Aws::GameLift::Outcome<RuntimeConfiguration, std::string> DescribeRuntimeConfiguration(const std::string &fleetId);
+
+    Aws::GameLift::Outcome<std::nullptr_t, std::string> DeregisterCompute(const std::string &fleetId, const std::string &computeName);
+
+private:
+    // POSTs the payload as GameLift.<operation> and parses the JSON body of a 2xx response into response.
+    Aws::GameLift::Outcome<std::nullptr_t, std::string> Call(const std::string &operation, const std::string &payload, rapidjson::Document &response);
+
+    std::string m_region;
+    std::string m_host;
+    Aws::GameLift::Internal::AwsCredentials m_credentials;
+};
+
+} // namespace Launcher
+} // namespace OdinFleet
@@ -0,0 +1,498 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProcessSupervisor.h"
+#include <aws/gamelift/internal/util/GuidGenerator.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char **environ;
+
+using namespace OdinFleet::Launcher;
+
+constexpr std::chrono::seconds ProcessSupervisor::MIN_HEALTHY_RUNTIME;
+constexpr std::chrono::seconds ProcessSupervisor::MAX_RESTART_DELAY;
+constexpr std::chrono::seconds ProcessSupervisor::ACTIVATION_WINDOW;
+constexpr std::chrono::seconds ProcessSupervisor::ENVIRONMENT_RETRY_DELAY;
+constexpr int ProcessSupervisor::WARM_POOL_FD;
+constexpr std::chrono::minutes ProcessSupervisor::ARRIVAL_RATE_WINDOW;
+
+namespace {
+constexpr const char *ENV_VAR_WEBSOCKET_URL = "GAMELIFT_SDK_WEBSOCKET_URL";
+constexpr const char *ENV_VAR_AUTH_TOKEN = "GAMELIFT_SDK_AUTH_TOKEN";
+constexpr const char *ENV_VAR_PROCESS_ID = "GAMELIFT_SDK_PROCESS_ID";
+constexpr const char *ENV_VAR_HOST_ID = "GAMELIFT_SDK_HOST_ID";
+constexpr const char *ENV_VAR_FLEET_ID = "GAMELIFT_SDK_FLEET_ID";
+
+// Weight of the latest warmup in the moving average.
+constexpr double WARMUP_SMOOTHING = 0.3;
+
+bool IsOverridden(const char *entry) {
+    for (const char *name : {ENV_VAR_WEBSOCKET_URL, ENV_VAR_AUTH_TOKEN, ENV_VAR_PROCESS_ID, ENV_VAR_HOST_ID, ENV_VAR_FLEET_ID,
+                             ProcessSupervisor::ENV_VAR_WARM_POOL_FD, ProcessSupervisor::ENV_VAR_GAME_THREAD_CPUS}) {
+        const size_t length = std::strlen(name);
+        if (std::strncmp(entry, name, length) == 0 && entry[length] == '=') {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::chrono::seconds GetRestartDelay(int failedLaunches) {
+    return std::min<std::chrono::seconds>(ProcessSupervisor::MAX_RESTART_DELAY, std::chrono::seconds(1LL << std::min(failedLaunches - 1, 6)));
+}
+
+// The variables a slot's process starts with, or is sent when promoted from the warm pool.
+std::vector<std::string> GetSlotVariables(const ServerProcessEnvironment &environment, const std::string &processId, const CpuAssignment &cpus) {
+    std::vector<std::string> variables{
+        std::string(ENV_VAR_WEBSOCKET_URL) + "=" + environment.WebSocketUrl,
+        std::string(ENV_VAR_AUTH_TOKEN) + "=" + environment.AuthToken,
+        std::string(ENV_VAR_PROCESS_ID) + "=" + processId,
+        std::string(ENV_VAR_HOST_ID) + "=" + environment.HostId,
+        std::string(ENV_VAR_FLEET_ID) + "=" + environment.FleetId,
+    };
+    if (!cpus.GameThreadCpus.empty()) {
+        variables.push_back(std::string(ProcessSupervisor::ENV_VAR_GAME_THREAD_CPUS) + "=" + CpuTopology::FormatCpuList(cpus.GameThreadCpus));
+    }
+    return variables;
+}
+
+// Moves every thread of a running process group onto the assignment's CPUs, and the memory it allocated
+// so far onto the assignment's NUMA node. New allocations follow the threads to that node.
+void PlaceProcessGroup(pid_t processGroup, const CpuAssignment &cpus) {
+    if (cpus.ProcessCpus.empty()) {
+        return;
+    }
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    for (int cpu : cpus.ProcessCpus) {
+        CPU_SET(cpu, &affinity);
+    }
+    const unsigned long allNodes = ~0UL;
+    const unsigned long nodeMask = cpus.NumaNode >= 0 ? 1UL << cpus.NumaNode : 0;
+
+    DIR *processes = opendir("/proc");
+    if (processes == nullptr) {
+        return;
+    }
+    while (const dirent *process = readdir(processes)) {
+        const pid_t pid = static_cast<pid_t>(std::atoi(process->d_name));
+        if (pid <= 0 || getpgid(pid) != processGroup) {
+            continue;
+        }
+        const std::string tasksPath = "/proc/" + std::to_string(pid) + "/task";
+        if (DIR *tasks = opendir(tasksPath.c_str())) {
+            while (const dirent *task = readdir(tasks)) {
+                const pid_t tid = static_cast<pid_t>(std::atoi(task->d_name));
+                if (tid > 0) {
+                    sched_setaffinity(tid, sizeof(affinity), &affinity);
+                }
+            }
+            closedir(tasks);
+        }
+        if (nodeMask != 0) {
+            syscall(SYS_migrate_pages, pid, sizeof(nodeMask) * 8, &allNodes, &nodeMask);
+        }
+    }
+    closedir(processes);
+}
+} // namespace
+
+ProcessSupervisor::ProcessSupervisor(const RuntimeConfiguration &configuration, int warmPoolMin, int warmPoolMax,
+                                     std::vector<CpuAssignment> cpuAssignments)
+    : m_configuration(configuration), m_warmPoolMin(std::max(warmPoolMin, 0)), m_warmPoolMax(std::max(warmPoolMax, m_warmPoolMin)),
+      m_warmPoolTarget(m_warmPoolMin), m_warmCpus(CpuTopology::GetSharedAssignment(cpuAssignments)) {
+    for (const ServerProcessConfiguration &serverProcess : m_configuration.ServerProcesses) {
+        for (int execution = 0; execution < serverProcess.ConcurrentExecutions; execution++) {
+            ProcessSlot slot;
+            slot.Configuration = &serverProcess;
+            if (m_slots.size() < cpuAssignments.size()) {
+                slot.Cpus = cpuAssignments[m_slots.size()];
+            }
+            m_slots.push_back(slot);
+        }
+    }
+}
+
+ProcessSupervisor::~ProcessSupervisor() {
+    for (const WarmProcess &warmProcess : m_warmProcesses) {
+        close(warmProcess.ControlFd);
+    }
+}
+
+int ProcessSupervisor::Poll(const EnvironmentProvider &environmentProvider) {
+    Reap();
+    ReadWarmNotifications();
+
+    const auto now = std::chrono::steady_clock::now();
+    int activating = 0;
+    for (const ProcessSlot &slot : m_slots) {
+        if (slot.Pid != 0 && now - slot.LaunchTime < ACTIVATION_WINDOW) {
+            activating++;
+        }
+    }
+
+    int filled = 0;
+    Aws::GameLift::Outcome<ServerProcessEnvironment, std::string> environmentOutcome;
+    bool environmentRequested = false;
+    for (ProcessSlot &slot : m_slots) {
+        if (slot.Pid != 0 || now < slot.NextLaunchTime) {
+            continue;
+        }
+        if (activating >= m_configuration.MaxConcurrentGameSessionActivations || now < m_nextEnvironmentAttempt) {
+            break;
+        }
+        if (!environmentRequested) {
+            environmentOutcome = environmentProvider();
+            environmentRequested = true;
+            if (!environmentOutcome.IsSuccess()) {
+                spdlog::error("Cannot launch server processes: {}", environmentOutcome.GetError());
+                m_nextEnvironmentAttempt = now + ENVIRONMENT_RETRY_DELAY;
+                break;
+            }
+        }
+        // A slot that ran before is free because its session ended, which is what the warm pool is sized by.
+        const bool bRefill = slot.LaunchTime != std::chrono::steady_clock::time_point();
+        if (Promote(slot, environmentOutcome.GetResult()) || Launch(slot, environmentOutcome.GetResult())) {
+            activating++;
+            filled++;
+            if (bRefill) {
+                m_arrivals.push_back(now);
+            }
+        }
+    }
+
+    UpdateWarmPoolTarget(now);
+    RefillWarmPool(now);
+    return filled;
+}
+
+bool ProcessSupervisor::Launch(ProcessSlot &slot, const ServerProcessEnvironment &environment) {
+    const std::string processId = Aws::GameLift::Internal::GuidGenerator::GenerateGuid();
+    const auto now = std::chrono::steady_clock::now();
+    const pid_t pid = Spawn(*slot.Configuration, GetSlotVariables(environment, processId, slot.Cpus), -1, slot.Cpus);
+    if (pid < 0) {
+        slot.NextLaunchTime = now + std::chrono::seconds(1);
+        return false;
+    }
+
+    slot.Pid = pid;
+    slot.ProcessId = processId;
+    slot.LaunchTime = now;
+    if (slot.Cpus.ProcessCpus.empty()) {
+        spdlog::info("Launched {} as pid {} with process ID {}", slot.Configuration->LaunchPath, pid, processId);
+    } else {
+        spdlog::info("Launched {} as pid {} with process ID {} on CPUs {}, game thread on {}", slot.Configuration->LaunchPath, pid, processId,
+                     CpuTopology::FormatCpuList(slot.Cpus.ProcessCpus), CpuTopology::FormatCpuList(slot.Cpus.GameThreadCpus));
+    }
+    return true;
+}
+
+bool ProcessSupervisor::Promote(ProcessSlot &slot, const ServerProcessEnvironment &environment) {
+    // Prefer a process that is already warm; one still booting reads the variables once it is.
+    auto candidate = m_warmProcesses.end();
+    for (auto warmProcess = m_warmProcesses.begin(); warmProcess != m_warmProcesses.end(); ++warmProcess) {
+        if (warmProcess->Configuration == slot.Configuration &&
+            (candidate == m_warmProcesses.end() || (warmProcess->Warm && !candidate->Warm) ||
+             (warmProcess->Warm == candidate->Warm && warmProcess->LaunchTime < candidate->LaunchTime))) {
+            candidate = warmProcess;
+        }
+    }
+    if (candidate == m_warmProcesses.end()) {
+        return false;
+    }
+
+    const WarmProcess warmProcess = *candidate;
+    m_warmProcesses.erase(candidate);
+
+    const std::string processId = Aws::GameLift::Internal::GuidGenerator::GenerateGuid();
+    std::string message;
+    for (const std::string &variable : GetSlotVariables(environment, processId, slot.Cpus)) {
+        message += variable + "\n";
+    }
+    message += "\n";
+    const ssize_t sent = send(warmProcess.ControlFd, message.data(), message.size(), MSG_NOSIGNAL);
+    close(warmProcess.ControlFd);
+    if (sent != static_cast<ssize_t>(message.size())) {
+        // Reaped as an unknown process once it is gone.
+        spdlog::warn("Cannot promote warm process {}: {}", warmProcess.Pid, sent < 0 ? std::strerror(errno) : "short write");
+        kill(-warmProcess.Pid, SIGKILL);
+        return false;
+    }
+
+    // Warm processes ran on the shared CPUs; from now on the process runs where the slot's did.
+    PlaceProcessGroup(warmProcess.Pid, slot.Cpus);
+
+    slot.Pid = warmProcess.Pid;
+    slot.ProcessId = processId;
+    slot.LaunchTime = std::chrono::steady_clock::now();
+    if (slot.Cpus.ProcessCpus.empty()) {
+        spdlog::info("Promoted {} process pid {} with process ID {}", warmProcess.Warm ? "warm" : "booting", warmProcess.Pid, processId);
+    } else {
+        spdlog::info("Promoted {} process pid {} with process ID {} onto CPUs {}, game thread on {}", warmProcess.Warm ? "warm" : "booting",
+                     warmProcess.Pid, processId, CpuTopology::FormatCpuList(slot.Cpus.ProcessCpus), CpuTopology::FormatCpuList(slot.Cpus.GameThreadCpus));
+    }
+    return true;
+}
+
+void ProcessSupervisor::LaunchWarmProcess(const ServerProcessConfiguration &configuration) {
+    int controlFds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, controlFds) != 0) {
+        spdlog::error("Cannot create the control socket of a warm process: {}", std::strerror(errno));
+        return;
+    }
+    fcntl(controlFds[0], F_SETFL, fcntl(controlFds[0], F_GETFL) | O_NONBLOCK);
+
+    const pid_t pid = Spawn(configuration, {std::string(ENV_VAR_WARM_POOL_FD) + "=" + std::to_string(WARM_POOL_FD)}, controlFds[1], m_warmCpus);
+    close(controlFds[1]);
+    if (pid < 0) {
+        close(controlFds[0]);
+        return;
+    }
+
+    WarmProcess warmProcess;
+    warmProcess.Configuration = &configuration;
+    warmProcess.Pid = pid;
+    warmProcess.ControlFd = controlFds[0];
+    warmProcess.LaunchTime = std::chrono::steady_clock::now();
+    m_warmProcesses.push_back(warmProcess);
+    spdlog::info("Launched {} as warm pid {}", configuration.LaunchPath, pid);
+}
+
+pid_t ProcessSupervisor::Spawn(const ServerProcessConfiguration &configuration, std::vector<std::string> variables, int inheritedFd,
+                               const CpuAssignment &cpus) {
+    // Prepare everything before fork; the child only calls async-signal-safe functions.
+    std::vector<std::string> arguments{configuration.LaunchPath};
+    std::istringstream parameters(configuration.Parameters);
+    for (std::string parameter; parameters >> parameter;) {
+        arguments.push_back(parameter);
+    }
+
+    std::vector<char *> argv;
+    for (std::string &argument : arguments) {
+        argv.push_back(&argument[0]);
+    }
+    argv.push_back(nullptr);
+    std::vector<char *> envp;
+    for (char **entry = environ; *entry != nullptr; entry++) {
+        if (!IsOverridden(*entry)) {
+            envp.push_back(*entry);
+        }
+    }
+    for (std::string &variable : variables) {
+        envp.push_back(&variable[0]);
+    }
+    envp.push_back(nullptr);
+
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    for (int cpu : cpus.ProcessCpus) {
+        CPU_SET(cpu, &affinity);
+    }
+    // Preferred rather than bound, so a full node spills over instead of failing allocations.
+    const unsigned long nodeMask = cpus.NumaNode >= 0 ? 1UL << cpus.NumaNode : 0;
+
+    const pid_t pid = fork();
+    if (pid < 0) {
+        spdlog::error("Failed to fork for {}: {}", configuration.LaunchPath, std::strerror(errno));
+        return -1;
+    }
+    if (pid == 0) {
+        setpgid(0, 0);
+        // Both are inherited across exec, by the launch script and the server it starts.
+        if (!cpus.ProcessCpus.empty()) {
+            sched_setaffinity(0, sizeof(affinity), &affinity);
+        }
+        if (nodeMask != 0) {
+            syscall(SYS_set_mempolicy, MPOL_PREFERRED, &nodeMask, sizeof(nodeMask) * 8);
+        }
+        if (inheritedFd == WARM_POOL_FD) {
+            fcntl(WARM_POOL_FD, F_SETFD, 0);
+        } else if (inheritedFd >= 0) {
+            // dup2 clears close-on-exec on the copy.
+            dup2(inheritedFd, WARM_POOL_FD);
+        }
+        execve(argv[0], argv.data(), envp.data());
+        _exit(127);
+    }
+    // Also set from the parent, so the group exists before anything signals it.
+    setpgid(pid, pid);
+    return pid;
+}
+
+void ProcessSupervisor::ReadWarmNotifications() {
+    const auto now = std::chrono::steady_clock::now();
+    for (WarmProcess &warmProcess : m_warmProcesses) {
+        if (warmProcess.Warm) {
+            continue;
+        }
+        char buffer[64];
+        const ssize_t received = recv(warmProcess.ControlFd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (received <= 0 || std::string(buffer, received).find(WARM_MESSAGE) == std::string::npos) {
+            continue;
+        }
+
+        warmProcess.Warm = true;
+        m_failedWarmLaunches = 0;
+        const double warmupSeconds = std::chrono::duration<double>(now - warmProcess.LaunchTime).count();
+        m_warmupSeconds = m_warmupSeconds == 0.0 ? warmupSeconds : m_warmupSeconds + WARMUP_SMOOTHING * (warmupSeconds - m_warmupSeconds);
+        spdlog::info("Warm process pid {} is ready for promotion after {:.1f}s", warmProcess.Pid, warmupSeconds);
+    }
+}
+
+void ProcessSupervisor::UpdateWarmPoolTarget(std::chrono::steady_clock::time_point now) {
+    while (!m_arrivals.empty() && now - m_arrivals.front() > ARRIVAL_RATE_WINDOW) {
+        m_arrivals.pop_front();
+    }
+    if (m_warmPoolMax == 0) {
+        return;
+    }
+
+    // Little's law: sessions arriving while a replacement warms up need a warm process each. Until a warm
+    // process has reported, the warmup time is unknown, so keep one to measure it.
+    const double arrivalsPerSecond = m_arrivals.size() / std::chrono::duration<double>(ARRIVAL_RATE_WINDOW).count();
+    const int target = m_warmupSeconds == 0.0
+                           ? std::max(m_warmPoolMin, 1)
+                           : std::min(m_warmPoolMax, std::max(m_warmPoolMin, static_cast<int>(std::ceil(arrivalsPerSecond * m_warmupSeconds))));
+    if (target != m_warmPoolTarget) {
+        spdlog::info("Warm pool target {} -> {} ({:.2f} sessions/min, {:.1f}s warmup)", m_warmPoolTarget, target, arrivalsPerSecond * 60.0,
+                     m_warmupSeconds);
+        m_warmPoolTarget = target;
+    }
+}
+
+void ProcessSupervisor::RefillWarmPool(std::chrono::steady_clock::time_point now) {
+    if (m_shuttingDown) {
+        return;
+    }
+
+    for (const ServerProcessConfiguration &configuration : m_configuration.ServerProcesses) {
+        int count = static_cast<int>(std::count_if(m_warmProcesses.begin(), m_warmProcesses.end(),
+                                                   [&configuration](const WarmProcess &warmProcess) { return warmProcess.Configuration == &configuration; }));
+        while (count < m_warmPoolTarget && now >= m_nextWarmLaunchTime) {
+            LaunchWarmProcess(configuration);
+            count++;
+        }
+
+        // Shrink by the youngest, which have the least warmup to lose.
+        while (count > m_warmPoolTarget) {
+            auto youngest = m_warmProcesses.end();
+            for (auto warmProcess = m_warmProcesses.begin(); warmProcess != m_warmProcesses.end(); ++warmProcess) {
+                if (warmProcess->Configuration == &configuration && (youngest == m_warmProcesses.end() || warmProcess->LaunchTime > youngest->LaunchTime)) {
+                    youngest = warmProcess;
+                }
+            }
+            spdlog::info("Stopping warm pid {}, the warm pool shrank", youngest->Pid);
+            kill(-youngest->Pid, SIGTERM);
+            close(youngest->ControlFd);
+            m_warmProcesses.erase(youngest);
+            count--;
+        }
+    }
+}
+
+void ProcessSupervisor::Reap() {
+    // As PID 1 of the container the launcher also inherits orphans; reaping them here keeps them from lingering as zombies.
+    int status = 0;
+    pid_t pid;
+    while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+        const auto now = std::chrono::steady_clock::now();
+        auto warmProcess = std::find_if(m_warmProcesses.begin(), m_warmProcesses.end(), [pid](const WarmProcess &candidate) { return candidate.Pid == pid; });
+        if (warmProcess != m_warmProcesses.end()) {
+            if (m_shuttingDown) {
+                spdlog::info("Warm pid {} exited", pid);
+            } else if (!warmProcess->Warm) {
+                m_failedWarmLaunches++;
+                m_nextWarmLaunchTime = now + GetRestartDelay(m_failedWarmLaunches);
+                spdlog::warn("Warm pid {} exited before it was warm, {} time(s) in a row", pid, m_failedWarmLaunches);
+            } else {
+                spdlog::warn("Warm pid {} exited while waiting for promotion", pid);
+            }
+            close(warmProcess->ControlFd);
+            m_warmProcesses.erase(warmProcess);
+            continue;
+        }
+
+        auto slot = std::find_if(m_slots.begin(), m_slots.end(), [pid](const ProcessSlot &candidate) { return candidate.Pid == pid; });
+        if (slot == m_slots.end()) {
+            continue;
+        }
+
+        const auto runtime = now - slot->LaunchTime;
+        if (WIFSIGNALED(status)) {
+            spdlog::warn("Server process {} (pid {}) was killed by signal {}", slot->ProcessId, pid, WTERMSIG(status));
+        } else {
+            spdlog::info("Server process {} (pid {}) exited with code {}", slot->ProcessId, pid, WEXITSTATUS(status));
+        }
+
+        // Ending a game session may end its process, so only exits right after launch are treated as failures.
+        if (m_shuttingDown) {
+            slot->NextLaunchTime = std::chrono::steady_clock::time_point::max();
+        } else if (runtime < MIN_HEALTHY_RUNTIME) {
+            slot->FailedLaunches++;
+            const std::chrono::seconds delay = GetRestartDelay(slot->FailedLaunches);
+            spdlog::warn("{} failed to start {} time(s) in a row, relaunching in {}s", slot->Configuration->LaunchPath, slot->FailedLaunches,
+                         delay.count());
+            slot->NextLaunchTime = now + delay;
+        } else {
+            slot->FailedLaunches = 0;
+            slot->NextLaunchTime = now;
+        }
+        slot->Pid = 0;
+    }
+}
+
+void ProcessSupervisor::Shutdown(std::chrono::seconds timeout) {
+    m_shuttingDown = true;
+    for (const ProcessSlot &slot : m_slots) {
+        if (slot.Pid != 0) {
+            kill(-slot.Pid, SIGTERM);
+        }
+    }
+    for (const WarmProcess &warmProcess : m_warmProcesses) {
+        kill(-warmProcess.Pid, SIGTERM);
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while ((GetRunningCount() > 0 || !m_warmProcesses.empty()) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        Reap();
+    }
+
+    for (ProcessSlot &slot : m_slots) {
+        if (slot.Pid != 0) {
+            spdlog::warn("Server process {} (pid {}) did not exit in {}s, killing it", slot.ProcessId, slot.Pid, timeout.count());
+            kill(-slot.Pid, SIGKILL);
+            waitpid(slot.Pid, nullptr, 0);
+            slot.Pid = 0;
+        }
+    }
+    for (const WarmProcess &warmProcess : m_warmProcesses) {
+        kill(-warmProcess.Pid, SIGKILL);
+        waitpid(warmProcess.Pid, nullptr, 0);
+        close(warmProcess.ControlFd);
+    }
+    m_warmProcesses.clear();
+}
+
+int ProcessSupervisor::GetRunningCount() const {
+    return static_cast<int>(std::count_if(m_slots.begin(), m_slots.end(), [](const ProcessSlot &slot) { return slot.Pid != 0; }));
+}
+
+int ProcessSupervisor::GetWarmCount() const {
+    return static_cast<int>(std::count_if(m_warmProcesses.begin(), m_warmProcesses.end(), [](const WarmProcess &warmProcess) { return warmProcess.Warm; }));
+}
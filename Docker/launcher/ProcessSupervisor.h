@@ -0,0 +1,152 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CpuPlacement.h"
+#include "RuntimeConfiguration.h"
+#include <aws/gamelift/common/Outcome.h>
+#include <sys/types.h>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OdinFleet {
+namespace Launcher {
+
+// The GAMELIFT_SDK_* values a server process needs to connect its SDK, see GameLiftServerState::ENV_VAR_*.
+struct ServerProcessEnvironment {
+    std::string WebSocketUrl;
+    std::string AuthToken;
+    std::string HostId;
+    std::string FleetId;
+};
+
+/**
+ * Keeps ConcurrentExecutions copies of every configured server process running. Each copy is launched
+ * in a process group of its own, so the launch script and the server it starts are signalled together,
+ * and gets a fresh process ID on every launch. Not thread safe; drive it from one loop.
+ *
+ * With a warm pool, extra copies are started ahead of time without GAMELIFT_SDK_* variables. They boot
+ * and prewarm, report WARM_MESSAGE on the socket passed as WARM_POOL_FD, then wait. When a copy exits,
+ * a warm one takes its place by receiving its GAMELIFT_SDK_* variables on that socket as KEY=VALUE lines
+ * ending with an empty line, and connects to Amazon GameLift Servers right away. See
+ * AOdinFleetGameMode::WaitForPromotion for the server side.
+ *
+ * With CPU assignments, every slot's processes are restricted to the slot's ProcessCpus and prefer its
+ * NUMA node for memory, and are told their GameThreadCpus through ENV_VAR_GAME_THREAD_CPUS. Warm
+ * processes run on the shared CPUs until promoted. Promotion moves them onto the slot's CPUs and NUMA
+ * node, and they then pin their game thread like the rest.
+ */
+class ProcessSupervisor {
+public:
+    using EnvironmentProvider = std::function<Aws::GameLift::Outcome<ServerProcessEnvironment, std::string>()>;
+
+    // A process that exits sooner than this after its launch failed to start; its restarts back off.
+    static constexpr std::chrono::seconds MIN_HEALTHY_RUNTIME = std::chrono::seconds(10);
+    static constexpr std::chrono::seconds MAX_RESTART_DELAY = std::chrono::seconds(60);
+    // How long a launched process counts against MaxConcurrentGameSessionActivations.
+    static constexpr std::chrono::seconds ACTIVATION_WINDOW = std::chrono::seconds(30);
+    static constexpr std::chrono::seconds ENVIRONMENT_RETRY_DELAY = std::chrono::seconds(5);
+
+    // Warm processes find their end of the control socket at this descriptor, named by ENV_VAR_WARM_POOL_FD.
+    static constexpr int WARM_POOL_FD = 3;
+    static constexpr const char *ENV_VAR_WARM_POOL_FD = "ODIN_WARM_POOL_FD";
+    static constexpr const char *WARM_MESSAGE = "WARM";
+    // Session arrivals are averaged over this window to size the warm pool.
+    static constexpr std::chrono::minutes ARRIVAL_RATE_WINDOW = std::chrono::minutes(10);
+    // The cpulist a server process pins its game thread to, see AOdinFleetGameMode::PinGameThread.
+    static constexpr const char *ENV_VAR_GAME_THREAD_CPUS = "ODIN_GAME_THREAD_CPUS";
+
+    /**
+     * @param warmPoolMin Warm processes kept per server process configuration at any arrival rate. 0 with
+     * warmPoolMax 0 disables the warm pool.
+     * @param warmPoolMax Upper bound of the adaptive warm pool per server process configuration.
+     * @param cpuAssignments One per concurrent execution, in runtime configuration order, or empty to
+     * leave placement to the scheduler.
+     */
+    ProcessSupervisor(const RuntimeConfiguration &configuration, int warmPoolMin, int warmPoolMax, std::vector<CpuAssignment> cpuAssignments);
+
+    // Slots point into the owned configuration.
+    ProcessSupervisor(const ProcessSupervisor &) = delete;
+    ProcessSupervisor &operator=(const ProcessSupervisor &) = delete;
+
+    ~ProcessSupervisor();
+
+    /**
+     * Reaps exited processes, hands free slots to warm processes or launches replacements that are due,
+     * and tops up the warm pool. The environment is only requested when a slot is about to be filled.
+     * @return The number of slots filled.
+     */
+    int Poll(const EnvironmentProvider &environmentProvider);
+
+    /**
+     * Sends SIGTERM to every process group, waits up to timeout for them to exit, then sends SIGKILL.
+     */
+    void Shutdown(std::chrono::seconds timeout);
+
+    int GetRunningCount() const;
+
+    int GetWarmCount() const;
+
+    // The number of warm processes currently kept per server process configuration.
+    int GetWarmPoolTarget() const { return m_warmPoolTarget; }
+
+private:
+    struct ProcessSlot {
+        const ServerProcessConfiguration *Configuration = nullptr;
+        pid_t Pid = 0;
+        std::string ProcessId;
+        std::chrono::steady_clock::time_point LaunchTime;
+        std::chrono::steady_clock::time_point NextLaunchTime;
+        int FailedLaunches = 0;
+        CpuAssignment Cpus;
+    };
+
+    struct WarmProcess {
+        const ServerProcessConfiguration *Configuration = nullptr;
+        pid_t Pid = 0;
+        // The launcher's end of the control socket.
+        int ControlFd = -1;
+        std::chrono::steady_clock::time_point LaunchTime;
+        bool Warm = false;
+    };
+
+    void Reap();
+    bool Launch(ProcessSlot &slot, const ServerProcessEnvironment &environment);
+    // Hands the slot to a warm process of the same configuration, if there is one.
+    bool Promote(ProcessSlot &slot, const ServerProcessEnvironment &environment);
+    void LaunchWarmProcess(const ServerProcessConfiguration &configuration);
+
+    /**
+     * Forks and execs the configuration in a new process group, placed on the assignment's CPUs and
+     * NUMA node. inheritedFd, if not -1, becomes WARM_POOL_FD.
+     */
+    pid_t Spawn(const ServerProcessConfiguration &configuration, std::vector<std::string> variables, int inheritedFd, const CpuAssignment &cpus);
+
+    void ReadWarmNotifications();
+    void UpdateWarmPoolTarget(std::chrono::steady_clock::time_point now);
+    void RefillWarmPool(std::chrono::steady_clock::time_point now);
+
+    RuntimeConfiguration m_configuration;
+    std::vector<ProcessSlot> m_slots;
+    std::chrono::steady_clock::time_point m_nextEnvironmentAttempt;
+    bool m_shuttingDown = false;
+
+    std::vector<WarmProcess> m_warmProcesses;
+    int m_warmPoolMin;
+    int m_warmPoolMax;
+    int m_warmPoolTarget;
+    // When slots were handed to warm processes or relaunched, within ARRIVAL_RATE_WINDOW.
+    std::deque<std::chrono::steady_clock::time_point> m_arrivals;
+    // Moving average of the time from launch to WARM_MESSAGE, 0 until one was measured.
+    double m_warmupSeconds = 0.0;
+    int m_failedWarmLaunches = 0;
+    std::chrono::steady_clock::time_point m_nextWarmLaunchTime;
+    // Where warm processes run until a slot is theirs.
+    CpuAssignment m_warmCpus;
+};
+
+} // namespace Launcher
+} // namespace OdinFleet
@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RuntimeConfiguration.h"
+#include <fstream>
+#include <sstream>
+
+using namespace OdinFleet::Launcher;
+
+Aws::GameLift::Outcome<RuntimeConfiguration, std::string> RuntimeConfiguration::FromJson(const std::string &json) {
+    rapidjson::Document document;
+    document.Parse(json.c_str());
+    if (document.HasParseError() || !document.IsObject()) {
+        return std::string("Runtime configuration is not a JSON object");
+    }
+    return FromJsonValue(document);
+}
+
+Aws::GameLift::Outcome<RuntimeConfiguration, std::string> RuntimeConfiguration::FromJsonValue(const rapidjson::Value &value) {
+    RuntimeConfiguration configuration;
+    if (!value.HasMember("ServerProcesses") || !value["ServerProcesses"].IsArray()) {
+        return std::string("ServerProcesses is required");
+    }
+    for (const rapidjson::Value &serverProcess : value["ServerProcesses"].GetArray()) {
+        if (!serverProcess.IsObject() || !serverProcess.HasMember("LaunchPath") || !serverProcess["LaunchPath"].IsString()) {
+            return std::string("Every server process needs a LaunchPath");
+        }
+        ServerProcessConfiguration processConfiguration;
+        processConfiguration.LaunchPath = serverProcess["LaunchPath"].GetString();
+        if (serverProcess.HasMember("Parameters") && serverProcess["Parameters"].IsString()) {
+            processConfiguration.Parameters = serverProcess["Parameters"].GetString();
+        }
+        if (serverProcess.HasMember("ConcurrentExecutions") && serverProcess["ConcurrentExecutions"].IsInt()) {
+            processConfiguration.ConcurrentExecutions = serverProcess["ConcurrentExecutions"].GetInt();
+        }
+        if (processConfiguration.ConcurrentExecutions < 1) {
+            return std::string("ConcurrentExecutions must be at least 1 for ") + processConfiguration.LaunchPath;
+        }
+        configuration.ServerProcesses.push_back(processConfiguration);
+    }
+    if (configuration.ServerProcesses.empty()) {
+        return std::string("ServerProcesses is empty");
+    }
+
+    if (value.HasMember("MaxConcurrentGameSessionActivations") && value["MaxConcurrentGameSessionActivations"].IsInt()) {
+        configuration.MaxConcurrentGameSessionActivations = value["MaxConcurrentGameSessionActivations"].GetInt();
+    }
+    if (value.HasMember("GameSessionActivationTimeoutSeconds") && value["GameSessionActivationTimeoutSeconds"].IsInt()) {
+        configuration.GameSessionActivationTimeoutSeconds = value["GameSessionActivationTimeoutSeconds"].GetInt();
+    }
+    if (configuration.MaxConcurrentGameSessionActivations < 1) {
+        return std::string("MaxConcurrentGameSessionActivations must be at least 1");
+    }
+    return configuration;
+}
+
+Aws::GameLift::Outcome<RuntimeConfiguration, std::string> RuntimeConfiguration::Load(const std::string &pathOrJson) {
+    if (pathOrJson.find('{') != std::string::npos) {
+        return FromJson(pathOrJson);
+    }
+
+    std::ifstream file(pathOrJson);
+    if (!file) {
+        return std::string("Cannot read runtime configuration ") + pathOrJson;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return FromJson(contents.str());
+}
+
+int RuntimeConfiguration::GetTotalConcurrentExecutions() const {
+    int total = 0;
+    for (const ServerProcessConfiguration &serverProcess : ServerProcesses) {
+        total += serverProcess.ConcurrentExecutions;
+    }
+    return total;
+}
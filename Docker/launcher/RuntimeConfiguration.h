@@ -0,0 +1,46 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <aws/gamelift/common/Outcome.h>
+#include <rapidjson/document.h>
+#include <string>
+#include <vector>
+
+namespace OdinFleet {
+namespace Launcher {
+
+struct ServerProcessConfiguration {
+    std::string LaunchPath;
+    std::string Parameters;
+    int ConcurrentExecutions = 1;
+};
+
+/**
+ * The fleet's runtime configuration, in the shape of the Amazon GameLift Servers RuntimeConfiguration
+ * object: https://docs.aws.amazon.com/gameliftservers/latest/apireference/API_RuntimeConfiguration.html
+ */
+struct RuntimeConfiguration {
+    std::vector<ServerProcessConfiguration> ServerProcesses;
+    int MaxConcurrentGameSessionActivations = 2147483647;
+    int GameSessionActivationTimeoutSeconds = 300;
+
+    /**
+     * Parses a RuntimeConfiguration JSON object.
+     * @return The configuration, or a description of what is wrong with it.
+     */
+    static Aws::GameLift::Outcome<RuntimeConfiguration, std::string> FromJson(const std::string &json);
+
+    static Aws::GameLift::Outcome<RuntimeConfiguration, std::string> FromJsonValue(const rapidjson::Value &value);
+
+    /**
+     * Reads the configuration from a file, or parses it directly if the argument is inline JSON, as the
+     * agent's -runtime-configuration option accepts.
+     */
+    static Aws::GameLift::Outcome<RuntimeConfiguration, std::string> Load(const std::string &pathOrJson);
+
+    int GetTotalConcurrentExecutions() const;
+};
+
+} // namespace Launcher
+} // namespace OdinFleet
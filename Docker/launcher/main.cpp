@@ -0,0 +1,205 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// Native replacement for the Amazon GameLift Servers agent on OdinFleet's Anywhere computes. It accepts
+// the agent's command line, registers the compute, then keeps the runtime configuration's server
+// processes running until the container is stopped.
+
+#include "CpuPlacement.h"
+#include "GameLiftComputeClient.h"
+#include "ProcessSupervisor.h"
+#include "RuntimeConfiguration.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+
+using namespace OdinFleet::Launcher;
+
+namespace {
+constexpr std::chrono::milliseconds POLL_INTERVAL = std::chrono::milliseconds(250);
+constexpr std::chrono::seconds METRICS_INTERVAL = std::chrono::seconds(60);
+// Tokens are refreshed this long before they expire, so a process never starts with one about to lapse.
+constexpr std::chrono::minutes AUTH_TOKEN_REFRESH_MARGIN = std::chrono::minutes(5);
+// How long server processes get to end their game sessions once the container is stopped.
+constexpr std::chrono::seconds SHUTDOWN_TIMEOUT = std::chrono::seconds(30);
+
+volatile std::sig_atomic_t g_stopRequested = 0;
+
+void OnStopSignal(int) { g_stopRequested = 1; }
+
+struct LauncherOptions {
+    std::string ComputeName;
+    std::string FleetId;
+    std::string Location;
+    std::string Region;
+    std::string IpAddress;
+    std::string RuntimeConfiguration;
+    int WarmPoolMin = 0;
+    int WarmPoolMax = 0;
+    // Cores dedicated to each server process's game thread, 0 to leave placement to the scheduler.
+    int PinCpus = 0;
+};
+
+bool ParseOptions(int argc, char **argv, LauncherOptions &options) {
+    for (int index = 1; index + 1 < argc; index += 2) {
+        const std::string name = argv[index];
+        const std::string value = argv[index + 1];
+        if (name == "-c" || name == "-compute-name") {
+            options.ComputeName = value;
+        } else if (name == "-f" || name == "-fleet-id") {
+            options.FleetId = value;
+        } else if (name == "-loc" || name == "-location") {
+            options.Location = value;
+        } else if (name == "-r" || name == "-region") {
+            options.Region = value;
+        } else if (name == "-ip-address") {
+            options.IpAddress = value;
+        } else if (name == "-rc" || name == "-runtime-configuration") {
+            options.RuntimeConfiguration = value;
+        } else if (name == "-warm-pool-min") {
+            options.WarmPoolMin = std::atoi(value.c_str());
+        } else if (name == "-warm-pool-max") {
+            options.WarmPoolMax = std::atoi(value.c_str());
+        } else if (name == "-pin-cpus") {
+            options.PinCpus = std::atoi(value.c_str());
+        } else {
+            spdlog::error("Unknown option {}", name);
+            return false;
+        }
+    }
+    if ((argc - 1) % 2 != 0) {
+        spdlog::error("Option {} has no value", argv[argc - 1]);
+        return false;
+    }
+    return !options.ComputeName.empty() && !options.FleetId.empty() && !options.Location.empty() && !options.Region.empty() &&
+           !options.IpAddress.empty();
+}
+
+// Reads a "Vm*:" line of /proc/self/status, in kB.
+long ReadMemoryStatusKb(const char *field) {
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line);) {
+        if (line.compare(0, std::strlen(field), field) == 0) {
+            return std::strtol(line.c_str() + std::strlen(field), nullptr, 10);
+        }
+    }
+    return -1;
+}
+
+long ElapsedMilliseconds(std::chrono::steady_clock::time_point since) {
+    return static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - since).count());
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    // The launcher is the container's entry point, so its start is the container's start for the metrics below.
+    const auto startTime = std::chrono::steady_clock::now();
+
+    LauncherOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        spdlog::error("Usage: {} -c <compute-name> -f <fleet-id> -loc <location> -r <region> -ip-address <ip> [-rc <file or json>] "
+                      "[-warm-pool-min <n>] [-warm-pool-max <n>] [-pin-cpus <cores per process>]", argv[0]);
+        return 2;
+    }
+
+    struct sigaction stopAction = {};
+    stopAction.sa_handler = OnStopSignal;
+    sigaction(SIGTERM, &stopAction, nullptr);
+    sigaction(SIGINT, &stopAction, nullptr);
+
+    auto credentialsOutcome = GameLiftComputeClient::CredentialsFromEnvironment();
+    if (!credentialsOutcome.IsSuccess()) {
+        spdlog::error("{}", credentialsOutcome.GetError());
+        return 1;
+    }
+    GameLiftComputeClient client(options.Region, credentialsOutcome.GetResult());
+
+    auto registerOutcome = client.RegisterCompute(options.FleetId, options.ComputeName, options.Location, options.IpAddress);
+    if (!registerOutcome.IsSuccess()) {
+        spdlog::error("{}", registerOutcome.GetError());
+        return 1;
+    }
+    const RegisteredCompute compute = registerOutcome.GetResult();
+    spdlog::info("[metrics] compute {} registered {} ms after start", compute.ComputeName, ElapsedMilliseconds(startTime));
+
+    auto configurationOutcome = options.RuntimeConfiguration.empty() ? client.DescribeRuntimeConfiguration(options.FleetId)
+                                                                     : RuntimeConfiguration::Load(options.RuntimeConfiguration);
+    int exitCode = 0;
+    if (!configurationOutcome.IsSuccess()) {
+        spdlog::error("{}", configurationOutcome.GetError());
+        exitCode = 1;
+        g_stopRequested = 1;
+    }
+
+    ComputeAuthToken authToken;
+    ProcessSupervisor::EnvironmentProvider environmentProvider = [&]() -> Aws::GameLift::Outcome<ServerProcessEnvironment, std::string> {
+        if (std::chrono::system_clock::now() + AUTH_TOKEN_REFRESH_MARGIN >= authToken.Expiration) {
+            auto tokenOutcome = client.GetComputeAuthToken(options.FleetId, compute.ComputeName);
+            if (!tokenOutcome.IsSuccess()) {
+                return tokenOutcome.GetError();
+            }
+            authToken = tokenOutcome.GetResult();
+        }
+        ServerProcessEnvironment environment;
+        environment.WebSocketUrl = compute.GameLiftServiceSdkEndpoint;
+        environment.AuthToken = authToken.AuthToken;
+        environment.HostId = compute.ComputeName;
+        environment.FleetId = options.FleetId;
+        return environment;
+    };
+
+    std::vector<CpuAssignment> cpuAssignments;
+    if (configurationOutcome.IsSuccess() && options.PinCpus > 0) {
+        const CpuTopology topology = CpuTopology::Detect();
+        auto assignOutcome = topology.Assign(configurationOutcome.GetResult().GetTotalConcurrentExecutions(), options.PinCpus);
+        if (assignOutcome.IsSuccess()) {
+            cpuAssignments = assignOutcome.GetResult();
+            spdlog::info("Pinning server processes on {} core(s) in {} NUMA node(s)", topology.GetCoreCount(), topology.GetNodeCount());
+            for (size_t slot = 0; slot < cpuAssignments.size(); slot++) {
+                spdlog::info("[metrics] process slot {}: game thread CPUs {}, process CPUs {}, NUMA node {}", slot,
+                             CpuTopology::FormatCpuList(cpuAssignments[slot].GameThreadCpus), CpuTopology::FormatCpuList(cpuAssignments[slot].ProcessCpus),
+                             cpuAssignments[slot].NumaNode);
+            }
+        } else {
+            spdlog::error("{}; server processes run unpinned", assignOutcome.GetError());
+        }
+    }
+
+    if (configurationOutcome.IsSuccess()) {
+        ProcessSupervisor supervisor(configurationOutcome.GetResult(), options.WarmPoolMin, options.WarmPoolMax, cpuAssignments);
+        spdlog::info("Supervising {} server process(es) with a warm pool of {} to {}", configurationOutcome.GetResult().GetTotalConcurrentExecutions(),
+                     options.WarmPoolMin, std::max(options.WarmPoolMin, options.WarmPoolMax));
+
+        bool launchedAny = false;
+        auto lastMetricsTime = std::chrono::steady_clock::now();
+        while (!g_stopRequested) {
+            if (supervisor.Poll(environmentProvider) > 0 && !launchedAny) {
+                launchedAny = true;
+                spdlog::info("[metrics] first server process launched {} ms after start, launcher RSS {} kB", ElapsedMilliseconds(startTime),
+                             ReadMemoryStatusKb("VmRSS:"));
+            }
+            if (std::chrono::steady_clock::now() - lastMetricsTime >= METRICS_INTERVAL) {
+                lastMetricsTime = std::chrono::steady_clock::now();
+                spdlog::info("[metrics] launcher RSS {} kB, peak {} kB, {} server process(es) running, {} of {} warm", ReadMemoryStatusKb("VmRSS:"),
+                             ReadMemoryStatusKb("VmHWM:"), supervisor.GetRunningCount(), supervisor.GetWarmCount(), supervisor.GetWarmPoolTarget());
+            }
+            std::this_thread::sleep_for(POLL_INTERVAL);
+        }
+
+        spdlog::info("Stopping {} server process(es)", supervisor.GetRunningCount());
+        supervisor.Shutdown(SHUTDOWN_TIMEOUT);
+    }
+
+    auto deregisterOutcome = client.DeregisterCompute(options.FleetId, compute.ComputeName);
+    if (!deregisterOutcome.IsSuccess()) {
+        spdlog::error("{}", deregisterOutcome.GetError());
+        return 1;
+    }
+    spdlog::info("Compute {} deregistered", compute.ComputeName);
+    return exitCode;
+}
@@ -4,10 +4,51 @@
 #include "GLBSServiceConnector.h"
 
 #include "GameLiftExeptions.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
+// The "GameLiftBackend" trace channel: backend requests and the parsing of their responses, to
+// record next to the GameLift channel of the server SDK, e.g. -trace=default,counters,gameliftbackend.
+UE_TRACE_CHANNEL(GameLiftBackendChannel);
+#define GLBS_TRACE_CPU_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, GameLiftBackendChannel)
+
+TRACE_DECLARE_INT_COUNTER(GameLiftBackendRequestsInFlight, TEXT("GameLiftBackend/RequestsInFlight"));
+TRACE_DECLARE_FLOAT_COUNTER(GameLiftBackendRequestMs, TEXT("GameLiftBackend/RequestMs"));
+
+namespace
+{
+	void ProcessTracedRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request)
+	{
+		TRACE_COUNTER_INCREMENT(GameLiftBackendRequestsInFlight);
+		Request->ProcessRequest();
+	}
+
+	// Called first thing in every completion handler.
+	void TraceRequestComplete(const FHttpRequestPtr& Request)
+	{
+		TRACE_COUNTER_DECREMENT(GameLiftBackendRequestsInFlight);
+		if (Request.IsValid())
+		{
+			TRACE_COUNTER_SET(GameLiftBackendRequestMs, Request->GetElapsedTime() * 1000.0f);
+		}
+	}
+
+	// The backend's clock when it answered, from the Date header, so load reports it stamped are aged
+	// against the same clock. Zero ticks if the header is missing.
+	FDateTime GetResponseTime(const FHttpResponsePtr& Response)
+	{
+		FDateTime ResponseTime(0);
+		if (Response.IsValid())
+		{
+			FDateTime::ParseHttpDate(Response->GetHeader(TEXT("Date")), ResponseTime);
+		}
+		return ResponseTime;
+	}
+}
 
 void UGLBSServiceConnector::GetSessions(FSearchComplete OnReady)
 {	
+	GLBS_TRACE_CPU_SCOPE("GLBS::GetSessions");
 	TFunction<void(const FJsonObject& Result, const FString& Error)> Done;
 	FHttpModule& Module= FHttpModule::Get();
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Module.CreateRequest();
@@ -16,8 +57,10 @@ void UGLBSServiceConnector::GetSessions(FSearchComplete OnReady)
 	Request->SetVerb("GET");
 	Request->SetHeader("Content-Type", "application/json");
 
-	Request->OnProcessRequestComplete().BindLambda([OnReady](FHttpRequestPtr, FHttpResponsePtr Response,bool bOK)
+	Request->OnProcessRequestComplete().BindLambda([OnReady](FHttpRequestPtr CompletedRequest, FHttpResponsePtr Response,bool bOK)
 	{
+		TraceRequestComplete(CompletedRequest);
+		GLBS_TRACE_CPU_SCOPE("GLBS::GetSessions::Parse");
 		const FString ResponseString = Response->GetContentAsString();
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseString);
 		TSharedPtr<FJsonObject> Json;
@@ -34,11 +77,13 @@ void UGLBSServiceConnector::GetSessions(FSearchComplete OnReady)
 			TArray<FGameSessionData> GameSessionsStruct;
 			FGameSessionData data;
 			TArray<TSharedPtr<FJsonValue>> GameSessionsJson = Json->GetArrayField(FString(TEXT("GameSessions")));
+			const FDateTime ResponseTime = GetResponseTime(Response);
 			for (TSharedPtr<FJsonValue> GameSession : GameSessionsJson)
 			{
-				data = CreateGameSessionFromJson(GameSession);
+				data = CreateGameSessionFromJson(GameSession, ResponseTime);
 				GameSessionsStruct.Add(data);
-			}			
+			}
+			SortSessionsByLoad(GameSessionsStruct);
 			OnReady.Execute(GameSessionsStruct,false,EGameLiftExceptionsBP::None);
 			return;
 		}
@@ -49,11 +94,12 @@ void UGLBSServiceConnector::GetSessions(FSearchComplete OnReady)
 
 	});
 
-	Request->ProcessRequest();
+	ProcessTracedRequest(Request);
 }
 
 void UGLBSServiceConnector::CreateGameSession(FSingleGameSessionResult OnCreated,FString CreatorId,FString GameSessionName)
 {
+	GLBS_TRACE_CPU_SCOPE("GLBS::CreateGameSession");
 	TFunction<void(const FJsonObject& Result, const FString& Error)> Done;
 	FHttpModule& Module= FHttpModule::Get();
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Module.CreateRequest();
@@ -75,8 +121,10 @@ void UGLBSServiceConnector::CreateGameSession(FSingleGameSessionResult OnCreated
 
 	Request->SetContentAsString(RequestBody);
 	
-	Request->OnProcessRequestComplete().BindLambda([OnCreated](FHttpRequestPtr, FHttpResponsePtr Response,bool bOK)
+	Request->OnProcessRequestComplete().BindLambda([OnCreated](FHttpRequestPtr CompletedRequest, FHttpResponsePtr Response,bool bOK)
 	{
+		TraceRequestComplete(CompletedRequest);
+		GLBS_TRACE_CPU_SCOPE("GLBS::CreateGameSession::Parse");
 		const FString ResponseString = Response->GetContentAsString();
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseString);
 		TSharedPtr<FJsonObject> Json;
@@ -97,18 +145,19 @@ void UGLBSServiceConnector::CreateGameSession(FSingleGameSessionResult OnCreated
 		{
 			FGameSessionData data;
 			TSharedPtr<FJsonValue> GameSessionsJson = Json->GetField(FString(TEXT("GameSession")),EJson::Object);
-			data = CreateGameSessionFromJson(GameSessionsJson);
+			data = CreateGameSessionFromJson(GameSessionsJson, GetResponseTime(Response));
 			OnCreated.Execute(data,false,EGameLiftExceptionsBP::None);
 			return;
 		}
 		FGameSessionData data;
 		OnCreated.Execute(data,false,EGameLiftExceptionsBP::None);
 	});
-	Request->ProcessRequest();
+	ProcessTracedRequest(Request);
 }
 
 void UGLBSServiceConnector::CloseGameSession(FSingleGameSessionResult OnClosed,FString GameSessionId)
 {
+	GLBS_TRACE_CPU_SCOPE("GLBS::CloseGameSession");
 	TFunction<void(const FJsonObject& Result, const FString& Error)> Done;
 	FHttpModule& Module= FHttpModule::Get();
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Module.CreateRequest();
@@ -129,8 +178,10 @@ void UGLBSServiceConnector::CloseGameSession(FSingleGameSessionResult OnClosed,F
 
 	Request->SetContentAsString(RequestBody);
 	
-	Request->OnProcessRequestComplete().BindLambda([OnClosed](FHttpRequestPtr, FHttpResponsePtr Response,bool bOK)
+	Request->OnProcessRequestComplete().BindLambda([OnClosed](FHttpRequestPtr CompletedRequest, FHttpResponsePtr Response,bool bOK)
 	{
+		TraceRequestComplete(CompletedRequest);
+		GLBS_TRACE_CPU_SCOPE("GLBS::CloseGameSession::Parse");
 		const FString ResponseString = Response->GetContentAsString();
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseString);
 		TSharedPtr<FJsonObject> Json;
@@ -147,7 +198,7 @@ void UGLBSServiceConnector::CloseGameSession(FSingleGameSessionResult OnClosed,F
 			if (GameSession->HasField(FString(TEXT("GameSession"))))
 			{
 				TSharedPtr<FJsonValue> GameSessionsJson = GameSession->GetField(FString(TEXT("GameSessions")),EJson::Object);
-				data = CreateGameSessionFromJson(GameSessionsJson);
+				data = CreateGameSessionFromJson(GameSessionsJson, GetResponseTime(Response));
 			}
 			OnClosed.Execute(data,false,EGameLiftExceptionsBP::None);
 			return;
@@ -155,10 +206,65 @@ void UGLBSServiceConnector::CloseGameSession(FSingleGameSessionResult OnClosed,F
 		FGameSessionData data;
 		OnClosed.Execute(data,false,EGameLiftExceptionsBP::None);
 	});
-	Request->ProcessRequest();
+	ProcessTracedRequest(Request);
 }
 
-FGameSessionData UGLBSServiceConnector::CreateGameSessionFromJson(TSharedPtr<FJsonValue> GameSessionJson)
+void UGLBSServiceConnector::ReportSessionLoad(FString GameSessionId,FGameSessionLoad Load)
+{
+	GLBS_TRACE_CPU_SCOPE("GLBS::ReportSessionLoad");
+	FHttpModule& Module= FHttpModule::Get();
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Module.CreateRequest();
+
+	Request->SetURL("https://europe-west3-odinfleettest.cloudfunctions.net/GameLiftReportSessionLoad");
+	Request->SetVerb("POST");
+	Request->SetHeader("Content-Type", "application/json");
+
+	TSharedPtr<FJsonObject> LoadJson = MakeShared<FJsonObject>();
+	LoadJson->SetNumberField(TEXT("TickMsP95"),Load.TickMsP95);
+	LoadJson->SetNumberField(TEXT("CpuPercent"),Load.CpuPercent);
+	LoadJson->SetNumberField(TEXT("FreeMemoryMB"),Load.FreeMemoryMB);
+	LoadJson->SetNumberField(TEXT("BandwidthKBps"),Load.BandwidthKBps);
+	TSharedPtr<FJsonObject> JsonData = MakeShared<FJsonObject>();
+	JsonData->SetStringField(TEXT("GameSessionId"),GameSessionId);
+	JsonData->SetObjectField(TEXT("Load"),LoadJson);
+
+	FString RequestBody;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
+	FJsonSerializer::Serialize(JsonData.ToSharedRef(), Writer);
+	Request->SetContentAsString(RequestBody);
+
+	// The next report replaces a lost one, so failures are only logged.
+	Request->OnProcessRequestComplete().BindLambda([GameSessionId](FHttpRequestPtr CompletedRequest, FHttpResponsePtr Response,bool bOK)
+	{
+		TraceRequestComplete(CompletedRequest);
+		if (!bOK || !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Could not report the load of game session %s"), *GameSessionId);
+		}
+	});
+	ProcessTracedRequest(Request);
+}
+
+float UGLBSServiceConnector::GetLoadScore(const FGameSessionLoad& Load,float TickBudgetMs,float LowMemoryMB)
+{
+	if (!Load.bValid)
+	{
+		return 1.0f;
+	}
+	const float TickLoad = TickBudgetMs > 0.0f ? Load.TickMsP95 / TickBudgetMs : 0.0f;
+	const float MemoryLoad = Load.FreeMemoryMB < LowMemoryMB ? 1.0f : 0.0f;
+	return FMath::Max3(TickLoad, Load.CpuPercent / 100.0f, MemoryLoad);
+}
+
+void UGLBSServiceConnector::SortSessionsByLoad(TArray<FGameSessionData>& GameSessions,float TickBudgetMs)
+{
+	GameSessions.StableSort([TickBudgetMs](const FGameSessionData& A, const FGameSessionData& B)
+	{
+		return GetLoadScore(A.Load, TickBudgetMs) < GetLoadScore(B.Load, TickBudgetMs);
+	});
+}
+
+FGameSessionData UGLBSServiceConnector::CreateGameSessionFromJson(TSharedPtr<FJsonValue> GameSessionJson,const FDateTime& ResponseTime)
 {
 	FGameSessionData data;
 	TSharedPtr<FJsonObject> obj = GameSessionJson->AsObject();
@@ -224,9 +330,26 @@ FGameSessionData UGLBSServiceConnector::CreateGameSessionFromJson(TSharedPtr<FJs
 	{
 		data.Location =obj->GetStringField(TEXT("Location"));
 	}
+	if (obj->HasTypedField<EJson::Object>(TEXT("Load")))
+	{
+		data.Load =CreateGameSessionLoadFromJson(obj->GetObjectField(TEXT("Load")), ResponseTime);
+	}
 	return data;
 }
 
+FGameSessionLoad UGLBSServiceConnector::CreateGameSessionLoadFromJson(TSharedPtr<FJsonObject> LoadJson,const FDateTime& ResponseTime)
+{
+	FGameSessionLoad Load;
+	Load.TickMsP95 = LoadJson->GetNumberField(TEXT("TickMsP95"));
+	Load.CpuPercent = LoadJson->GetNumberField(TEXT("CpuPercent"));
+	Load.FreeMemoryMB = LoadJson->GetNumberField(TEXT("FreeMemoryMB"));
+	Load.BandwidthKBps = LoadJson->GetNumberField(TEXT("BandwidthKBps"));
+	FDateTime::ParseIso8601(*LoadJson->GetStringField(TEXT("ReportTime")), Load.ReportTime);
+	// Both times come from the backend's clock; the client's may be off by any amount.
+	Load.bValid = ResponseTime.GetTicks() > 0 && (ResponseTime - Load.ReportTime).GetTotalSeconds() <= MaxLoadAgeSeconds;
+	return Load;
+}
+
 FPlayerSessionData UGLBSServiceConnector::CreatePlayerSessionFromJson(TSharedPtr<FJsonValue> PlayerSessionJson)
 {
 	FPlayerSessionData data;
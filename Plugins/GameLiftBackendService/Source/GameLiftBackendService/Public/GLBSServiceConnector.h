@@ -10,6 +10,34 @@
 #include "Kismet/BlueprintAsyncActionBase.h"
 #include "GLBSServiceConnector.generated.h"
 
+/**
+ * How loaded the server hosting a game session is. Servers report it through ReportSessionLoad and
+ * search results return the latest report.
+ */
+USTRUCT(BlueprintType,Blueprintable)
+struct FGameSessionLoad
+{
+	GENERATED_BODY()
+
+	// False if the server had not reported within MaxLoadAgeSeconds of the backend's response.
+	UPROPERTY(BlueprintReadWrite)
+	bool bValid = false;
+	// 95th percentile of the game world's tick duration.
+	UPROPERTY(BlueprintReadWrite)
+	float TickMsP95 = 0.0f;
+	// The server process's share of the host's CPUs.
+	UPROPERTY(BlueprintReadWrite)
+	float CpuPercent = 0.0f;
+	UPROPERTY(BlueprintReadWrite)
+	float FreeMemoryMB = 0.0f;
+	// Sent to all clients of the server.
+	UPROPERTY(BlueprintReadWrite)
+	float BandwidthKBps = 0.0f;
+	// Set by the backend when the report arrives.
+	UPROPERTY(BlueprintReadWrite)
+	FDateTime ReportTime;
+};
+
 /**
  * 
  */
@@ -46,6 +74,8 @@ struct FGameSessionData
 	FString CreatorId;
 	UPROPERTY(BlueprintReadWrite)
 	FString Location;
+	UPROPERTY(BlueprintReadWrite)
+	FGameSessionLoad Load;
 };
 USTRUCT(BlueprintType,Blueprintable)
 struct FPlayerSessionData
@@ -96,10 +126,30 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "GLBS")
 	static void CloseGameSession(FSingleGameSessionResult OnCreated,FString GameSessionId);
+
+	/** Sent by the server for each of its active game sessions, see AOdinFleetGameMode::LoadReportIntervalSeconds. */
+	UFUNCTION(BlueprintCallable, Category = "GLBS")
+	static void ReportSessionLoad(FString GameSessionId,FGameSessionLoad Load);
+
+	/**
+	 * 0 for an idle server, 1 for one at its limit: the highest of the tick time against TickBudgetMs,
+	 * the CPU share, and running low on memory. Sessions without a recent report count as 1.
+	 */
+	UFUNCTION(BlueprintPure, Category = "GLBS")
+	static float GetLoadScore(const FGameSessionLoad& Load,float TickBudgetMs = 33.3f,float LowMemoryMB = 512.0f);
+
+	/** Orders search results so the sessions on the least loaded servers come first. */
+	UFUNCTION(BlueprintCallable, Category = "GLBS")
+	static void SortSessionsByLoad(UPARAM(ref) TArray<FGameSessionData>& GameSessions,float TickBudgetMs = 33.3f);
+
+	// Older load reports are ignored; servers report far more often than this.
+	static constexpr double MaxLoadAgeSeconds = 60.0;
 	
 private:
 	TWeakObjectPtr<UWorld> WorldPtr;
 
-	static FGameSessionData CreateGameSessionFromJson(TSharedPtr<FJsonValue> GameSessionJson);
+	// ResponseTime is the backend's clock when it answered, see FGameSessionLoad::bValid.
+	static FGameSessionData CreateGameSessionFromJson(TSharedPtr<FJsonValue> GameSessionJson,const FDateTime& ResponseTime);
 	static FPlayerSessionData CreatePlayerSessionFromJson(TSharedPtr<FJsonValue> PlayerSessionJson);
+	static FGameSessionLoad CreateGameSessionLoadFromJson(TSharedPtr<FJsonObject> LoadJson,const FDateTime& ResponseTime);
 };
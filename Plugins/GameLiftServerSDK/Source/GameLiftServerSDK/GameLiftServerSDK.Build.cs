@@ -18,6 +18,7 @@ public class GameLiftServerSDK : ModuleRules
 {
     public GameLiftServerSDK(ReadOnlyTargetRules Target) : base(Target)
     {
+        PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine" });
         PrivateDependencyModuleNames.AddRange(new string[] { "Core", "Projects", "OpenSSL" });
         PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
         bEnableExceptions = true;
@@ -40,6 +41,9 @@ public class GameLiftServerSDK : ModuleRules
         PrivateDefinitions.Add("asio_signal_handler=gamelift_asio_signal_handler");
 
         PrivateDefinitions.Add("AWS_GAMELIFT_EXPORTS");
+
+        // Report SDK timings on the GameLift trace channel, see GameLiftServerSDKTrace.h
+        PrivateDefinitions.Add("GAMELIFT_USE_UE_TRACE=1");
         PrivateDefinitions.Add("ASIO_STANDALONE=1");
 
         // std::invoke_result replaces std::result_of for C++17 and later
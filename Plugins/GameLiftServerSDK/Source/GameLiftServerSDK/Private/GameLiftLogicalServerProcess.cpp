@@ -0,0 +1,249 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include "GameLiftLogicalServerProcess.h"
+#include "Modules/ModuleManager.h"
+#include <chrono>
+#include <future>
+#include <memory>
+
+FGameLiftLogicalServerProcess::FGameLiftLogicalServerProcess(const FString& InProcessIdSuffix)
+    : ProcessIdSuffix(InProcessIdSuffix)
+{
+    CallbackState.Module = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+    CallbackState.Parameters = MakeShared<FProcessParameters, ESPMode::ThreadSafe>();
+}
+
+FGameLiftLogicalServerProcess::~FGameLiftLogicalServerProcess()
+{
+#if WITH_GAMELIFT
+    // Disconnects and stops the health check thread, so no callback can start after this.
+    delete Process;
+    Process = nullptr;
+#endif
+}
+
+FGameLiftGenericOutcome FGameLiftLogicalServerProcess::Connect(const FServerParameters& serverParameters)
+{
+#if WITH_GAMELIFT
+    if (Process) {
+        return FGameLiftGenericOutcome(FGameLiftError(Aws::GameLift::GameLiftError(Aws::GameLift::GAMELIFT_ERROR_TYPE::ALREADY_INITIALIZED)));
+    }
+    auto outcome = Aws::GameLift::Server::LogicalServerProcess::Create(FGameLiftServerSDKModule::ToSdkServerParameters(serverParameters), TCHAR_TO_UTF8(*ProcessIdSuffix));
+    if (outcome.IsSuccess()) {
+        Process = outcome.GetResult();
+        return FGameLiftGenericOutcome(nullptr);
+    }
+    else {
+        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
+    }
+#else
+    return FGameLiftGenericOutcome(nullptr);
+#endif
+}
+
+// The SDK invokes these on its own threads; each hands the event to the game thread if the process still exists.
+void FGameLiftLogicalServerProcess::OnActivateFunctionInternal(const Aws::GameLift::Server::Model::GameSession& gameSession, void* state) {
+    FCallbackState* callbackState = static_cast<FCallbackState*>(state);
+    TWeakPtr<FProcessParameters, ESPMode::ThreadSafe> parameters = callbackState->Parameters;
+    callbackState->Module->EnqueueGameThreadEvent([parameters, gameSession]() {
+        if (TSharedPtr<FProcessParameters, ESPMode::ThreadSafe> pinned = parameters.Pin()) {
+            GAMELIFT_TRACE_CPU_SCOPE("GameLift::OnStartGameSession");
+            pinned->OnActivateFunction(gameSession);
+        }
+    });
+}
+
+void FGameLiftLogicalServerProcess::OnUpdateFunctionInternal(const Aws::GameLift::Server::Model::UpdateGameSession& updateGameSession, void* state) {
+    FCallbackState* callbackState = static_cast<FCallbackState*>(state);
+    TWeakPtr<FProcessParameters, ESPMode::ThreadSafe> parameters = callbackState->Parameters;
+    callbackState->Module->EnqueueGameThreadEvent([parameters, updateGameSession]() {
+        if (TSharedPtr<FProcessParameters, ESPMode::ThreadSafe> pinned = parameters.Pin()) {
+            GAMELIFT_TRACE_CPU_SCOPE("GameLift::OnUpdateGameSession");
+            pinned->OnUpdateFunction(updateGameSession);
+        }
+    });
+}
+
+void FGameLiftLogicalServerProcess::OnTerminateFunctionInternal(void* state) {
+    FCallbackState* callbackState = static_cast<FCallbackState*>(state);
+    TWeakPtr<FProcessParameters, ESPMode::ThreadSafe> parameters = callbackState->Parameters;
+    callbackState->Module->EnqueueGameThreadEvent([parameters]() {
+        if (TSharedPtr<FProcessParameters, ESPMode::ThreadSafe> pinned = parameters.Pin()) {
+            GAMELIFT_TRACE_CPU_SCOPE("GameLift::OnProcessTerminate");
+            pinned->OnTerminateFunction();
+        }
+    });
+}
+
+bool FGameLiftLogicalServerProcess::OnHealthCheckInternal(void* state) {
+    FCallbackState* callbackState = static_cast<FCallbackState*>(state);
+    TWeakPtr<FProcessParameters, ESPMode::ThreadSafe> parameters = callbackState->Parameters;
+    std::shared_ptr<std::promise<bool>> healthy = std::make_shared<std::promise<bool>>();
+    std::future<bool> result = healthy->get_future();
+    callbackState->Module->EnqueueGameThreadEvent([parameters, healthy]() {
+        GAMELIFT_TRACE_CPU_SCOPE("GameLift::OnHealthCheck");
+        TSharedPtr<FProcessParameters, ESPMode::ThreadSafe> pinned = parameters.Pin();
+        healthy->set_value(pinned.IsValid() && pinned->OnHealthCheckFunction());
+    });
+    GAMELIFT_TRACE_CPU_SCOPE("GameLift::WaitForGameThreadHealthCheck");
+    const auto timeout = std::chrono::duration<float>(FGameLiftServerSDKModule::HEALTH_CHECK_GAME_THREAD_TIMEOUT_SECONDS);
+    if (result.wait_for(timeout) != std::future_status::ready) {
+        return false;
+    }
+    return result.get();
+}
+
+FGameLiftGenericOutcome FGameLiftLogicalServerProcess::ProcessReady(FProcessParameters& processParameters) {
+#if WITH_GAMELIFT
+    if (!Process) {
+        return FGameLiftGenericOutcome(FGameLiftError(Aws::GameLift::GameLiftError(Aws::GameLift::GAMELIFT_ERROR_TYPE::NOT_INITIALIZED)));
+    }
+
+    // The callbacks read the parameters on the game thread. From elsewhere, replace them through
+    // the same queue, ahead of any event this ProcessReady can cause.
+    if (IsInGameThread()) {
+        *CallbackState.Parameters = processParameters;
+    }
+    else {
+        CallbackState.Module->EnqueueGameThreadEvent([parameters = CallbackState.Parameters, processParameters]() {
+            *parameters = processParameters;
+        });
+    }
+
+    Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
+        OnActivateFunctionInternal,
+        &CallbackState,
+        OnUpdateFunctionInternal,
+        &CallbackState,
+        OnTerminateFunctionInternal,
+        &CallbackState,
+        OnHealthCheckInternal,
+        &CallbackState,
+        processParameters.port,
+        FGameLiftServerSDKModule::ToSdkLogParameters(processParameters.logParameters)
+        );
+
+    auto outcome = Process->ProcessReady(processParams);
+    if (outcome.IsSuccess()){
+        return FGameLiftGenericOutcome(nullptr);
+    }
+    else {
+        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
+    }
+#else
+    return FGameLiftGenericOutcome(nullptr);
+#endif
+}
+
+FGameLiftGenericOutcome FGameLiftLogicalServerProcess::ProcessEnding() {
+#if WITH_GAMELIFT
+    if (!Process) {
+        return FGameLiftGenericOutcome(FGameLiftError(Aws::GameLift::GameLiftError(Aws::GameLift::GAMELIFT_ERROR_TYPE::NOT_INITIALIZED)));
+    }
+    auto outcome = Process->ProcessEnding();
+    if (outcome.IsSuccess()){
+        return FGameLiftGenericOutcome(nullptr);
+    }
+    else {
+        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
+    }
+#else
+    return FGameLiftGenericOutcome(nullptr);
+#endif
+}
+
+FGameLiftGenericOutcome FGameLiftLogicalServerProcess::ActivateGameSession() {
+#if WITH_GAMELIFT
+    if (!Process) {
+        return FGameLiftGenericOutcome(FGameLiftError(Aws::GameLift::GameLiftError(Aws::GameLift::GAMELIFT_ERROR_TYPE::NOT_INITIALIZED)));
+    }
+    auto outcome = Process->ActivateGameSession();
+    if (outcome.IsSuccess()){
+        return FGameLiftGenericOutcome(nullptr);
+    }
+    else {
+        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
+    }
+#else
+    return FGameLiftGenericOutcome(nullptr);
+#endif
+}
+
+FGameLiftGenericOutcome FGameLiftLogicalServerProcess::AcceptPlayerSession(const FString& playerSessionId) {
+#if WITH_GAMELIFT
+    if (!Process) {
+        return FGameLiftGenericOutcome(FGameLiftError(Aws::GameLift::GameLiftError(Aws::GameLift::GAMELIFT_ERROR_TYPE::NOT_INITIALIZED)));
+    }
+    auto outcome = Process->AcceptPlayerSession(TCHAR_TO_UTF8(*playerSessionId));
+    if (outcome.IsSuccess()){
+        return FGameLiftGenericOutcome(nullptr);
+    }
+    else {
+        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
+    }
+#else
+    return FGameLiftGenericOutcome(nullptr);
+#endif
+}
+
+FGameLiftGenericOutcome FGameLiftLogicalServerProcess::RemovePlayerSession(const FString& playerSessionId) {
+#if WITH_GAMELIFT
+    if (!Process) {
+        return FGameLiftGenericOutcome(FGameLiftError(Aws::GameLift::GameLiftError(Aws::GameLift::GAMELIFT_ERROR_TYPE::NOT_INITIALIZED)));
+    }
+    auto outcome = Process->RemovePlayerSession(TCHAR_TO_UTF8(*playerSessionId));
+    if (outcome.IsSuccess()){
+        return FGameLiftGenericOutcome(nullptr);
+    }
+    else {
+        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
+    }
+#else
+    return FGameLiftGenericOutcome(nullptr);
+#endif
+}
+
+FGameLiftGenericOutcome FGameLiftLogicalServerProcess::UpdatePlayerSessionCreationPolicy(EPlayerSessionCreationPolicy policy)
+{
+#if WITH_GAMELIFT
+    if (!Process) {
+        return FGameLiftGenericOutcome(FGameLiftError(Aws::GameLift::GameLiftError(Aws::GameLift::GAMELIFT_ERROR_TYPE::NOT_INITIALIZED)));
+    }
+    Aws::GameLift::Server::Model::PlayerSessionCreationPolicy internalPolicy = Aws::GameLift::Server::Model::PlayerSessionCreationPolicyMapper::GetPlayerSessionCreationPolicyForName(TCHAR_TO_UTF8(*GetNameForPlayerSessionCreationPolicy(policy)));
+    auto outcome = Process->UpdatePlayerSessionCreationPolicy(internalPolicy);
+    if (outcome.IsSuccess()){
+        return FGameLiftGenericOutcome(nullptr);
+    }
+    else {
+        return FGameLiftGenericOutcome(FGameLiftError(outcome.GetError()));
+    }
+#else
+    return FGameLiftGenericOutcome(nullptr);
+#endif
+}
+
+FGameLiftStringOutcome FGameLiftLogicalServerProcess::GetGameSessionId() {
+#if WITH_GAMELIFT
+    if (!Process) {
+        return FGameLiftStringOutcome(FGameLiftError(Aws::GameLift::GameLiftError(Aws::GameLift::GAMELIFT_ERROR_TYPE::NOT_INITIALIZED)));
+    }
+    auto outcome = Process->GetGameSessionId();
+    if (outcome.IsSuccess()){
+        return FGameLiftStringOutcome(outcome.GetResult());
+    }
+    else {
+        return FGameLiftStringOutcome(FGameLiftError(outcome.GetError()));
+    }
+#else
+    return FGameLiftStringOutcome("");
+#endif
+}
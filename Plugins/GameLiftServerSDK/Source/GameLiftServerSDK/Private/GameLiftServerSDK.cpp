@@ -13,16 +13,45 @@
 #include "Core.h"
 #include "Modules/ModuleManager.h"
 #include "Interfaces/IPluginManager.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include <chrono>
 #include <cstdlib>
+#include <future>
+#include <memory>
 
 #define LOCTEXT_NAMESPACE "FGameLiftServerSDKModule"
 
 void* FGameLiftServerSDKModule::GameLiftServerSDKLibraryHandle = nullptr;
 
-static FProcessParameters GameLiftProcessParameters;
+TRACE_DECLARE_INT_COUNTER(GameLiftGameThreadEvents, TEXT("GameLift/GameThreadEvents"));
 
 void FGameLiftServerSDKModule::StartupModule()
 {
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGameLiftServerSDKModule::Tick));
+}
+
+bool FGameLiftServerSDKModule::Tick(float DeltaTime)
+{
+    if (GameThreadEvents.IsEmpty())
+    {
+        return true;
+    }
+
+    GAMELIFT_TRACE_CPU_SCOPE("GameLift::DispatchGameThreadEvents");
+    int32 EventCount = 0;
+    TUniqueFunction<void()> Event;
+    while (GameThreadEvents.Dequeue(Event))
+    {
+        Event();
+        ++EventCount;
+    }
+    TRACE_COUNTER_SET(GameLiftGameThreadEvents, EventCount);
+    return true;
+}
+
+void FGameLiftServerSDKModule::EnqueueGameThreadEvent(TUniqueFunction<void()> Event)
+{
+    GameThreadEvents.Enqueue(MoveTemp(Event));
 }
 
 bool FGameLiftServerSDKModule::LoadDependency(const FString& Dir, const FString& Name, void*& Handle)
@@ -53,6 +82,7 @@ void FGameLiftServerSDKModule::FreeDependency(void*& Handle)
 
 void FGameLiftServerSDKModule::ShutdownModule()
 {
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
     FreeDependency(GameLiftServerSDKLibraryHandle);
 }
 
@@ -86,16 +116,7 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::InitSDK() {
 
 FGameLiftGenericOutcome FGameLiftServerSDKModule::InitSDK(const FServerParameters &serverParameters) {
 #if WITH_GAMELIFT
-    Aws::GameLift::Server::Model::ServerParameters sdkServerParameters;
-    sdkServerParameters.SetWebSocketUrl(TCHAR_TO_UTF8(*serverParameters.m_webSocketUrl));
-    sdkServerParameters.SetFleetId(TCHAR_TO_UTF8(*serverParameters.m_fleetId));
-    sdkServerParameters.SetProcessId(TCHAR_TO_UTF8(*serverParameters.m_processId));
-    sdkServerParameters.SetHostId(TCHAR_TO_UTF8(*serverParameters.m_hostId));
-    sdkServerParameters.SetAuthToken(TCHAR_TO_UTF8(*serverParameters.m_authToken));
-    sdkServerParameters.SetAwsRegion(TCHAR_TO_UTF8(*serverParameters.m_awsRegion));
-    sdkServerParameters.SetAccessKey(TCHAR_TO_UTF8(*serverParameters.m_accessKey));
-    sdkServerParameters.SetSecretKey(TCHAR_TO_UTF8(*serverParameters.m_secretKey));
-    sdkServerParameters.SetSessionToken(TCHAR_TO_UTF8(*serverParameters.m_sessionToken));
+    Aws::GameLift::Server::Model::ServerParameters sdkServerParameters = ToSdkServerParameters(serverParameters);
 
     auto initSDKOutcome = Aws::GameLift::Server::InitSDK(sdkServerParameters);
     if (initSDKOutcome.IsSuccess()) {
@@ -180,9 +201,43 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::Destroy()
 #endif
 }
 
-FGameLiftDescribePlayerSessionsOutcome FGameLiftServerSDKModule::DescribePlayerSessions(const FGameLiftDescribePlayerSessionsRequest &describePlayerSessionsRequest)
-{
 #if WITH_GAMELIFT
+namespace {
+FString ConvertUtf8(const char* utf8) {
+    // Converts straight into the FString's buffer, without an intermediate TCHAR copy.
+    return FString(static_cast<int32>(FCStringAnsi::Strlen(utf8)), reinterpret_cast<const UTF8CHAR*>(utf8));
+}
+
+// Remembers the last string converted for one field. Fleet, game session, IP address and DNS name
+// are usually the same for every player session in a page, so each is decoded once per page.
+class FRepeatedUtf8Field {
+public:
+    const FString& Convert(const char* utf8) {
+        if (!bConverted || LastUtf8 != utf8) {
+            LastUtf8 = utf8;
+            Converted = ConvertUtf8(utf8);
+            bConverted = true;
+        }
+        return Converted;
+    }
+
+private:
+    std::string LastUtf8;
+    FString Converted;
+    bool bConverted = false;
+};
+
+EPlayerSessionStatus ConvertPlayerSessionStatus(Aws::GameLift::Server::Model::PlayerSessionStatus status) {
+    switch (status) {
+        case Aws::GameLift::Server::Model::PlayerSessionStatus::RESERVED: return EPlayerSessionStatus::RESERVED;
+        case Aws::GameLift::Server::Model::PlayerSessionStatus::ACTIVE: return EPlayerSessionStatus::ACTIVE;
+        case Aws::GameLift::Server::Model::PlayerSessionStatus::COMPLETED: return EPlayerSessionStatus::COMPLETED;
+        case Aws::GameLift::Server::Model::PlayerSessionStatus::TIMEDOUT: return EPlayerSessionStatus::TIMEDOUT;
+        default: return EPlayerSessionStatus::NOT_SET;
+    }
+}
+
+Aws::GameLift::DescribePlayerSessionsOutcome CallDescribePlayerSessions(const FGameLiftDescribePlayerSessionsRequest &describePlayerSessionsRequest) {
     Aws::GameLift::Server::Model::DescribePlayerSessionsRequest request;
     request.SetGameSessionId(TCHAR_TO_UTF8(*describePlayerSessionsRequest.m_gameSessionId));
     request.SetPlayerId(TCHAR_TO_UTF8(*describePlayerSessionsRequest.m_playerId));
@@ -191,50 +246,50 @@ FGameLiftDescribePlayerSessionsOutcome FGameLiftServerSDKModule::DescribePlayerS
     request.SetLimit(describePlayerSessionsRequest.m_limit);
     request.SetNextToken(TCHAR_TO_UTF8(*describePlayerSessionsRequest.m_nextToken));
 
-    auto outcome = Aws::GameLift::Server::DescribePlayerSessions(request);
+    return Aws::GameLift::Server::DescribePlayerSessions(request);
+}
+} // namespace
+#endif
+
+FGameLiftDescribePlayerSessionsOutcome FGameLiftServerSDKModule::DescribePlayerSessions(const FGameLiftDescribePlayerSessionsRequest &describePlayerSessionsRequest)
+{
+#if WITH_GAMELIFT
+    auto outcome = CallDescribePlayerSessions(describePlayerSessionsRequest);
 
     if (outcome.IsSuccess()) {
         auto& outres = outcome.GetResult();
         FGameLiftDescribePlayerSessionsResult result;
-  
+
         int sessionCount = 0;
         auto sessions = outres.GetPlayerSessions(sessionCount);
         if (sessionCount > 0) {
-            TArray<FGameLiftPlayerSession> outSessions;
-            outSessions.Reserve(sessionCount);
+            result.m_playerSessions.Reserve(sessionCount);
 
+            FRepeatedUtf8Field gameSessionIds;
+            FRepeatedUtf8Field fleetIds;
+            FRepeatedUtf8Field ipAddresses;
+            FRepeatedUtf8Field dnsNames;
             for (int i = 0; i < sessionCount; ++i) {
                 auto session = sessions + i;
-                FGameLiftPlayerSession& outSession = outSessions.AddDefaulted_GetRef();
+                FGameLiftPlayerSession& outSession = result.m_playerSessions.AddDefaulted_GetRef();
 
-                outSession.m_playerSessionId = UTF8_TO_TCHAR(session->GetPlayerSessionId());
-                outSession.m_playerId = UTF8_TO_TCHAR(session->GetPlayerId());
-                outSession.m_gameSessionId = UTF8_TO_TCHAR(session->GetGameSessionId());
-                outSession.m_fleetId = UTF8_TO_TCHAR(session->GetFleetId());
+                outSession.m_playerSessionId = ConvertUtf8(session->GetPlayerSessionId());
+                outSession.m_playerId = ConvertUtf8(session->GetPlayerId());
+                outSession.m_gameSessionId = gameSessionIds.Convert(session->GetGameSessionId());
+                outSession.m_fleetId = fleetIds.Convert(session->GetFleetId());
                 outSession.m_creationTime = session->GetCreationTime();
                 outSession.m_terminationTime = session->GetTerminationTime();
-
-                switch (session->GetStatus()) {
-                    case Aws::GameLift::Server::Model::PlayerSessionStatus::NOT_SET: outSession.m_status = EPlayerSessionStatus::NOT_SET; break;
-                    case Aws::GameLift::Server::Model::PlayerSessionStatus::RESERVED: outSession.m_status = EPlayerSessionStatus::RESERVED; break;
-                    case Aws::GameLift::Server::Model::PlayerSessionStatus::ACTIVE: outSession.m_status = EPlayerSessionStatus::ACTIVE; break;
-                    case Aws::GameLift::Server::Model::PlayerSessionStatus::COMPLETED: outSession.m_status = EPlayerSessionStatus::COMPLETED; break;
-                    case Aws::GameLift::Server::Model::PlayerSessionStatus::TIMEDOUT: outSession.m_status = EPlayerSessionStatus::TIMEDOUT; break;
-                }
-
-                outSession.m_ipAddress = UTF8_TO_TCHAR(session->GetIpAddress());
+                outSession.m_status = ConvertPlayerSessionStatus(session->GetStatus());
+                outSession.m_ipAddress = ipAddresses.Convert(session->GetIpAddress());
                 outSession.m_port = session->GetPort();
-
-                outSession.m_playerData = UTF8_TO_TCHAR(session->GetPlayerData());
-                outSession.m_dnsName = UTF8_TO_TCHAR(session->GetDnsName());
+                outSession.m_playerData = ConvertUtf8(session->GetPlayerData());
+                outSession.m_dnsName = dnsNames.Convert(session->GetDnsName());
             }
-
-            result.m_playerSessions = outSessions;
         }
 
-        result.m_nextToken = (UTF8_TO_TCHAR(outres.GetNextToken()));
+        result.m_nextToken = ConvertUtf8(outres.GetNextToken());
 
-        return FGameLiftDescribePlayerSessionsOutcome(result);
+        return FGameLiftDescribePlayerSessionsOutcome(MoveTemp(result));
     }
     else {
         return FGameLiftDescribePlayerSessionsOutcome(FGameLiftError(outcome.GetError()));
@@ -244,26 +299,56 @@ FGameLiftDescribePlayerSessionsOutcome FGameLiftServerSDKModule::DescribePlayerS
 #endif
 }
 
-static void OnActivateFunctionInternal(Aws::GameLift::Server::Model::GameSession gameSession, void* state) {
-    GameLiftProcessParameters.OnActivateFunction(gameSession);
-}
+FGameLiftDescribePlayerSessionSummariesOutcome FGameLiftServerSDKModule::DescribePlayerSessionSummaries(const FGameLiftDescribePlayerSessionsRequest &describePlayerSessionsRequest)
+{
+#if WITH_GAMELIFT
+    auto outcome = CallDescribePlayerSessions(describePlayerSessionsRequest);
 
-static void OnUpdateFunctionInternal(Aws::GameLift::Server::Model::UpdateGameSession updateGameSession, void* state) {
-    GameLiftProcessParameters.OnUpdateFunction(updateGameSession);
-}
+    if (outcome.IsSuccess()) {
+        auto& outres = outcome.GetResult();
+        FGameLiftDescribePlayerSessionSummariesResult result;
 
-static void OnTerminateFunctionInternal(void* state) {
-    GameLiftProcessParameters.OnTerminateFunction();
-}
+        int sessionCount = 0;
+        auto sessions = outres.GetPlayerSessions(sessionCount);
+        if (sessionCount > 0) {
+            result.m_playerSessions.Reserve(sessionCount);
+            for (int i = 0; i < sessionCount; ++i) {
+                auto session = sessions + i;
+                FGameLiftPlayerSessionSummary& outSession = result.m_playerSessions.AddDefaulted_GetRef();
+                outSession.m_playerSessionId = ConvertUtf8(session->GetPlayerSessionId());
+                outSession.m_playerId = ConvertUtf8(session->GetPlayerId());
+                outSession.m_status = ConvertPlayerSessionStatus(session->GetStatus());
+            }
+        }
+
+        result.m_nextToken = ConvertUtf8(outres.GetNextToken());
 
-static bool OnHealthCheckInternal(void* state) {
-    return GameLiftProcessParameters.OnHealthCheckFunction();
+        return FGameLiftDescribePlayerSessionSummariesOutcome(MoveTemp(result));
+    }
+    else {
+        return FGameLiftDescribePlayerSessionSummariesOutcome(FGameLiftError(outcome.GetError()));
+    }
+#else
+    return FGameLiftDescribePlayerSessionSummariesOutcome(FGameLiftDescribePlayerSessionSummariesResult());
+#endif
 }
 
-FGameLiftGenericOutcome FGameLiftServerSDKModule::ProcessReady(FProcessParameters &processParameters) {
 #if WITH_GAMELIFT
-    GameLiftProcessParameters = processParameters;
+Aws::GameLift::Server::Model::ServerParameters FGameLiftServerSDKModule::ToSdkServerParameters(const FServerParameters &serverParameters) {
+    Aws::GameLift::Server::Model::ServerParameters sdkServerParameters;
+    sdkServerParameters.SetWebSocketUrl(TCHAR_TO_UTF8(*serverParameters.m_webSocketUrl));
+    sdkServerParameters.SetFleetId(TCHAR_TO_UTF8(*serverParameters.m_fleetId));
+    sdkServerParameters.SetProcessId(TCHAR_TO_UTF8(*serverParameters.m_processId));
+    sdkServerParameters.SetHostId(TCHAR_TO_UTF8(*serverParameters.m_hostId));
+    sdkServerParameters.SetAuthToken(TCHAR_TO_UTF8(*serverParameters.m_authToken));
+    sdkServerParameters.SetAwsRegion(TCHAR_TO_UTF8(*serverParameters.m_awsRegion));
+    sdkServerParameters.SetAccessKey(TCHAR_TO_UTF8(*serverParameters.m_accessKey));
+    sdkServerParameters.SetSecretKey(TCHAR_TO_UTF8(*serverParameters.m_secretKey));
+    sdkServerParameters.SetSessionToken(TCHAR_TO_UTF8(*serverParameters.m_sessionToken));
+    return sdkServerParameters;
+}
 
+Aws::GameLift::Server::LogParameters FGameLiftServerSDKModule::ToSdkLogParameters(const TArray<FString> &logParameters) {
 	char logPathsBuffer[MAX_LOG_PATHS][MAX_PATH_LENGTH];
 	const char* logPaths[MAX_LOG_PATHS];
 
@@ -271,11 +356,11 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::ProcessReady(FProcessParameter
 	memset(logPathsBuffer, 0, sizeof(logPathsBuffer));
 
     //only use the first MAX_LOG_PATHS values (duplicate logic in cpp SDK)
-	int32 numLogs = FMath::Min(processParameters.logParameters.Num(), MAX_LOG_PATHS);
+	int32 numLogs = FMath::Min(logParameters.Num(), MAX_LOG_PATHS);
 
 	for (int i = 0; i < numLogs; i++)
 	{
-		FTCHARToUTF8 utf8text(*processParameters.logParameters[i]);
+		FTCHARToUTF8 utf8text(*logParameters[i]);
 		if (utf8text.Length() < MAX_PATH_LENGTH)
 
 		{
@@ -285,6 +370,64 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::ProcessReady(FProcessParameter
 		logPaths[i] = logPathsBuffer[i];
 	}
 
+    return Aws::GameLift::Server::LogParameters(logPaths, numLogs);
+}
+#endif
+
+// The SDK invokes these on its own threads with the module as state; each hands the event to the game thread.
+void FGameLiftServerSDKModule::OnActivateFunctionInternal(const Aws::GameLift::Server::Model::GameSession& gameSession, void* state) {
+    FGameLiftServerSDKModule* module = static_cast<FGameLiftServerSDKModule*>(state);
+    module->EnqueueGameThreadEvent([module, gameSession]() {
+        GAMELIFT_TRACE_CPU_SCOPE("GameLift::OnStartGameSession");
+        module->GameLiftProcessParameters.OnActivateFunction(gameSession);
+    });
+}
+
+void FGameLiftServerSDKModule::OnUpdateFunctionInternal(const Aws::GameLift::Server::Model::UpdateGameSession& updateGameSession, void* state) {
+    FGameLiftServerSDKModule* module = static_cast<FGameLiftServerSDKModule*>(state);
+    module->EnqueueGameThreadEvent([module, updateGameSession]() {
+        GAMELIFT_TRACE_CPU_SCOPE("GameLift::OnUpdateGameSession");
+        module->GameLiftProcessParameters.OnUpdateFunction(updateGameSession);
+    });
+}
+
+void FGameLiftServerSDKModule::OnTerminateFunctionInternal(void* state) {
+    FGameLiftServerSDKModule* module = static_cast<FGameLiftServerSDKModule*>(state);
+    module->EnqueueGameThreadEvent([module]() {
+        GAMELIFT_TRACE_CPU_SCOPE("GameLift::OnProcessTerminate");
+        module->GameLiftProcessParameters.OnTerminateFunction();
+    });
+}
+
+bool FGameLiftServerSDKModule::OnHealthCheckInternal(void* state) {
+    FGameLiftServerSDKModule* module = static_cast<FGameLiftServerSDKModule*>(state);
+    // A game thread that does not answer in time is reported as unhealthy. std::promise, unlike
+    // TPromise, may be destroyed unfulfilled if the event is dropped at shutdown.
+    std::shared_ptr<std::promise<bool>> healthy = std::make_shared<std::promise<bool>>();
+    std::future<bool> result = healthy->get_future();
+    module->EnqueueGameThreadEvent([module, healthy]() {
+        GAMELIFT_TRACE_CPU_SCOPE("GameLift::OnHealthCheck");
+        healthy->set_value(module->GameLiftProcessParameters.OnHealthCheckFunction());
+    });
+    GAMELIFT_TRACE_CPU_SCOPE("GameLift::WaitForGameThreadHealthCheck");
+    const auto timeout = std::chrono::duration<float>(HEALTH_CHECK_GAME_THREAD_TIMEOUT_SECONDS);
+    if (result.wait_for(timeout) != std::future_status::ready) {
+        return false;
+    }
+    return result.get();
+}
+
+FGameLiftGenericOutcome FGameLiftServerSDKModule::ProcessReady(FProcessParameters &processParameters) {
+#if WITH_GAMELIFT
+    // Called through CallAsync as well; the copy is read by the game thread, so it is replaced there,
+    // ahead of any callback the service sends in reply.
+    if (IsInGameThread()) {
+        GameLiftProcessParameters = processParameters;
+    }
+    else {
+        EnqueueGameThreadEvent([this, processParameters]() { GameLiftProcessParameters = processParameters; });
+    }
+
     const TSharedPtr<IPlugin> StandalonePlugin = IPluginManager::Get().FindPlugin(TEXT("GameLiftPlugin"));
     const TSharedPtr<IPlugin> LightweightPlugin = IPluginManager::Get().FindPlugin(TEXT("GameLiftServerSDK"));
 
@@ -327,15 +470,15 @@ FGameLiftGenericOutcome FGameLiftServerSDKModule::ProcessReady(FProcessParameter
 
     Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
         OnActivateFunctionInternal,
-        nullptr,
+        this,
         OnUpdateFunctionInternal,
-        nullptr,
+        this,
         OnTerminateFunctionInternal,
-        nullptr,
+        this,
         OnHealthCheckInternal,
-        nullptr,
+        this,
         processParameters.port,
-        Aws::GameLift::Server::LogParameters(logPaths, numLogs)
+        ToSdkLogParameters(processParameters.logParameters)
         );
 
     auto outcome = Aws::GameLift::Server::ProcessReady(processParams);
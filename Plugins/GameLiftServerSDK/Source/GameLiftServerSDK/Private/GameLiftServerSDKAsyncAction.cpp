@@ -0,0 +1,123 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "GameLiftServerSDKAsyncAction.h"
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::Create(UObject* WorldContextObject, TFunction<FGameLiftStringOutcome(FGameLiftServerSDKModule&)> Call)
+{
+    UGameLiftServerSDKAsyncAction* Action = NewObject<UGameLiftServerSDKAsyncAction>();
+    Action->Call = MoveTemp(Call);
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::CreateGeneric(UObject* WorldContextObject, TFunction<FGameLiftGenericOutcome(FGameLiftServerSDKModule&)> Call)
+{
+    return Create(WorldContextObject, [Call = MoveTemp(Call)](FGameLiftServerSDKModule& Module) {
+        FGameLiftGenericOutcome Outcome = Call(Module);
+        return Outcome.IsSuccess() ? FGameLiftStringOutcome(FString()) : FGameLiftStringOutcome(Outcome.GetError());
+    });
+}
+
+void UGameLiftServerSDKAsyncAction::Activate()
+{
+    FGameLiftServerSDKModule* Module = FModuleManager::GetModulePtr<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+    if (Module == nullptr)
+    {
+        OnFailure.Broadcast(FString(), TEXT("GameLiftServerSDK module is not loaded"));
+        SetReadyToDestroy();
+        return;
+    }
+
+    TWeakObjectPtr<UGameLiftServerSDKAsyncAction> WeakThis(this);
+    Module->CallAsync<FGameLiftStringOutcome>(
+        [Call = Call](FGameLiftServerSDKModule& Module) { return Call(Module); },
+        [WeakThis](const FGameLiftStringOutcome& Outcome) {
+            UGameLiftServerSDKAsyncAction* Action = WeakThis.Get();
+            if (Action == nullptr)
+            {
+                return;
+            }
+            if (Outcome.IsSuccess())
+            {
+                Action->OnSuccess.Broadcast(Outcome.GetResult(), FString());
+            }
+            else
+            {
+                Action->OnFailure.Broadcast(FString(), Outcome.GetError().m_errorMessage);
+            }
+            Action->SetReadyToDestroy();
+        });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::ActivateGameSession(UObject* WorldContextObject)
+{
+    return CreateGeneric(WorldContextObject, [](FGameLiftServerSDKModule& Module) { return Module.ActivateGameSession(); });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::ProcessEnding(UObject* WorldContextObject)
+{
+    return CreateGeneric(WorldContextObject, [](FGameLiftServerSDKModule& Module) { return Module.ProcessEnding(); });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::AcceptPlayerSession(UObject* WorldContextObject, const FString& PlayerSessionId)
+{
+    return CreateGeneric(WorldContextObject, [PlayerSessionId](FGameLiftServerSDKModule& Module) { return Module.AcceptPlayerSession(PlayerSessionId); });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::RemovePlayerSession(UObject* WorldContextObject, const FString& PlayerSessionId)
+{
+    return CreateGeneric(WorldContextObject, [PlayerSessionId](FGameLiftServerSDKModule& Module) { return Module.RemovePlayerSession(PlayerSessionId); });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::UpdatePlayerSessionCreationPolicy(UObject* WorldContextObject, bool bAcceptAll)
+{
+    const EPlayerSessionCreationPolicy Policy = bAcceptAll ? EPlayerSessionCreationPolicy::ACCEPT_ALL : EPlayerSessionCreationPolicy::DENY_ALL;
+    return CreateGeneric(WorldContextObject, [Policy](FGameLiftServerSDKModule& Module) { return Module.UpdatePlayerSessionCreationPolicy(Policy); });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::GetGameSessionId(UObject* WorldContextObject)
+{
+    return Create(WorldContextObject, [](FGameLiftServerSDKModule& Module) { return Module.GetGameSessionId(); });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::GetTerminationTime(UObject* WorldContextObject)
+{
+    return Create(WorldContextObject, [](FGameLiftServerSDKModule& Module) {
+        FGameLiftLongOutcome Outcome = Module.GetTerminationTime();
+        return Outcome.IsSuccess() ? FGameLiftStringOutcome(LexToString(static_cast<int64>(Outcome.GetResult()))) : FGameLiftStringOutcome(Outcome.GetError());
+    });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::StopMatchBackfill(UObject* WorldContextObject, const FString& TicketId, const FString& GameSessionArn, const FString& MatchmakingConfigurationArn)
+{
+    const FStopMatchBackfillRequest Request(TicketId, GameSessionArn, MatchmakingConfigurationArn);
+    return CreateGeneric(WorldContextObject, [Request](FGameLiftServerSDKModule& Module) { return Module.StopMatchBackfill(Request); });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::GetComputeCertificate(UObject* WorldContextObject)
+{
+    return Create(WorldContextObject, [](FGameLiftServerSDKModule& Module) {
+        FGameLiftGetComputeCertificateOutcome Outcome = Module.GetComputeCertificate();
+        return Outcome.IsSuccess() ? FGameLiftStringOutcome(Outcome.GetResult().m_certificate_path) : FGameLiftStringOutcome(Outcome.GetError());
+    });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::Destroy(UObject* WorldContextObject)
+{
+    return CreateGeneric(WorldContextObject, [](FGameLiftServerSDKModule& Module) { return Module.Destroy(); });
+}
+
+UGameLiftServerSDKAsyncAction* UGameLiftServerSDKAsyncAction::GetSdkVersion(UObject* WorldContextObject)
+{
+    return Create(WorldContextObject, [](FGameLiftServerSDKModule& Module) { return Module.GetSdkVersion(); });
+}
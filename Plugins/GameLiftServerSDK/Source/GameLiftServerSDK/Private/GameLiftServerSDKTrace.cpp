@@ -0,0 +1,76 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include "GameLiftServerSDKTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "aws/gamelift/internal/util/ProfilerTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(GameLiftChannel);
+
+TRACE_DECLARE_INT_COUNTER(GameLiftRequestsInFlight, TEXT("GameLift/RequestsInFlight"));
+TRACE_DECLARE_INT_COUNTER(GameLiftConnected, TEXT("GameLift/Connected"));
+TRACE_DECLARE_INT_COUNTER(GameLiftReconnects, TEXT("GameLift/Reconnects"));
+TRACE_DECLARE_INT_COUNTER(GameLiftHealthy, TEXT("GameLift/Healthy"));
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+// The SDK's scopes are named at run time, so they are emitted as dynamic CPU events.
+TraceScope::TraceScope(const char *name) : m_active(UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel | GameLiftChannel)) {
+    if (m_active) {
+        FCpuProfilerTrace::OutputBeginDynamicEvent(name);
+    }
+}
+
+TraceScope::~TraceScope() {
+    if (m_active) {
+        FCpuProfilerTrace::OutputEndEvent();
+    }
+}
+
+void TraceCounterAdd(TraceCounter counter, int64_t delta) {
+    switch (counter) {
+    case TraceCounter::REQUESTS_IN_FLIGHT:
+        TRACE_COUNTER_ADD(GameLiftRequestsInFlight, delta);
+        break;
+    case TraceCounter::CONNECTED:
+        TRACE_COUNTER_ADD(GameLiftConnected, delta);
+        break;
+    case TraceCounter::RECONNECTS:
+        TRACE_COUNTER_ADD(GameLiftReconnects, delta);
+        break;
+    case TraceCounter::HEALTHY:
+        TRACE_COUNTER_ADD(GameLiftHealthy, delta);
+        break;
+    }
+}
+
+void TraceCounterSet(TraceCounter counter, int64_t value) {
+    switch (counter) {
+    case TraceCounter::REQUESTS_IN_FLIGHT:
+        TRACE_COUNTER_SET(GameLiftRequestsInFlight, value);
+        break;
+    case TraceCounter::CONNECTED:
+        TRACE_COUNTER_SET(GameLiftConnected, value);
+        break;
+    case TraceCounter::RECONNECTS:
+        TRACE_COUNTER_SET(GameLiftReconnects, value);
+        break;
+    case TraceCounter::HEALTHY:
+        TRACE_COUNTER_SET(GameLiftHealthy, value);
+        break;
+    }
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -31,6 +31,7 @@
 #include <aws/gamelift/internal/model/adapter/StartMatchBackfillAdapter.h>
 
 #include <aws/gamelift/internal/model/request/HeartbeatServerProcessRequest.h>
+#include <aws/gamelift/internal/model/request/WebSocketStartMatchBackfillStreamingRequest.h>
 #include <aws/gamelift/internal/model/request/WebSocketStopMatchBackfillRequest.h>
 #include <aws/gamelift/internal/model/response/WebSocketDescribePlayerSessionsResponse.h>
 
@@ -48,6 +49,7 @@
 
 #include <aws/gamelift/internal/util/GuidGenerator.h>
 #include <aws/gamelift/internal/util/HttpClient.h>
+#include <aws/gamelift/internal/util/ProfilerTrace.h>
 #include <aws/gamelift/internal/security/ContainerMetadataFetcher.h>
 #include <aws/gamelift/internal/security/ContainerCredentialsFetcher.h>
 #include <aws/gamelift/internal/security/AwsSigV4Utility.h>
@@ -56,7 +58,7 @@ using namespace Aws::GameLift;
 
 #ifdef GAMELIFT_USE_STD
 Aws::GameLift::Internal::GameLiftServerState::GameLiftServerState()
-    : m_onStartGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr), m_processReady(false), m_terminationTime(-1),
+    : m_onStartGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr),
       m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckThread(nullptr), m_healthCheckInterrupted(false),
       m_createGameSessionCallback(new CreateGameSessionCallback(this)), m_describePlayerSessionsCallback(new DescribePlayerSessionsCallback()),
       m_getComputeCertificateCallback(new GetComputeCertificateCallback()), m_getFleetRoleCredentialsCallback(new GetFleetRoleCredentialsCallback()),
@@ -64,25 +66,18 @@ Aws::GameLift::Internal::GameLiftServerState::GameLiftServerState()
       m_startMatchBackfillCallback(new StartMatchBackfillCallback()), m_refreshConnectionCallback(new RefreshConnectionCallback(this)) {}
 
 Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
-    m_processReady = false;
-    if (m_healthCheckThread && m_healthCheckThread->joinable()) {
-        {
-            std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-            m_healthCheckInterrupted = true;
-            // "Interrupts" the thread's sleep and causes it to evaluate its "wait_for" predicate.
-            // Since "m_healthCheckInterrupted = true" now the predicate will evaluate to "true" and
-            // the thread will continue without waiting the full ~60 second interval.
-            m_healthCheckConditionVariable.notify_all();
-        }
-        m_healthCheckThread->join();
-    }
+    m_state.Update([](GameLiftServerStateSnapshot &state) {
+        state.processReady = false;
+        state.terminationTime = -1;
+        return true;
+    });
+    StopHealthCheckThread();
 
     Aws::GameLift::Internal::GameLiftCommonState::SetInstance(nullptr);
     m_onStartGameSession = nullptr;
     m_onUpdateGameSession = nullptr;
     m_onProcessTerminate = nullptr;
     m_onHealthCheck = nullptr;
-    m_terminationTime = -1;
 
     // Tell the webSocketClientManager to disconnect and delete the websocket
     if (m_webSocketClientManager) {
@@ -124,8 +119,16 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const
     GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 
     if (result.IsSuccess()) {
-        spdlog::info("Successfully executed ActivateServerProcess. Marked m_processReady as true and starting m_healthCheckThread().");
-        m_processReady = true;
+        // A process recycled through ProcessEnding starts over without a game session. Its health check
+        // thread from before ProcessEnding must exit before processReady is set again.
+        StopHealthCheckThread();
+        m_state.Update([](GameLiftServerStateSnapshot &state) {
+            state.processReady = true;
+            state.gameSessionId.clear();
+            state.terminationTime = -1;
+            return true;
+        });
+        spdlog::info("Successfully executed ActivateServerProcess. Marked processReady as true and starting m_healthCheckThread().");
         m_healthCheckThread = std::unique_ptr<std::thread>(new std::thread([this] { HealthCheck(); }));
     } else {
         spdlog::info("Error while executing ActivateServerProcess. See the root cause error for more information.");
@@ -135,6 +138,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
+    GAMELIFT_TRACE_SCOPE("GameLift::ReportHealth");
     spdlog::info("Calling ReportHealth");
     std::future<bool> future(std::async([]() { return true; }));
     if (m_onHealthCheck) {
@@ -147,12 +151,16 @@ void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
     bool health = false;
 
     // wait_until blocks until timeoutSeconds has been reached or the result becomes available
-    if (std::future_status::ready == future.wait_until(timeoutSeconds)) {
-        health = future.get();
-        spdlog::info("Received Health Response: {} from Server Process: {}", health, m_processId);
-    } else {
-        spdlog::warn("Timed out waiting for health response from the server process {}. Reporting as unhealthy.", m_processId);
+    {
+        GAMELIFT_TRACE_SCOPE("GameLift::WaitForHealthCheck");
+        if (std::future_status::ready == future.wait_until(timeoutSeconds)) {
+            health = future.get();
+            spdlog::info("Received Health Response: {} from Server Process: {}", health, m_processId);
+        } else {
+            spdlog::warn("Timed out waiting for health response from the server process {}. Reporting as unhealthy.", m_processId);
+        }
     }
+    TraceCounterSet(TraceCounter::HEALTHY, health ? 1 : 0);
 
     Aws::GameLift::Internal::HeartbeatServerProcessRequest request = Aws::GameLift::Internal::HeartbeatServerProcessRequest().WithHealthy(health);
     if (m_webSocketClientManager || m_webSocketClientWrapper) {
@@ -167,7 +175,10 @@ void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
 }
 
 ::GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessEnding() {
-    m_processReady = false;
+    m_state.Update([](GameLiftServerStateSnapshot &state) {
+        state.processReady = false;
+        return true;
+    });
 
     if (AssertNetworkInitialized()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
@@ -180,20 +191,26 @@ void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
     return result;
 }
 
-std::string Aws::GameLift::Internal::GameLiftServerState::GetGameSessionId() const { return m_gameSessionId; }
+std::string Aws::GameLift::Internal::GameLiftServerState::GetGameSessionId() const { return m_state.Get()->gameSessionId; }
 
-long Aws::GameLift::Internal::GameLiftServerState::GetTerminationTime() const { return m_terminationTime; }
+long Aws::GameLift::Internal::GameLiftServerState::GetTerminationTime() const { return m_state.Get()->terminationTime; }
 
 GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ActivateGameSession() {
-    if (!m_processReady) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
+    // Read readiness and the session from one snapshot, without holding it while the request is sent.
+    std::string gameSessionId;
+    {
+        const GameLiftServerStateStore::Reader state = m_state.Get();
+        if (!state->processReady) {
+            return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
+        }
+        gameSessionId = state->gameSessionId;
     }
 
     if (AssertNetworkInitialized()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
-    Aws::GameLift::Internal::ActivateGameSessionRequest activateGameSessionRequest(m_gameSessionId);
+    Aws::GameLift::Internal::ActivateGameSessionRequest activateGameSessionRequest(gameSessionId);
     Aws::GameLift::Internal::Message &request = activateGameSessionRequest;
     GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 
@@ -209,12 +226,13 @@ Aws::GameLift::Internal::GameLiftServerState::UpdatePlayerSessionCreationPolicy(
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
-    if (m_gameSessionId.empty()) {
+    const std::string gameSessionId = m_state.Get()->gameSessionId;
+    if (gameSessionId.empty()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
     }
 
     Aws::GameLift::Internal::UpdatePlayerSessionCreationPolicyRequest updatePlayerSessionCreationPolicyRequest(
-        m_gameSessionId, PlayerSessionCreationPolicyMapper::GetNameForPlayerSessionCreationPolicy(newPlayerSessionPolicy));
+        gameSessionId, PlayerSessionCreationPolicyMapper::GetNameForPlayerSessionCreationPolicy(newPlayerSessionPolicy));
     Aws::GameLift::Internal::Message &request = updatePlayerSessionCreationPolicyRequest;
     GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 
@@ -242,7 +260,8 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::AcceptPlayerSession
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
-    if (m_gameSessionId.empty()) {
+    const std::string gameSessionId = m_state.Get()->gameSessionId;
+    if (gameSessionId.empty()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
     }
 
@@ -250,7 +269,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::AcceptPlayerSession
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty."));
     }
 
-    AcceptPlayerSessionRequest request = AcceptPlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId);
+    AcceptPlayerSessionRequest request = AcceptPlayerSessionRequest().WithGameSessionId(gameSessionId).WithPlayerSessionId(playerSessionId);
 
     return Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 }
@@ -260,7 +279,8 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::RemovePlayerSession
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
-    if (m_gameSessionId.empty()) {
+    const std::string gameSessionId = m_state.Get()->gameSessionId;
+    if (gameSessionId.empty()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
     }
 
@@ -268,7 +288,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::RemovePlayerSession
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty."));
     }
 
-    RemovePlayerSessionRequest request = RemovePlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId);
+    RemovePlayerSessionRequest request = RemovePlayerSessionRequest().WithGameSessionId(gameSessionId).WithPlayerSessionId(playerSessionId);
 
     return Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 }
@@ -278,27 +298,40 @@ void Aws::GameLift::Internal::GameLiftServerState::OnStartGameSession(Aws::GameL
     gameSession.SetFleetId(m_fleetId);
 
     std::string gameSessionId = gameSession.GetGameSessionId();
-    if (!m_processReady) {
+    const bool started = m_state.Update([&gameSessionId](GameLiftServerStateSnapshot &state) {
+        if (!state.processReady) {
+            return false;
+        }
+        state.gameSessionId = std::move(gameSessionId);
+        return true;
+    });
+    if (!started) {
         return;
     }
 
-    m_gameSessionId = gameSessionId;
-
     // Invoking OnStartGameSession callback if specified by the developer.
     if (m_onStartGameSession) {
-        std::thread activateGameSession(std::bind(m_onStartGameSession, gameSession));
+        // The callback's session is discarded after this call, so hand it to the thread instead of copying it.
+        std::thread activateGameSession([onStartGameSession = m_onStartGameSession, session = std::move(gameSession)]() mutable {
+            onStartGameSession(std::move(session));
+        });
         activateGameSession.detach();
     }
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::OnTerminateProcess(long terminationTime) {
     // If processReady was never invoked, the callback for processTerminate is null.
-    if (!m_processReady) {
+    const bool terminating = m_state.Update([terminationTime](GameLiftServerStateSnapshot &state) {
+        if (!state.processReady) {
+            return false;
+        }
+        state.terminationTime = terminationTime;
+        return true;
+    });
+    if (!terminating) {
         return;
     }
 
-    m_terminationTime = terminationTime;
-
     // Invoking OnProcessTerminate callback if specified by the developer.
     if (m_onProcessTerminate) {
         std::thread terminateProcess(std::bind(m_onProcessTerminate));
@@ -323,25 +356,33 @@ void Aws::GameLift::Internal::GameLiftServerState::OnTerminateProcess(long termi
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::OnUpdateGameSession(Aws::GameLift::Server::Model::UpdateGameSession &updateGameSession) {
-    if (!m_processReady) {
+    if (!m_state.Get()->processReady) {
         return;
     }
 
     // Invoking OnUpdateGameSession callback if specified by the developer.
     if (m_onUpdateGameSession) {
-        std::thread updateGameSessionThread(std::bind(m_onUpdateGameSession, updateGameSession));
+        std::thread updateGameSessionThread([onUpdateGameSession = m_onUpdateGameSession, update = std::move(updateGameSession)]() mutable {
+            onUpdateGameSession(std::move(update));
+        });
         updateGameSessionThread.detach();
     }
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::OnRefreshConnection(const std::string &refreshConnectionEndpoint, const std::string &authToken) {
-    if (!m_processReady) {
+    const bool refreshed = m_state.Update([&refreshConnectionEndpoint, &authToken](GameLiftServerStateSnapshot &state) {
+        if (!state.processReady) {
+            return false;
+        }
+        state.connectionEndpoint = refreshConnectionEndpoint;
+        state.authToken = authToken;
+        return true;
+    });
+    if (!refreshed) {
         return;
     }
-    m_connectionEndpoint = refreshConnectionEndpoint;
-    m_authToken = authToken;
-    spdlog::info("Refreshing Connection to ConnectionEndpoint: {} for process {}...", m_connectionEndpoint, m_processId);
-    m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
+    spdlog::info("Refreshing Connection to ConnectionEndpoint: {} for process {}...", refreshConnectionEndpoint, m_processId);
+    m_webSocketClientManager->Connect(refreshConnectionEndpoint, authToken, m_processId, m_hostId, m_fleetId);
 }
 
 bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() { return !m_webSocketClientManager || !m_webSocketClientManager->IsConnected(); }
@@ -352,7 +393,7 @@ bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() {
 #pragma GCC diagnostic ignored "-Wreorder-ctor"
 #endif
 Aws::GameLift::Internal::GameLiftServerState::GameLiftServerState()
-    : m_onStartGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr), m_processReady(false), m_terminationTime(-1),
+    : m_onStartGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr),
       m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckThread(nullptr), m_healthCheckInterrupted(false),
       m_createGameSessionCallback(new CreateGameSessionCallback(this)), m_describePlayerSessionsCallback(new DescribePlayerSessionsCallback()),
       m_getComputeCertificateCallback(new GetComputeCertificateCallback()), m_getFleetRoleCredentialsCallback(new GetFleetRoleCredentialsCallback()),
@@ -364,18 +405,12 @@ Aws::GameLift::Internal::GameLiftServerState::GameLiftServerState()
 #endif
 
 Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
-    m_processReady = false;
-    if (m_healthCheckThread && m_healthCheckThread->joinable()) {
-        {
-            std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-            m_healthCheckInterrupted = true;
-            // "Interrupts" the thread's sleep and causes it to evaluate its "wait_for" predicate.
-            // Since "m_healthCheckInterrupted = true" now the predicate will evaluate to "true" and
-            // the thread will continue without waiting the full ~60 second interval.
-            m_healthCheckConditionVariable.notify_all();
-        }
-        m_healthCheckThread->join();
-    }
+    m_state.Update([](GameLiftServerStateSnapshot &state) {
+        state.processReady = false;
+        state.terminationTime = -1;
+        return true;
+    });
+    StopHealthCheckThread();
 
     Aws::GameLift::Internal::GameLiftCommonState::SetInstance(nullptr);
     m_onStartGameSession = nullptr;
@@ -385,7 +420,6 @@ Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
     m_updateGameSessionState = nullptr;
     m_processTerminateState = nullptr;
     m_healthCheckState = nullptr;
-    m_terminationTime = -1;
 
     // Tell the webSocketClientManager to disconnect and delete the websocket
     if (m_webSocketClientManager) {
@@ -431,8 +465,16 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const
     GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 
     if (result.IsSuccess()) {
-        spdlog::info("Successfully executed ActivateServerProcess. Marked m_processReady as true and starting m_healthCheckThread().");
-        m_processReady = true;
+        // A process recycled through ProcessEnding starts over without a game session. Its health check
+        // thread from before ProcessEnding must exit before processReady is set again.
+        StopHealthCheckThread();
+        m_state.Update([](GameLiftServerStateSnapshot &state) {
+            state.processReady = true;
+            state.gameSessionId.clear();
+            state.terminationTime = -1;
+            return true;
+        });
+        spdlog::info("Successfully executed ActivateServerProcess. Marked processReady as true and starting m_healthCheckThread().");
         m_healthCheckThread = std::unique_ptr<std::thread>(new std::thread([this] { HealthCheck(); }));
     } else {
         spdlog::info("Error while executing ActivateServerProcess. See the root cause error for more information.");
@@ -442,6 +484,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
+    GAMELIFT_TRACE_SCOPE("GameLift::ReportHealth");
     spdlog::info("Calling ReportHealth");
     std::future<bool> future(std::async([]() { return true; }));
     if (m_onHealthCheck) {
@@ -452,12 +495,16 @@ void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
     bool health = false;
 
     // wait_until blocks until timeoutSeconds has been reached or the result becomes available
-    if (std::future_status::ready == future.wait_until(timeoutSeconds)) {
-        health = future.get();
-        spdlog::info("Received Health Response: {} from Server Process: {}", health, m_processId);
-    } else {
-        spdlog::warn("Timed out waiting for health response from the server process {}. Reporting as unhealthy.", m_processId);
+    {
+        GAMELIFT_TRACE_SCOPE("GameLift::WaitForHealthCheck");
+        if (std::future_status::ready == future.wait_until(timeoutSeconds)) {
+            health = future.get();
+            spdlog::info("Received Health Response: {} from Server Process: {}", health, m_processId);
+        } else {
+            spdlog::warn("Timed out waiting for health response from the server process {}. Reporting as unhealthy.", m_processId);
+        }
     }
+    TraceCounterSet(TraceCounter::HEALTHY, health ? 1 : 0);
 
     Aws::GameLift::Internal::HeartbeatServerProcessRequest msg = Aws::GameLift::Internal::HeartbeatServerProcessRequest().WithHealthy(health);
     if (m_webSocketClientManager || m_webSocketClientWrapper) {
@@ -472,7 +519,10 @@ void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
 }
 
 ::GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessEnding() {
-    m_processReady = false;
+    m_state.Update([](GameLiftServerStateSnapshot &state) {
+        state.processReady = false;
+        return true;
+    });
 
     if (AssertNetworkInitialized()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
@@ -485,20 +535,27 @@ void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
     return result;
 }
 
-const char * Aws::GameLift::Internal::GameLiftServerState::GetGameSessionId() { return m_gameSessionId.c_str(); }
+// The snapshot outlives any change of game session, so the pointer stays valid after one.
+const char *Aws::GameLift::Internal::GameLiftServerState::GetGameSessionId() { return m_state.Get()->gameSessionIdCStr; }
 
-long Aws::GameLift::Internal::GameLiftServerState::GetTerminationTime() { return m_terminationTime; }
+long Aws::GameLift::Internal::GameLiftServerState::GetTerminationTime() { return m_state.Get()->terminationTime; }
 
 GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ActivateGameSession() {
-    if (!m_processReady) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
+    // Read readiness and the session from one snapshot, without holding it while the request is sent.
+    std::string gameSessionId;
+    {
+        const GameLiftServerStateStore::Reader state = m_state.Get();
+        if (!state->processReady) {
+            return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
+        }
+        gameSessionId = state->gameSessionId;
     }
 
     if (AssertNetworkInitialized()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
-    Aws::GameLift::Internal::ActivateGameSessionRequest activateGameSessionRequest(m_gameSessionId);
+    Aws::GameLift::Internal::ActivateGameSessionRequest activateGameSessionRequest(gameSessionId);
     Aws::GameLift::Internal::Message &request = activateGameSessionRequest;
     GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 
@@ -514,12 +571,13 @@ Aws::GameLift::Internal::GameLiftServerState::UpdatePlayerSessionCreationPolicy(
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
-    if (m_gameSessionId.empty()) {
+    const std::string gameSessionId = m_state.Get()->gameSessionId;
+    if (gameSessionId.empty()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
     }
 
     Aws::GameLift::Internal::UpdatePlayerSessionCreationPolicyRequest updatePlayerSessionCreationPolicyRequest(
-        m_gameSessionId, PlayerSessionCreationPolicyMapper::GetNameForPlayerSessionCreationPolicy(newPlayerSessionPolicy));
+        gameSessionId, PlayerSessionCreationPolicyMapper::GetNameForPlayerSessionCreationPolicy(newPlayerSessionPolicy));
     Aws::GameLift::Internal::Message &request = updatePlayerSessionCreationPolicyRequest;
     GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 
@@ -531,7 +589,8 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::AcceptPlayerSession
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
-    if (m_gameSessionId.empty()) {
+    const std::string gameSessionId = m_state.Get()->gameSessionId;
+    if (gameSessionId.empty()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
     }
 
@@ -539,7 +598,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::AcceptPlayerSession
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty."));
     }
 
-    AcceptPlayerSessionRequest request = AcceptPlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId);
+    AcceptPlayerSessionRequest request = AcceptPlayerSessionRequest().WithGameSessionId(gameSessionId).WithPlayerSessionId(playerSessionId);
 
     return Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 }
@@ -549,7 +608,8 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::RemovePlayerSession
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
-    if (m_gameSessionId.empty()) {
+    const std::string gameSessionId = m_state.Get()->gameSessionId;
+    if (gameSessionId.empty()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
     }
 
@@ -557,13 +617,11 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::RemovePlayerSession
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty."));
     }
 
-    RemovePlayerSessionRequest request = RemovePlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId);
+    RemovePlayerSessionRequest request = RemovePlayerSessionRequest().WithGameSessionId(gameSessionId).WithPlayerSessionId(playerSessionId);
 
     return Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 }
 
-std::shared_ptr<Aws::GameLift::Internal::IWebSocketClientWrapper> Aws::GameLift::Internal::GameLiftServerState::GetWebSocketClientWrapper() const { return m_webSocketClientWrapper; }
-
 Aws::GameLift::Internal::InitSDKOutcome Aws::GameLift::Internal::GameLiftServerState::ConstructInternal(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper) {
     if (GameLiftCommonState::GetInstance().IsSuccess()) {
         return Aws::GameLift::Internal::InitSDKOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::ALREADY_INITIALIZED));
@@ -586,39 +644,55 @@ void Aws::GameLift::Internal::GameLiftServerState::OnStartGameSession(Aws::GameL
     gameSession.SetFleetId(m_fleetId.c_str());
 
     std::string gameSessionId = gameSession.GetGameSessionId();
-    if (!m_processReady) {
+    const bool started = m_state.Update([&gameSessionId](GameLiftServerStateSnapshot &state) {
+        if (!state.processReady) {
+            return false;
+        }
+        state.gameSessionId = std::move(gameSessionId);
+        return true;
+    });
+    if (!started) {
         return;
     }
 
-    m_gameSessionId = gameSessionId;
-
     // Invoking OnStartGameSession callback if specified by the developer.
     if (m_onStartGameSession) {
-        std::thread activateGameSession(std::bind(m_onStartGameSession, gameSession, m_startGameSessionState));
+        // The callback's session is discarded after this call, so hand it to the thread instead of copying it.
+        std::thread activateGameSession([onStartGameSession = m_onStartGameSession, state = m_startGameSessionState, session = std::move(gameSession)]() {
+            onStartGameSession(session, state);
+        });
         activateGameSession.detach();
     }
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::OnUpdateGameSession(Aws::GameLift::Server::Model::UpdateGameSession &updateGameSession) {
-    if (!m_processReady) {
+    if (!m_state.Get()->processReady) {
         return;
     }
 
     // Invoking OnUpdateGameSession callback if specified by the developer.
     if (m_onUpdateGameSession) {
-        std::thread updateGameSessionThread(std::bind(m_onUpdateGameSession, updateGameSession, m_updateGameSessionState));
+        std::thread updateGameSessionThread(
+            [onUpdateGameSession = m_onUpdateGameSession, state = m_updateGameSessionState, update = std::move(updateGameSession)]() {
+                onUpdateGameSession(update, state);
+            });
         updateGameSessionThread.detach();
     }
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::OnTerminateProcess(long terminationTime) {
     // If processReady was never invoked, the callback for processTerminate is null.
-    if (!m_processReady) {
+    const bool terminating = m_state.Update([terminationTime](GameLiftServerStateSnapshot &state) {
+        if (!state.processReady) {
+            return false;
+        }
+        state.terminationTime = terminationTime;
+        return true;
+    });
+    if (!terminating) {
         return;
     }
 
-    m_terminationTime = terminationTime;
-
     // Invoking onProcessTerminate callback if specified by the developer.
     if (m_onProcessTerminate) {
         std::thread terminateProcess(std::bind(m_onProcessTerminate, m_processTerminateState));
@@ -643,18 +717,40 @@ void Aws::GameLift::Internal::GameLiftServerState::OnTerminateProcess(long termi
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::OnRefreshConnection(const std::string &refreshConnectionEndpoint, const std::string &authToken) {
-    if (!m_processReady) {
+    const bool refreshed = m_state.Update([&refreshConnectionEndpoint, &authToken](GameLiftServerStateSnapshot &state) {
+        if (!state.processReady) {
+            return false;
+        }
+        state.connectionEndpoint = refreshConnectionEndpoint;
+        state.authToken = authToken;
+        return true;
+    });
+    if (!refreshed) {
         return;
     }
-    m_connectionEndpoint = refreshConnectionEndpoint;
-    m_authToken = authToken;
-    spdlog::info("Refreshing Connection to ConnectionEndpoint: {} for process {}...", m_connectionEndpoint, m_processId);
-    m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
+    spdlog::info("Refreshing Connection to ConnectionEndpoint: {} for process {}...", refreshConnectionEndpoint, m_processId);
+    m_webSocketClientManager->Connect(refreshConnectionEndpoint, authToken, m_processId, m_hostId, m_fleetId);
 }
 
 bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() { return !m_webSocketClientManager || !m_webSocketClientManager->IsConnected(); }
 #endif
 
+std::shared_ptr<Aws::GameLift::Internal::IWebSocketClientWrapper> Aws::GameLift::Internal::GameLiftServerState::GetWebSocketClientWrapper() const { return m_webSocketClientWrapper; }
+
+Outcome<Aws::GameLift::Internal::GameLiftServerState *, GameLiftError>
+Aws::GameLift::Internal::GameLiftServerState::CreateLogicalInstance(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper, const std::string &processIdSuffix) {
+    if (processIdSuffix.empty()) {
+        return Outcome<GameLiftServerState *, GameLiftError>(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "processIdSuffix is missing."));
+    }
+
+    // Not registered with GameLiftCommonState; the destructor's SetInstance(nullptr) leaves the
+    // process-wide instance alone.
+    GameLiftServerState *newState = new GameLiftServerState();
+    newState->m_webSocketClientWrapper = webSocketClientWrapper;
+    newState->m_processIdSuffix = processIdSuffix;
+    return newState;
+}
+
 GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworking(const Aws::GameLift::Server::Model::ServerParameters &serverParameters) {
     spdlog::info("Initializing Networking");
 
@@ -673,8 +769,18 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
     char *sessionToken;
 
     GetOverrideParams(&webSocketUrl, &authToken, &processId, &hostId, &fleetId, &computeType, &awsRegion, &accessKey, &secretKey, &sessionToken);
-    m_connectionEndpoint = std::string(webSocketUrl == nullptr ? serverParameters.GetWebSocketUrl() : webSocketUrl);
-    m_authToken = std::string(authToken == nullptr ? serverParameters.GetAuthToken() : authToken);
+    m_state.Update([&](GameLiftServerStateSnapshot &state) {
+        state.connectionEndpoint = std::string(webSocketUrl == nullptr ? serverParameters.GetWebSocketUrl() : webSocketUrl);
+        state.authToken = std::string(authToken == nullptr ? serverParameters.GetAuthToken() : authToken);
+        return true;
+    });
+    std::string connectionEndpoint;
+    std::string connectionAuthToken;
+    {
+        const GameLiftServerStateStore::Reader state = m_state.Get();
+        connectionEndpoint = state->connectionEndpoint;
+        connectionAuthToken = state->authToken;
+    }
     m_fleetId = std::string(fleetId == nullptr ? serverParameters.GetFleetId() : fleetId);
     m_hostId = std::string(hostId == nullptr ? serverParameters.GetHostId() : hostId);
     m_processId = std::string(processId == nullptr ? serverParameters.GetProcessId() : processId);
@@ -715,7 +821,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
     }
 #endif
     bool isContainerComputeType = computeType && std::strcmp(computeType, COMPUTE_TYPE_CONTAINER) == 0;
-    bool authTokenPassed = !m_authToken.empty();
+    bool authTokenPassed = !connectionAuthToken.empty();
     bool sigV4ParametersPassed = awsRegion != nullptr && strlen(awsRegion) > 0 &&
             accessKey != nullptr && strlen(accessKey) > 0 && 
             secretKey != nullptr && strlen(secretKey) > 0;
@@ -732,12 +838,13 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
         snprintf(unauthorizedErrorMessage, maxErrorMessageSize, unauthorizedErrorMessageFormat, ENV_VAR_AUTH_TOKEN, ENV_VAR_ACCESS_KEY, ENV_VAR_SECRET_KEY, ENV_VAR_SESSION_TOKEN);
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::UNAUTHORIZED_EXCEPTION, unauthorizedErrorMessage));
     }
-    if (m_connectionEndpoint.empty()) {
+    if (connectionEndpoint.empty()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "webSocketUrl is missing."));
     }
     if (m_processId.empty()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "processId is missing."));
     }
+    m_processId += m_processIdSuffix;
     if (m_fleetId.empty()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "fleetId is missing."));
     }
@@ -747,7 +854,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
 
     if (authTokenPassed) {
         GenericOutcome outcome =
-            m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
+            m_webSocketClientManager->Connect(connectionEndpoint, connectionAuthToken, m_processId, m_hostId, m_fleetId);
         return outcome;
     } else {
         if (isContainerComputeType) {
@@ -785,8 +892,8 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
         }
         GenericOutcome outcome =
                 m_webSocketClientManager->Connect(
-                        m_connectionEndpoint,
-                        m_authToken,
+                        connectionEndpoint,
+                        connectionAuthToken,
                         m_processId,
                         m_hostId,
                         m_fleetId,
@@ -795,6 +902,21 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
     }
 }
 
+namespace {
+// Service pushes carry no response payload; adapt their callbacks to the websocket handler signature.
+template <typename CallbackT>
+std::function<Aws::GameLift::Internal::ResponseOutcome(std::string)> BindPushCallback(GenericOutcome (CallbackT::*onMessage)(const std::string &),
+                                                                                     CallbackT *callback) {
+    return [onMessage, callback](const std::string &data) {
+        GenericOutcome outcome = (callback->*onMessage)(data);
+        if (outcome.IsSuccess()) {
+            return Aws::GameLift::Internal::ResponseOutcome(Aws::GameLift::Internal::ResponsePayload());
+        }
+        return Aws::GameLift::Internal::ResponseOutcome(outcome.GetError());
+    };
+}
+} // namespace
+
 void Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks() {
     // Setup
     m_webSocketClientManager = new Aws::GameLift::Internal::GameLiftWebSocketClientManager(m_webSocketClientWrapper);
@@ -805,7 +927,7 @@ void Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks() {
     // callbacks
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         CreateGameSessionCallback::CREATE_GAME_SESSION,
-        std::bind(&CreateGameSessionCallback::OnStartGameSession, m_createGameSessionCallback.get(), std::placeholders::_1));
+        BindPushCallback(&CreateGameSessionCallback::OnStartGameSession, m_createGameSessionCallback.get()));
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         DescribePlayerSessionsCallback::DESCRIBE_PLAYER_SESSIONS,
         std::bind(&DescribePlayerSessionsCallback::OnDescribePlayerSessions, m_describePlayerSessionsCallback.get(), std::placeholders::_1));
@@ -817,21 +939,30 @@ void Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks() {
         std::bind(&GetFleetRoleCredentialsCallback::OnGetFleetRoleCredentials, m_getFleetRoleCredentialsCallback.get(), std::placeholders::_1));
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         TerminateProcessCallback::TERMINATE_PROCESS,
-        std::bind(&TerminateProcessCallback::OnTerminateProcess, m_terminateProcessCallback.get(), std::placeholders::_1));
+        BindPushCallback(&TerminateProcessCallback::OnTerminateProcess, m_terminateProcessCallback.get()));
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         UpdateGameSessionCallback::UPDATE_GAME_SESSION,
-        std::bind(&UpdateGameSessionCallback::OnUpdateGameSession, m_updateGameSessionCallback.get(), std::placeholders::_1));
+        BindPushCallback(&UpdateGameSessionCallback::OnUpdateGameSession, m_updateGameSessionCallback.get()));
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         StartMatchBackfillCallback::START_MATCH_BACKFILL,
         std::bind(&StartMatchBackfillCallback::OnStartMatchBackfill, m_startMatchBackfillCallback.get(), std::placeholders::_1));
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         RefreshConnectionCallback::REFRESH_CONNECTION,
-        std::bind(&RefreshConnectionCallback::OnRefreshConnection, m_refreshConnectionCallback.get(), std::placeholders::_1));
+        BindPushCallback(&RefreshConnectionCallback::OnRefreshConnection, m_refreshConnectionCallback.get()));
 }
 
 GenericOutcome Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(Message &message) {
+    ResponseOutcome outcome = SendSocketRequestWithRetries(message);
+    if (!outcome.IsSuccess()) {
+        return GenericOutcome(outcome.GetError());
+    }
+    return GenericOutcome(nullptr);
+}
+
+Aws::GameLift::Internal::ResponseOutcome Aws::GameLift::Internal::GameLiftServerState::SendSocketRequestWithRetries(Message &message) {
+    GAMELIFT_TRACE_SCOPE("GameLift::SendSocketRequestWithRetries");
     spdlog::debug("Trying to send socket message for process: {}...", m_processId);
-    GenericOutcome outcome;
+    ResponseOutcome outcome;
     int resendFailureCount = 0;
     const int maxFailuresBeforeReconnect = 2;
 
@@ -846,17 +977,33 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWi
             resendFailureCount++;
             if (resendFailureCount >= maxFailuresBeforeReconnect) {
                 spdlog::warn("Max sending message failure threshold reached for process: {}. Attempting to reconnect...", m_processId);
+                GAMELIFT_TRACE_SCOPE("GameLift::Reconnect");
+                TraceCounterAdd(TraceCounter::RECONNECTS, 1);
                 m_webSocketClientWrapper->Disconnect();
 
                 spdlog::info("Attempting to create a new WebSocket connections for process: {}...", m_processId);
-                // Create a completely new webSocketClientWrapper
-                std::shared_ptr<Internal::WebSocketppClientType> wsClientPointer = std::make_shared<Internal::WebSocketppClientType>();
-                m_webSocketClientWrapper = std::make_shared<Internal::WebSocketppClientWrapper>(wsClientPointer);
+                // Create a new webSocketClientWrapper. It keeps the client, socket threads and TLS context of
+                // the previous one, which logical server processes share with the process-wide connection.
+                std::shared_ptr<Internal::WebSocketppClientWrapper> previousWrapper =
+                    std::dynamic_pointer_cast<Internal::WebSocketppClientWrapper>(m_webSocketClientWrapper);
+                if (previousWrapper && previousWrapper->GetClientContext()) {
+                    m_webSocketClientWrapper = std::make_shared<Internal::WebSocketppClientWrapper>(previousWrapper->GetClientContext());
+                } else {
+                    std::shared_ptr<Internal::WebSocketppClientType> wsClientPointer = std::make_shared<Internal::WebSocketppClientType>();
+                    m_webSocketClientWrapper = std::make_shared<Internal::WebSocketppClientWrapper>(wsClientPointer);
+                }
 
                 spdlog::info("Re-establish Networking...");
                 // Re-establish network with new webSocketClientWrapper
                 Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks();
-                auto networkOutcome = m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
+                std::string connectionEndpoint;
+                std::string authToken;
+                {
+                    const GameLiftServerStateStore::Reader state = m_state.Get();
+                    connectionEndpoint = state->connectionEndpoint;
+                    authToken = state->authToken;
+                }
+                auto networkOutcome = m_webSocketClientManager->Connect(connectionEndpoint, authToken, m_processId, m_hostId, m_fleetId);
                 if (networkOutcome.IsSuccess()) {
                     spdlog::info("Reconnected successfully. Retrying message sending...");
                     resendFailureCount = 0;
@@ -882,17 +1029,12 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWi
 
     if (resendFailureCount > 0 && !outcome.IsSuccess()) {
         spdlog::error("Error sending socket message");
-        outcome = GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE);
+        outcome = ResponseOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
     }
 
     return outcome;
 }
 
-#if defined(__GNUC__) || defined(__clang__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdelete-non-abstract-non-virtual-dtor"
-#endif
-
 DescribePlayerSessionsOutcome
 Aws::GameLift::Internal::GameLiftServerState::DescribePlayerSessions(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest) {
     if (AssertNetworkInitialized()) {
@@ -900,16 +1042,15 @@ Aws::GameLift::Internal::GameLiftServerState::DescribePlayerSessions(const Aws::
     }
 
     Aws::GameLift::Internal::WebSocketDescribePlayerSessionsRequest request = Aws::GameLift::Internal::DescribePlayerSessionsAdapter::convert(describePlayerSessionsRequest);
-    GenericOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-    if (rawResponse.IsSuccess()) {
-        WebSocketDescribePlayerSessionsResponse *webSocketResponse = static_cast<WebSocketDescribePlayerSessionsResponse *>(rawResponse.GetResult());
-        DescribePlayerSessionsResult result = Aws::GameLift::Internal::DescribePlayerSessionsAdapter::convert(webSocketResponse);
-        delete webSocketResponse;
-
-        return DescribePlayerSessionsOutcome(result);
-    } else {
+    ResponseOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketRequestWithRetries(request);
+    if (!rawResponse.IsSuccess()) {
         return DescribePlayerSessionsOutcome(rawResponse.GetError());
     }
+    const WebSocketDescribePlayerSessionsResponse *webSocketResponse = rawResponse.GetResult().Get<WebSocketDescribePlayerSessionsResponse>();
+    if (webSocketResponse == nullptr) {
+        return DescribePlayerSessionsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
+    }
+    return DescribePlayerSessionsOutcome(Aws::GameLift::Internal::DescribePlayerSessionsAdapter::convert(webSocketResponse));
 }
 
 StartMatchBackfillOutcome
@@ -930,17 +1071,17 @@ Aws::GameLift::Internal::GameLiftServerState::StartMatchBackfill(const Aws::Game
     }
 #endif
 
-    Aws::GameLift::Internal::WebSocketStartMatchBackfillRequest request = Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(startMatchBackfillRequest);
-    GenericOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-    if (rawResponse.IsSuccess()) {
-        WebSocketStartMatchBackfillResponse *webSocketResponse = static_cast<WebSocketStartMatchBackfillResponse *>(rawResponse.GetResult());
-        StartMatchBackfillResult result = Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(webSocketResponse);
-        delete webSocketResponse;
-
-        return StartMatchBackfillOutcome(result);
-    } else {
+    // Streams the players straight into the message JSON; large lobbies are not copied first.
+    Aws::GameLift::Internal::WebSocketStartMatchBackfillStreamingRequest request(startMatchBackfillRequest);
+    ResponseOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketRequestWithRetries(request);
+    if (!rawResponse.IsSuccess()) {
         return StartMatchBackfillOutcome(rawResponse.GetError());
     }
+    const WebSocketStartMatchBackfillResponse *webSocketResponse = rawResponse.GetResult().Get<WebSocketStartMatchBackfillResponse>();
+    if (webSocketResponse == nullptr) {
+        return StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
+    }
+    return StartMatchBackfillOutcome(Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(webSocketResponse));
 }
 
 GenericOutcome Aws::GameLift::Internal::GameLiftServerState::StopMatchBackfill(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &stopMatchBackfillRequest) {
@@ -965,24 +1106,20 @@ GetComputeCertificateOutcome Aws::GameLift::Internal::GameLiftServerState::GetCo
     }
 
     WebSocketGetComputeCertificateRequest request;
-    GenericOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-    if (rawResponse.IsSuccess()) {
-        WebSocketGetComputeCertificateResponse *webSocketResponse = static_cast<WebSocketGetComputeCertificateResponse *>(rawResponse.GetResult());
-        GetComputeCertificateResult result = GetComputeCertificateResult()
-                                                 .WithCertificatePath(webSocketResponse->GetCertificatePath().c_str())
-                                                 .WithComputeName(webSocketResponse->GetComputeName().c_str());
-        delete webSocketResponse;
-
-        return GetComputeCertificateOutcome(result);
-    } else {
+    ResponseOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketRequestWithRetries(request);
+    if (!rawResponse.IsSuccess()) {
         return GetComputeCertificateOutcome(rawResponse.GetError());
     }
+    const WebSocketGetComputeCertificateResponse *webSocketResponse = rawResponse.GetResult().Get<WebSocketGetComputeCertificateResponse>();
+    if (webSocketResponse == nullptr) {
+        return GetComputeCertificateOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
+    }
+    GetComputeCertificateResult result = GetComputeCertificateResult()
+                                             .WithCertificatePath(webSocketResponse->GetCertificatePath().c_str())
+                                             .WithComputeName(webSocketResponse->GetComputeName().c_str());
+    return GetComputeCertificateOutcome(result);
 }
 
-#if defined(__GNUC__) || defined(__clang__)
-#pragma GCC diagnostic pop
-#endif
-
 GetFleetRoleCredentialsOutcome
 Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request) {
     if (AssertNetworkInitialized()) {
@@ -1033,13 +1170,15 @@ Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws:
             "GetFleetRoleCredentials failed; the role session name is too long. Please check role arn or session name and try again."));
     }
 
-    auto rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(webSocketRequest);
+    ResponseOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketRequestWithRetries(webSocketRequest);
     if (!rawResponse.IsSuccess()) {
         return GetFleetRoleCredentialsOutcome(rawResponse.GetError());
     }
 
-    std::unique_ptr<WebSocketGetFleetRoleCredentialsResponse> webSocketResponse(
-        static_cast<WebSocketGetFleetRoleCredentialsResponse *>(rawResponse.GetResult()));
+    const WebSocketGetFleetRoleCredentialsResponse *webSocketResponse = rawResponse.GetResult().Get<WebSocketGetFleetRoleCredentialsResponse>();
+    if (webSocketResponse == nullptr) {
+        return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
+    }
 
     // If we get a success response from APIGW with empty fields we're not on managed EC2 or managed containers.
     if (webSocketResponse->GetAccessKeyId().empty()) {
@@ -1048,7 +1187,7 @@ Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws:
             "Fleet role credentials not available for Anywhere fleet."));
     }
 
-    auto result = Aws::GameLift::Internal::GetFleetRoleCredentialsAdapter::convert(webSocketResponse.get());
+    auto result = Aws::GameLift::Internal::GetFleetRoleCredentialsAdapter::convert(webSocketResponse);
     m_instanceRoleResultCache[webSocketRequest.GetRoleArn()] = result;
     return GetFleetRoleCredentialsOutcome(result);
 }
@@ -1137,7 +1276,7 @@ void Aws::GameLift::Internal::GameLiftServerState::HealthCheck() {
     // Seed the random number generator used to generate healthCheck interval jitters
     std::srand(std::time(0));
 
-    while (m_processReady) {
+    while (m_state.Get()->processReady) {
         std::ignore = std::async(std::launch::async, &Internal::GameLiftServerState::ReportHealth, this);
         std::chrono::duration<long int, std::ratio<1, 1000>> time = std::chrono::milliseconds(GetNextHealthCheckIntervalMillis());
         std::unique_lock<std::mutex> lock(m_healthCheckMutex);
@@ -1148,6 +1287,23 @@ void Aws::GameLift::Internal::GameLiftServerState::HealthCheck() {
     }
 }
 
+void Aws::GameLift::Internal::GameLiftServerState::StopHealthCheckThread() {
+    if (m_healthCheckThread && m_healthCheckThread->joinable()) {
+        {
+            std::unique_lock<std::mutex> lock(m_healthCheckMutex);
+            m_healthCheckInterrupted = true;
+            // "Interrupts" the thread's sleep and causes it to evaluate its "wait_for" predicate.
+            // Since "m_healthCheckInterrupted = true" now the predicate will evaluate to "true" and
+            // the thread will continue without waiting the full ~60 second interval.
+            m_healthCheckConditionVariable.notify_all();
+        }
+        m_healthCheckThread->join();
+    }
+    m_healthCheckThread = nullptr;
+    std::unique_lock<std::mutex> lock(m_healthCheckMutex);
+    m_healthCheckInterrupted = false;
+}
+
 int Aws::GameLift::Internal::GameLiftServerState::GetNextHealthCheckIntervalMillis() {
     // Jitter the healthCheck interval +/- a random value between [-MAX_JITTER_SECONDS,
     // MAX_JITTER_SECONDS]
@@ -0,0 +1,80 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/GameLiftServerStateStore.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+GameLiftServerStateStore::GameLiftServerStateStore() : m_readers(0), m_nextSubscriptionId(1) {
+    m_snapshots.emplace_back(new GameLiftServerStateSnapshot());
+    m_current.store(m_snapshots.back().get(), std::memory_order_release);
+}
+
+GameLiftServerStateStore::~GameLiftServerStateStore() = default;
+
+bool GameLiftServerStateStore::Update(const Change &change) {
+    std::lock_guard<std::mutex> lock(m_updateLock);
+    const GameLiftServerStateSnapshot &previous = *m_current.load(std::memory_order_relaxed);
+    std::unique_ptr<GameLiftServerStateSnapshot> next(new GameLiftServerStateSnapshot(previous));
+    if (!change(*next)) {
+        return false;
+    }
+    next->version = previous.version + 1;
+    if (next->gameSessionId != previous.gameSessionId) {
+        next->gameSessionIdCStr = InternGameSessionId(next->gameSessionId);
+    }
+    m_current.store(next.get(), std::memory_order_seq_cst);
+    const GameLiftServerStateSnapshot &current = *next;
+    // The current snapshot goes first; previous is now the newest retired one.
+    m_snapshots.insert(m_snapshots.begin(), std::move(next));
+
+    for (const auto &listener : m_listeners) {
+        listener.second(previous, current);
+    }
+
+    // A reader opened after the store above loads the new snapshot, so with no reader counted
+    // none can hold a retired one. Otherwise they are freed by a later update.
+    if (m_readers.load(std::memory_order_seq_cst) == 0) {
+        m_snapshots.resize(1);
+    }
+    return true;
+}
+
+const char *GameLiftServerStateStore::InternGameSessionId(const std::string &gameSessionId) {
+    if (gameSessionId.empty()) {
+        return "";
+    }
+    return m_gameSessionIds.insert(gameSessionId).first->c_str();
+}
+
+int GameLiftServerStateStore::Subscribe(const Listener &listener) {
+    std::lock_guard<std::mutex> lock(m_updateLock);
+    const int subscriptionId = m_nextSubscriptionId++;
+    m_listeners.emplace_back(subscriptionId, listener);
+    return subscriptionId;
+}
+
+void GameLiftServerStateStore::Unsubscribe(int subscriptionId) {
+    std::lock_guard<std::mutex> lock(m_updateLock);
+    for (auto listener = m_listeners.begin(); listener != m_listeners.end(); ++listener) {
+        if (listener->first == subscriptionId) {
+            m_listeners.erase(listener);
+            return;
+        }
+    }
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
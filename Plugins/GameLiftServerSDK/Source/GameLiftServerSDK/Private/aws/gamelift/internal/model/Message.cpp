@@ -11,13 +11,173 @@
  */
 
 #include <aws/gamelift/internal/model/Message.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
-#include <aws/gamelift/internal/util/RandomStringGenerator.h>
+#include <rapidjson/reader.h>
+#include <string.h>
+#include <vector>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+namespace {
+// Tracks which fields were assigned during one deserialization, by position in the table chain.
+// Fields past the 64th are not tracked and take the last occurrence of a duplicated member.
+class AssignedFields {
+public:
+    AssignedFields() : m_bits(0) {}
+
+    // Returns false if the field at index was already assigned.
+    bool Claim(size_t index) {
+        if (index >= 64) {
+            return true;
+        }
+        const uint64_t bit = static_cast<uint64_t>(1) << index;
+        if ((m_bits & bit) != 0) {
+            return false;
+        }
+        m_bits |= bit;
+        return true;
+    }
+
+private:
+    uint64_t m_bits;
+};
+
+void WriteFields(const MessageFieldTable &table, const Message &message, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+    if (table.base != nullptr) {
+        WriteFields(*table.base, message, writer);
+    }
+    for (const MessageField *field = table.fields; field != table.fields + table.count; ++field) {
+        field->write(message, field->name, writer);
+    }
+}
+
+void ResetFields(const MessageFieldTable &table, Message &message) {
+    for (const MessageFieldTable *level = &table; level != nullptr; level = level->base) {
+        for (const MessageField *field = level->fields; field != level->fields + level->count; ++field) {
+            field->read(message, nullptr);
+        }
+    }
+}
+
+bool HasOnlyScalarFields(const MessageFieldTable &table) {
+    for (const MessageFieldTable *level = &table; level != nullptr; level = level->base) {
+        for (const MessageField *field = level->fields; field != level->fields + level->count; ++field) {
+            if (!field->scalar) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Returns the field named name if it has not been assigned yet, else nullptr.
+const MessageField *ClaimField(const MessageFieldTable &table, const char *name, rapidjson::SizeType nameLength, AssignedFields &assigned) {
+    size_t index = 0;
+    for (const MessageFieldTable *level = &table; level != nullptr; level = level->base) {
+        for (const MessageField *field = level->fields; field != level->fields + level->count; ++field, ++index) {
+            if (field->nameLength == nameLength && memcmp(field->name, name, nameLength) == 0) {
+                return assigned.Claim(index) ? field : nullptr;
+            }
+        }
+    }
+    return nullptr;
+}
+
+// Counts the fields of a table chain.
+size_t CountFields(const MessageFieldTable &table) {
+    size_t count = 0;
+    for (const MessageFieldTable *level = &table; level != nullptr; level = level->base) {
+        count += level->count;
+    }
+    return count;
+}
+
+// SAX handler collecting the scalar fields of a message while the JSON is parsed in place. Each
+// scalar is kept as a non-owning rapidjson::Value, so the field codecs see exactly what a document
+// would hold, and is only applied once the whole input parsed successfully.
+class MessageFieldReader : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, MessageFieldReader> {
+public:
+    explicit MessageFieldReader(const MessageFieldTable &table) : m_table(table), m_depth(0), m_field(nullptr) { m_values.reserve(CountFields(table)); }
+
+    bool Null() { return Scalar(rapidjson::Value()); }
+    bool Bool(bool value) { return Scalar(rapidjson::Value(value)); }
+    bool Int(int value) { return Scalar(rapidjson::Value(value)); }
+    bool Uint(unsigned value) { return Scalar(rapidjson::Value(value)); }
+    bool Int64(int64_t value) { return Scalar(rapidjson::Value(value)); }
+    bool Uint64(uint64_t value) { return Scalar(rapidjson::Value(value)); }
+    bool Double(double value) { return Scalar(rapidjson::Value(value)); }
+    bool String(const char *value, rapidjson::SizeType length, bool) { return Scalar(rapidjson::Value(rapidjson::StringRef(value, length))); }
+
+    bool StartObject() { return Enter(); }
+
+    bool Key(const char *name, rapidjson::SizeType length, bool) {
+        if (m_depth == 1) {
+            m_field = ClaimField(m_table, name, length, m_assigned);
+        }
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType) { return Leave(); }
+
+    // The root must be an object.
+    bool StartArray() { return m_depth > 0 && Enter(); }
+
+    bool EndArray(rapidjson::SizeType) { return Leave(); }
+
+    void Apply(Message &message) {
+        ResetFields(m_table, message);
+        for (FieldValue &fieldValue : m_values) {
+            fieldValue.field->read(message, &fieldValue.value);
+        }
+    }
+
+private:
+    struct FieldValue {
+        const MessageField *field;
+        rapidjson::Value value;
+    };
+
+    bool Scalar(rapidjson::Value &&value) {
+        if (m_depth == 0) {
+            return false;
+        }
+        if (m_depth == 1 && m_field != nullptr) {
+            m_values.push_back(FieldValue{m_field, std::move(value)});
+        }
+        m_field = nullptr;
+        return true;
+    }
+
+    // A nested object or array as a field value has the wrong type; the field keeps its default.
+    bool Enter() {
+        m_depth++;
+        m_field = nullptr;
+        return true;
+    }
+
+    bool Leave() {
+        m_depth--;
+        return true;
+    }
+
+    const MessageFieldTable &m_table;
+    int m_depth;
+    const MessageField *m_field;
+    AssignedFields m_assigned;
+    std::vector<FieldValue> m_values;
+};
+} // namespace
+
+const MessageField Message::FIELDS[] = {
+    MessageFields::String<Message, &Message::m_action>(ACTION),
+    MessageFields::Field<Message, RequestIdFieldCodec, &Message::m_requestId>(REQUEST_ID),
+};
+
+const MessageFieldTable Message::FIELD_TABLE = MessageFields::Table(FIELDS, nullptr);
+
+const MessageFieldTable &Message::GetFieldTable() const { return FIELD_TABLE; }
+
 std::string Message::Serialize() const {
     // Create the buffer & Writer for the object
     rapidjson::StringBuffer buffer;
@@ -33,6 +193,20 @@ std::string Message::Serialize() const {
 }
 
 bool Message::Deserialize(const std::string &jsonString) {
+    const MessageFieldTable &table = GetFieldTable();
+    if (HasOnlyScalarFields(table)) {
+        // Parsing in place lets the collected strings point into the copy instead of being copied again.
+        std::vector<char> json(jsonString.c_str(), jsonString.c_str() + strlen(jsonString.c_str()) + 1);
+        rapidjson::InsituStringStream stream(json.data());
+        MessageFieldReader handler(table);
+        rapidjson::Reader reader;
+        if (reader.Parse<rapidjson::kParseInsituFlag>(stream, handler).IsError()) {
+            return false;
+        }
+        handler.Apply(*this);
+        return true;
+    }
+
     // Parse the json into a document
     rapidjson::Document doc;
     if (doc.Parse(jsonString.c_str()).HasParseError()) {
@@ -44,14 +218,24 @@ bool Message::Deserialize(const std::string &jsonString) {
 }
 
 bool Message::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    JsonHelper::WriteNonEmptyString(writer, ACTION, m_action);
-    JsonHelper::WriteNonEmptyString(writer, REQUEST_ID, m_requestId);
+    WriteFields(GetFieldTable(), *this, writer);
     return true;
 }
 
 bool Message::Deserialize(const rapidjson::Value &value) {
-    m_action = JsonHelper::SafelyDeserializeString(value, ACTION);
-    m_requestId = JsonHelper::SafelyDeserializeString(value, REQUEST_ID);
+    if (!value.IsObject()) {
+        return false;
+    }
+
+    const MessageFieldTable &table = GetFieldTable();
+    ResetFields(table, *this);
+    AssignedFields assigned;
+    for (auto member = value.MemberBegin(); member != value.MemberEnd(); ++member) {
+        const MessageField *field = ClaimField(table, member->name.GetString(), member->name.GetStringLength(), assigned);
+        if (field != nullptr) {
+            field->read(*this, &member->value);
+        }
+    }
     return true;
 }
 
@@ -60,8 +244,6 @@ std::ostream &operator<<(std::ostream &os, const Message &message) {
     return os;
 }
 
-std::string Message::GenerateRandomRequestId() { return RandomStringGenerator::GenerateRandomAlphaNumericString(32); }
-
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
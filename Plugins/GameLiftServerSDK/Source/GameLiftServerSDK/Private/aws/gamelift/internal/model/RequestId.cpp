@@ -0,0 +1,122 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/model/RequestId.h>
+#include <aws/gamelift/internal/util/RandomStringGenerator.h>
+#include <atomic>
+#include <string.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+const char BASE62_DIGITS[] = "0123456789"
+                             "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                             "abcdefghijklmnopqrstuvwxyz";
+constexpr uint64_t BASE = 62;
+// 62^11 > 2^64, so every sequence number fits.
+constexpr size_t VALUE_LENGTH = 11;
+constexpr size_t PREFIX_LENGTH = RequestId::WIRE_LENGTH - VALUE_LENGTH;
+
+struct ProcessPrefix {
+    ProcessPrefix() { RandomStringGenerator::GenerateRandomAlphaNumeric(characters, PREFIX_LENGTH); }
+
+    char characters[PREFIX_LENGTH];
+};
+
+const ProcessPrefix &GetProcessPrefix() {
+    static const ProcessPrefix prefix;
+    return prefix;
+}
+
+std::atomic<uint64_t> nextValue(1);
+
+int DigitValue(char digit) {
+    if (digit >= '0' && digit <= '9') {
+        return digit - '0';
+    }
+    if (digit >= 'A' && digit <= 'Z') {
+        return digit - 'A' + 10;
+    }
+    if (digit >= 'a' && digit <= 'z') {
+        return digit - 'a' + 36;
+    }
+    return -1;
+}
+
+void FormatValue(uint64_t value, char (&buffer)[RequestId::WIRE_LENGTH + 1]) {
+    memcpy(buffer, GetProcessPrefix().characters, PREFIX_LENGTH);
+    for (size_t i = RequestId::WIRE_LENGTH; i > PREFIX_LENGTH; i--) {
+        buffer[i - 1] = BASE62_DIGITS[value % BASE];
+        value /= BASE;
+    }
+    buffer[RequestId::WIRE_LENGTH] = '\0';
+}
+
+// Returns 0 unless requestId is the wire form of an ID created by this process.
+uint64_t ParseValue(const char *requestId, size_t length) {
+    if (length != RequestId::WIRE_LENGTH || memcmp(requestId, GetProcessPrefix().characters, PREFIX_LENGTH) != 0) {
+        return 0;
+    }
+    uint64_t value = 0;
+    for (size_t i = PREFIX_LENGTH; i < RequestId::WIRE_LENGTH; i++) {
+        const int digit = DigitValue(requestId[i]);
+        if (digit < 0 || value > (UINT64_MAX - digit) / BASE) {
+            return 0;
+        }
+        value = value * BASE + digit;
+    }
+    return value;
+}
+} // namespace
+
+RequestId RequestId::Next() {
+    RequestId requestId;
+    requestId.m_value = nextValue.fetch_add(1, std::memory_order_relaxed);
+    return requestId;
+}
+
+RequestId RequestId::FromString(const char *requestId, size_t length) {
+    RequestId result;
+    if (length == 0) {
+        return result;
+    }
+    result.m_value = ParseValue(requestId, length);
+    if (result.m_value == 0) {
+        result.m_foreign.assign(requestId, length);
+    }
+    return result;
+}
+
+bool RequestId::Format(char (&buffer)[WIRE_LENGTH + 1]) const {
+    if (m_value == 0) {
+        return false;
+    }
+    FormatValue(m_value, buffer);
+    return true;
+}
+
+std::string RequestId::ToString() const { return m_value == 0 ? m_foreign : ToString(m_value); }
+
+std::string RequestId::ToString(uint64_t value) {
+    if (value == 0) {
+        return std::string();
+    }
+    char buffer[WIRE_LENGTH + 1];
+    FormatValue(value, buffer);
+    return std::string(buffer, WIRE_LENGTH);
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -11,24 +11,18 @@
  */
 
 #include <aws/gamelift/internal/model/ResponseMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool ResponseMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WritePositiveInt(writer, STATUS_CODE, m_statusCode);
-    JsonHelper::WriteNonEmptyString(writer, ERROR_MESSAGE, m_errorMessage);
-    return true;
-}
+const MessageField ResponseMessage::FIELDS[] = {
+    MessageFields::PositiveInt<ResponseMessage, &ResponseMessage::m_statusCode>(STATUS_CODE),
+    MessageFields::String<ResponseMessage, &ResponseMessage::m_errorMessage>(ERROR_MESSAGE),
+};
 
-bool ResponseMessage::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_statusCode = JsonHelper::SafelyDeserializeInt(value, STATUS_CODE);
-    m_errorMessage = JsonHelper::SafelyDeserializeString(value, ERROR_MESSAGE);
-    return true;
-}
+const MessageFieldTable ResponseMessage::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &ResponseMessage::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const ResponseMessage &responseMessage) {
     const Message *message = &responseMessage;
@@ -40,21 +40,22 @@ Server::Model::DescribePlayerSessionsResult DescribePlayerSessionsAdapter::conve
     }
 #else
     result.SetNextToken(webSocketResponse->GetNextToken().c_str());
+    result.ReservePlayerSessions(static_cast<int>(webSocketResponse->GetPlayerSessions().size()));
     for (auto &webSocketPlayerSession : webSocketResponse->GetPlayerSessions()) {
-        Server::Model::PlayerSession playerSession =
-            Server::Model::PlayerSession()
-                .WithPlayerSessionId(webSocketPlayerSession.GetPlayerSessionId().c_str())
-                .WithPlayerId(webSocketPlayerSession.GetPlayerId().c_str())
-                .WithGameSessionId(webSocketPlayerSession.GetGameSessionId().c_str())
-                .WithFleetId(webSocketPlayerSession.GetFleetId().c_str())
-                .WithCreationTime(webSocketPlayerSession.GetCreationTime())
-                .WithTerminationTime(webSocketPlayerSession.GetTerminationTime())
-                .WithStatus(static_cast<Server::Model::PlayerSessionStatus>(static_cast<int>(webSocketPlayerSession.GetStatus())))
-                .WithIpAddress(webSocketPlayerSession.GetIpAddress().c_str())
-                .WithPort(webSocketPlayerSession.GetPort())
-                .WithPlayerData(webSocketPlayerSession.GetPlayerData().c_str())
-                .WithDnsName(webSocketPlayerSession.GetDnsName().c_str());
-        result.AddPlayerSession(playerSession);
+        // Filled in place and moved into the result, so each session's strings are copied exactly once.
+        Server::Model::PlayerSession playerSession;
+        playerSession.WithPlayerSessionId(webSocketPlayerSession.GetPlayerSessionId().c_str())
+            .WithPlayerId(webSocketPlayerSession.GetPlayerId().c_str())
+            .WithGameSessionId(webSocketPlayerSession.GetGameSessionId().c_str())
+            .WithFleetId(webSocketPlayerSession.GetFleetId().c_str())
+            .WithCreationTime(webSocketPlayerSession.GetCreationTime())
+            .WithTerminationTime(webSocketPlayerSession.GetTerminationTime())
+            .WithStatus(static_cast<Server::Model::PlayerSessionStatus>(static_cast<int>(webSocketPlayerSession.GetStatus())))
+            .WithIpAddress(webSocketPlayerSession.GetIpAddress().c_str())
+            .WithPort(webSocketPlayerSession.GetPort())
+            .WithPlayerData(webSocketPlayerSession.GetPlayerData().c_str())
+            .WithDnsName(webSocketPlayerSession.GetDnsName().c_str());
+        result.AddPlayerSession(std::move(playerSession));
     }
 #endif
 
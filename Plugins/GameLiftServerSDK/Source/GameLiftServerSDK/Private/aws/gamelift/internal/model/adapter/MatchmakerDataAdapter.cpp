@@ -0,0 +1,131 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/model/adapter/MatchmakerDataAdapter.h>
+#include <rapidjson/document.h>
+#include <spdlog/spdlog.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+constexpr const char *MATCH_ID = "matchId";
+constexpr const char *MATCHMAKING_CONFIGURATION_ARN = "matchmakingConfigurationArn";
+constexpr const char *AUTO_BACKFILL_MODE = "autoBackfillMode";
+constexpr const char *AUTO_BACKFILL_TICKET_ID = "autoBackfillTicketId";
+constexpr const char *TEAMS = "teams";
+constexpr const char *TEAM_NAME = "name";
+constexpr const char *PLAYERS = "players";
+constexpr const char *PLAYER_ID = "playerId";
+constexpr const char *ATTRIBUTES = "attributes";
+constexpr const char *ATTRIBUTE_TYPE = "attributeType";
+constexpr const char *ATTRIBUTE_VALUE = "valueAttribute";
+
+const char *GetStringOrEmpty(const rapidjson::Value &value, const char *key) {
+    rapidjson::Value::ConstMemberIterator member = value.FindMember(key);
+    return member != value.MemberEnd() && member->value.IsString() ? member->value.GetString() : "";
+}
+
+bool IsArrayMember(const rapidjson::Value &value, const char *key) {
+    rapidjson::Value::ConstMemberIterator member = value.FindMember(key);
+    return member != value.MemberEnd() && member->value.IsArray();
+}
+
+void ConvertAttribute(Server::Model::MatchmakerData &result, const char *name, const rapidjson::Value &attribute) {
+    typedef Server::Model::AttributeValue::AttrType AttrType;
+    if (!attribute.IsObject()) {
+        return;
+    }
+    const std::string type = GetStringOrEmpty(attribute, ATTRIBUTE_TYPE);
+    rapidjson::Value::ConstMemberIterator value = attribute.FindMember(ATTRIBUTE_VALUE);
+    const bool hasValue = value != attribute.MemberEnd();
+
+    if (type == "STRING") {
+        result.AddAttribute(name, AttrType::STRING);
+        result.SetAttributeString(hasValue && value->value.IsString() ? value->value.GetString() : "");
+    } else if (type == "DOUBLE") {
+        result.AddAttribute(name, AttrType::DOUBLE);
+        result.SetAttributeDouble(hasValue && value->value.IsNumber() ? value->value.GetDouble() : 0);
+    } else if (type == "STRING_LIST") {
+        result.AddAttribute(name, AttrType::STRING_LIST);
+        if (hasValue && value->value.IsArray()) {
+            for (const rapidjson::Value &item : value->value.GetArray()) {
+                if (item.IsString()) {
+                    result.AddAttributeEntry(item.GetString(), 0);
+                }
+            }
+        }
+    } else if (type == "STRING_DOUBLE_MAP") {
+        result.AddAttribute(name, AttrType::STRING_DOUBLE_MAP);
+        if (hasValue && value->value.IsObject()) {
+            for (rapidjson::Value::ConstMemberIterator entry = value->value.MemberBegin(); entry != value->value.MemberEnd(); ++entry) {
+                if (entry->value.IsNumber()) {
+                    result.AddAttributeEntry(entry->name.GetString(), entry->value.GetDouble());
+                }
+            }
+        }
+    } else {
+        spdlog::warn("Ignoring matchmaker data attribute {} with unknown type {}", name, type);
+    }
+}
+} // namespace
+
+Server::Model::MatchmakerDataPtr MatchmakerDataAdapter::convert(const std::string &matchmakerData) {
+    if (matchmakerData.empty()) {
+        return Server::Model::MatchmakerDataPtr();
+    }
+
+    rapidjson::Document doc;
+    if (doc.Parse(matchmakerData.c_str()).HasParseError() || !doc.IsObject()) {
+        spdlog::error("MatchmakerData: Parse error found for: {}", matchmakerData);
+        return Server::Model::MatchmakerDataPtr();
+    }
+
+    Server::Model::MatchmakerData *result = new Server::Model::MatchmakerData();
+    result->SetMatchId(GetStringOrEmpty(doc, MATCH_ID));
+    result->SetMatchmakingConfigurationArn(GetStringOrEmpty(doc, MATCHMAKING_CONFIGURATION_ARN));
+    result->SetAutoBackfillMode(GetStringOrEmpty(doc, AUTO_BACKFILL_MODE));
+    result->SetAutoBackfillTicketId(GetStringOrEmpty(doc, AUTO_BACKFILL_TICKET_ID));
+
+    if (IsArrayMember(doc, TEAMS)) {
+        for (const rapidjson::Value &team : doc[TEAMS].GetArray()) {
+            if (!team.IsObject()) {
+                continue;
+            }
+            result->AddTeam(GetStringOrEmpty(team, TEAM_NAME));
+            if (!IsArrayMember(team, PLAYERS)) {
+                continue;
+            }
+            for (const rapidjson::Value &player : team[PLAYERS].GetArray()) {
+                if (!player.IsObject()) {
+                    continue;
+                }
+                result->AddPlayer(GetStringOrEmpty(player, PLAYER_ID));
+                rapidjson::Value::ConstMemberIterator attributes = player.FindMember(ATTRIBUTES);
+                if (attributes == player.MemberEnd() || !attributes->value.IsObject()) {
+                    continue;
+                }
+                for (rapidjson::Value::ConstMemberIterator attribute = attributes->value.MemberBegin(); attribute != attributes->value.MemberEnd();
+                     ++attribute) {
+                    ConvertAttribute(*result, attribute->name.GetString(), attribute->value);
+                }
+            }
+        }
+    }
+
+    return Server::Model::MatchmakerDataPtr(result);
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -11,54 +11,26 @@
  */
 
 #include <aws/gamelift/internal/model/message/CreateGameSessionMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool CreateGameSessionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_NAME, m_gameSessionName);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_DATA, m_gameSessionData);
-    JsonHelper::WriteNonEmptyString(writer, MATCHMAKER_DATA, m_matchmakerData);
-    JsonHelper::WriteNonEmptyString(writer, DNS_NAME, m_dnsName);
-    JsonHelper::WriteNonEmptyString(writer, IP_ADDRESS, m_ipAddress);
-    JsonHelper::WritePositiveInt(writer, MAXIMUM_PLAYER_SESSION_COUNT, m_maximumPlayerSessionCount);
-    JsonHelper::WritePositiveInt(writer, PORT, m_port);
-
-    writer->String(GAME_PROPERTIES);
-    writer->StartObject();
-    for (auto const &property : m_gameProperties) {
-        writer->String(property.first.c_str());
-        writer->String(property.second.c_str());
-    }
-    writer->EndObject();
-    return true;
-}
-
-bool CreateGameSessionMessage::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_gameSessionName = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_NAME);
-    m_gameSessionData = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_DATA);
-    m_matchmakerData = JsonHelper::SafelyDeserializeString(value, MATCHMAKER_DATA);
-    m_dnsName = JsonHelper::SafelyDeserializeString(value, DNS_NAME);
-    m_ipAddress = JsonHelper::SafelyDeserializeString(value, IP_ADDRESS);
-    m_maximumPlayerSessionCount = JsonHelper::SafelyDeserializeInt(value, MAXIMUM_PLAYER_SESSION_COUNT);
-    m_port = JsonHelper::SafelyDeserializeInt(value, PORT);
-
-    if (value.HasMember(GAME_PROPERTIES) && !value[GAME_PROPERTIES].IsNull()) {
-        for (auto itr = value[GAME_PROPERTIES].MemberBegin(); itr != value[GAME_PROPERTIES].MemberEnd(); ++itr) {
-            if (itr->name.IsString() && itr->value.IsString()) {
-                m_gameProperties[itr->name.GetString()] = itr->value.GetString();
-            }
-        }
-    }
-
-    return true;
-}
+const MessageField CreateGameSessionMessage::FIELDS[] = {
+    MessageFields::String<CreateGameSessionMessage, &CreateGameSessionMessage::m_gameSessionId>(GAME_SESSION_ID),
+    MessageFields::String<CreateGameSessionMessage, &CreateGameSessionMessage::m_gameSessionName>(GAME_SESSION_NAME),
+    MessageFields::String<CreateGameSessionMessage, &CreateGameSessionMessage::m_gameSessionData>(GAME_SESSION_DATA),
+    MessageFields::String<CreateGameSessionMessage, &CreateGameSessionMessage::m_matchmakerData>(MATCHMAKER_DATA),
+    MessageFields::String<CreateGameSessionMessage, &CreateGameSessionMessage::m_dnsName>(DNS_NAME),
+    MessageFields::String<CreateGameSessionMessage, &CreateGameSessionMessage::m_ipAddress>(IP_ADDRESS),
+    MessageFields::PositiveInt<CreateGameSessionMessage, &CreateGameSessionMessage::m_maximumPlayerSessionCount>(MAXIMUM_PLAYER_SESSION_COUNT),
+    MessageFields::PositiveInt<CreateGameSessionMessage, &CreateGameSessionMessage::m_port>(PORT),
+    MessageFields::Field<CreateGameSessionMessage, StringMapFieldCodec, &CreateGameSessionMessage::m_gameProperties>(GAME_PROPERTIES),
+};
+
+const MessageFieldTable CreateGameSessionMessage::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &CreateGameSessionMessage::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const CreateGameSessionMessage &createGameSessionMessage) {
     const Message *message = &createGameSessionMessage;
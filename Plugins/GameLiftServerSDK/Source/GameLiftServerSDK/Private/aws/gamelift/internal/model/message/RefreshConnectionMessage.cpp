@@ -11,24 +11,18 @@
  */
 
 #include <aws/gamelift/internal/model/message/RefreshConnectionMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool RefreshConnectionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, REFRESH_CONNECTION_ENDPOINT, m_refreshConnectionEndpoint);
-    JsonHelper::WriteNonEmptyString(writer, AUTH_TOKEN, m_authToken);
-    return true;
-}
+const MessageField RefreshConnectionMessage::FIELDS[] = {
+    MessageFields::String<RefreshConnectionMessage, &RefreshConnectionMessage::m_refreshConnectionEndpoint>(REFRESH_CONNECTION_ENDPOINT),
+    MessageFields::String<RefreshConnectionMessage, &RefreshConnectionMessage::m_authToken>(AUTH_TOKEN),
+};
 
-bool RefreshConnectionMessage::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_refreshConnectionEndpoint = JsonHelper::SafelyDeserializeString(value, REFRESH_CONNECTION_ENDPOINT);
-    m_authToken = JsonHelper::SafelyDeserializeString(value, AUTH_TOKEN);
-    return true;
-}
+const MessageFieldTable RefreshConnectionMessage::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &RefreshConnectionMessage::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const RefreshConnectionMessage &refreshConnectionMessage) {
     const Message *message = &refreshConnectionMessage;
@@ -11,23 +11,18 @@
  */
 
 #include <aws/gamelift/internal/model/message/TerminateProcessMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool TerminateProcessMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WritePositiveInt64(writer, TERMINATION_TIME, m_terminationTime);
-    return true;
-}
+const MessageField TerminateProcessMessage::FIELDS[] = {
+    MessageFields::PositiveInt64<TerminateProcessMessage, &TerminateProcessMessage::m_terminationTime>(TERMINATION_TIME),
+};
 
-bool TerminateProcessMessage::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_terminationTime = JsonHelper::SafelyDeserializeInt64(value, TERMINATION_TIME);
-    return true;
-}
+const MessageFieldTable TerminateProcessMessage::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &TerminateProcessMessage::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const TerminateProcessMessage &terminateProcessMessage) {
     const Message *message = &terminateProcessMessage;
@@ -11,40 +11,20 @@
  */
 
 #include <aws/gamelift/internal/model/message/UpdateGameSessionMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool UpdateGameSessionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    // Serialize game session object
-    writer->String(GAME_SESSION);
-    writer->StartObject();
-    m_gameSession.Serialize(writer);
-    writer->EndObject();
-    // Serialize update game session fields
-    JsonHelper::WriteNonEmptyString(writer, UPDATE_REASON, m_updateReason);
-    JsonHelper::WriteNonEmptyString(writer, BACKFILL_TICKET_ID, m_backfillTicketId);
+const MessageField UpdateGameSessionMessage::FIELDS[] = {
+    MessageFields::Field<UpdateGameSessionMessage, ObjectFieldCodec<WebSocketGameSession>, &UpdateGameSessionMessage::m_gameSession>(GAME_SESSION),
+    MessageFields::String<UpdateGameSessionMessage, &UpdateGameSessionMessage::m_updateReason>(UPDATE_REASON),
+    MessageFields::String<UpdateGameSessionMessage, &UpdateGameSessionMessage::m_backfillTicketId>(BACKFILL_TICKET_ID),
+};
 
-    return true;
-}
-
-bool UpdateGameSessionMessage::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    // Deserialize GameSession
-    WebSocketGameSession gameSession;
-    if (value.HasMember(GAME_SESSION) && !value[GAME_SESSION].IsNull()) {
-        gameSession.Deserialize(value[GAME_SESSION]);
-    }
-    m_gameSession = gameSession;
-    // Deserialize rest of fields
-    m_updateReason = JsonHelper::SafelyDeserializeString(value, UPDATE_REASON);
-    m_backfillTicketId = JsonHelper::SafelyDeserializeString(value, BACKFILL_TICKET_ID);
+const MessageFieldTable UpdateGameSessionMessage::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
 
-    return true;
-}
+const MessageFieldTable &UpdateGameSessionMessage::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const UpdateGameSessionMessage &updateGameSessionMessage) {
     const Message *message = &updateGameSessionMessage;
@@ -11,24 +11,18 @@
  */
 
 #include <aws/gamelift/internal/model/request/AcceptPlayerSessionRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool AcceptPlayerSessionRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_ID, m_playerSessionId);
-    return true;
-}
+const MessageField AcceptPlayerSessionRequest::FIELDS[] = {
+    MessageFields::String<AcceptPlayerSessionRequest, &AcceptPlayerSessionRequest::m_gameSessionId>(GAME_SESSION_ID),
+    MessageFields::String<AcceptPlayerSessionRequest, &AcceptPlayerSessionRequest::m_playerSessionId>(PLAYER_SESSION_ID),
+};
 
-bool AcceptPlayerSessionRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_playerSessionId = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_ID);
-    return true;
-}
+const MessageFieldTable AcceptPlayerSessionRequest::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &AcceptPlayerSessionRequest::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const AcceptPlayerSessionRequest &acceptPlayerSessionRequest) {
     const Message *message = &acceptPlayerSessionRequest;
@@ -11,7 +11,6 @@
  */
 
 #include <aws/gamelift/internal/model/request/ActivateGameSessionRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
@@ -21,17 +20,13 @@ ActivateGameSessionRequest::ActivateGameSessionRequest() { SetAction(ACTIVATE_GA
 
 ActivateGameSessionRequest::ActivateGameSessionRequest(std::string gameSessionId) : m_gameSessionId(gameSessionId) { SetAction(ACTIVATE_GAME_SESSION); }
 
-bool ActivateGameSessionRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    return true;
-}
+const MessageField ActivateGameSessionRequest::FIELDS[] = {
+    MessageFields::String<ActivateGameSessionRequest, &ActivateGameSessionRequest::m_gameSessionId>(GAME_SESSION_ID),
+};
 
-bool ActivateGameSessionRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    return true;
-}
+const MessageFieldTable ActivateGameSessionRequest::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &ActivateGameSessionRequest::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const ActivateGameSessionRequest &activateGameSessionRequest) {
     const Message *message = &activateGameSessionRequest;
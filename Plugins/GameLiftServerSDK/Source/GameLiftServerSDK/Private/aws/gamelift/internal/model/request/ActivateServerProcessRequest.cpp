@@ -11,7 +11,6 @@
  */
 
 #include <aws/gamelift/internal/model/request/ActivateServerProcessRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
@@ -26,27 +25,18 @@ ActivateServerProcessRequest::ActivateServerProcessRequest(std::string sdkVersio
     SetAction(ACTIVATE_SERVER_PROCESS);
 };
 
-bool ActivateServerProcessRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, SDK_VERSION, m_sdkVersion);
-    JsonHelper::WriteNonEmptyString(writer, SDK_LANGUAGE, m_sdkLanguage);
-    JsonHelper::WriteNonEmptyString(writer, SDK_TOOL_NAME, m_sdkToolName);
-    JsonHelper::WriteNonEmptyString(writer, SDK_TOOL_VERSION, m_sdkToolVersion);
-    JsonHelper::WritePositiveInt(writer, PORT, m_port);
-    JsonHelper::WriteLogParameters(writer, LOG_PATHS, m_logParameters);
-    return true;
-}
+const MessageField ActivateServerProcessRequest::FIELDS[] = {
+    MessageFields::String<ActivateServerProcessRequest, &ActivateServerProcessRequest::m_sdkVersion>(SDK_VERSION),
+    MessageFields::String<ActivateServerProcessRequest, &ActivateServerProcessRequest::m_sdkLanguage>(SDK_LANGUAGE),
+    MessageFields::String<ActivateServerProcessRequest, &ActivateServerProcessRequest::m_sdkToolName>(SDK_TOOL_NAME),
+    MessageFields::String<ActivateServerProcessRequest, &ActivateServerProcessRequest::m_sdkToolVersion>(SDK_TOOL_VERSION),
+    MessageFields::PositiveInt<ActivateServerProcessRequest, &ActivateServerProcessRequest::m_port>(PORT),
+    MessageFields::Field<ActivateServerProcessRequest, LogParametersFieldCodec, &ActivateServerProcessRequest::m_logParameters>(LOG_PATHS),
+};
 
-bool ActivateServerProcessRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_sdkVersion = JsonHelper::SafelyDeserializeString(value, SDK_VERSION);
-    m_sdkLanguage = JsonHelper::SafelyDeserializeString(value, SDK_LANGUAGE);
-    m_sdkToolName = JsonHelper::SafelyDeserializeString(value, SDK_TOOL_NAME);
-    m_sdkToolVersion = JsonHelper::SafelyDeserializeString(value, SDK_TOOL_VERSION);
-    m_port = JsonHelper::SafelyDeserializeInt(value, PORT);
-    m_logParameters = JsonHelper::SafelyDeserializeLogParameters(value, LOG_PATHS);
-    return true;
-}
+const MessageFieldTable ActivateServerProcessRequest::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &ActivateServerProcessRequest::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const ActivateServerProcessRequest &activateServerProcessRequest) {
     const Message *message = &activateServerProcessRequest;
@@ -16,18 +16,13 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool HeartbeatServerProcessRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    writer->String(HEALTH_STATUS);
-    writer->Bool(m_healthy);
-    return true;
-}
+const MessageField HeartbeatServerProcessRequest::FIELDS[] = {
+    MessageFields::Bool<HeartbeatServerProcessRequest, &HeartbeatServerProcessRequest::m_healthy>(HEALTH_STATUS),
+};
 
-bool HeartbeatServerProcessRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_healthy = value.HasMember(HEALTH_STATUS) && value[HEALTH_STATUS].IsBool() ? value[HEALTH_STATUS].GetBool() : false;
-    return true;
-}
+const MessageFieldTable HeartbeatServerProcessRequest::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &HeartbeatServerProcessRequest::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const HeartbeatServerProcessRequest &heartbeatServerProcessRequest) {
     const Message *message = &heartbeatServerProcessRequest;
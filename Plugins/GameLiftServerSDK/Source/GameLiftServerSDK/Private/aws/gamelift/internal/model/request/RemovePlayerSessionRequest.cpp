@@ -11,24 +11,18 @@
  */
 
 #include <aws/gamelift/internal/model/request/RemovePlayerSessionRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool RemovePlayerSessionRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_ID, m_playerSessionId);
-    return true;
-}
+const MessageField RemovePlayerSessionRequest::FIELDS[] = {
+    MessageFields::String<RemovePlayerSessionRequest, &RemovePlayerSessionRequest::m_gameSessionId>(GAME_SESSION_ID),
+    MessageFields::String<RemovePlayerSessionRequest, &RemovePlayerSessionRequest::m_playerSessionId>(PLAYER_SESSION_ID),
+};
 
-bool RemovePlayerSessionRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_playerSessionId = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_ID);
-    return true;
-}
+const MessageFieldTable RemovePlayerSessionRequest::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &RemovePlayerSessionRequest::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const RemovePlayerSessionRequest &removePlayerSessionRequest) {
     const Message *message = &removePlayerSessionRequest;
@@ -11,27 +11,30 @@
  */
 
 #include <aws/gamelift/internal/model/request/UpdatePlayerSessionCreationPolicyRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool UpdatePlayerSessionCreationPolicyRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_POLICY, GetPlayerSessionCreationPolicyAsString());
-    return true;
+void UpdatePlayerSessionCreationPolicyRequest::PlayerSessionCreationPolicyFieldCodec::Write(rapidjson::Writer<rapidjson::StringBuffer> *writer,
+                                                                                          const char *name, const Type &value) {
+    writer->String(name);
+    writer->String(ToString(value));
 }
 
-bool UpdatePlayerSessionCreationPolicyRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    std::string policyAsString = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_POLICY);
-    SetPlayerSessionCreationPolicy(policyAsString);
-    return true;
+void UpdatePlayerSessionCreationPolicyRequest::PlayerSessionCreationPolicyFieldCodec::Read(const rapidjson::Value *value, Type &out) {
+    out = FromString(JsonHelper::DeserializeString(value));
 }
 
+const MessageField UpdatePlayerSessionCreationPolicyRequest::FIELDS[] = {
+    MessageFields::String<UpdatePlayerSessionCreationPolicyRequest, &UpdatePlayerSessionCreationPolicyRequest::m_gameSessionId>(GAME_SESSION_ID),
+    MessageFields::Field<UpdatePlayerSessionCreationPolicyRequest, PlayerSessionCreationPolicyFieldCodec, &UpdatePlayerSessionCreationPolicyRequest::m_playerSessionCreationPolicy>(PLAYER_SESSION_POLICY),
+};
+
+const MessageFieldTable UpdatePlayerSessionCreationPolicyRequest::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &UpdatePlayerSessionCreationPolicyRequest::GetFieldTable() const { return FIELD_TABLE; }
+
 std::ostream &operator<<(std::ostream &os, const UpdatePlayerSessionCreationPolicyRequest &updatePlayerSessionCreationPolicyRequest) {
     const Message *message = &updatePlayerSessionCreationPolicyRequest;
     os << message->Serialize();
@@ -11,36 +11,22 @@
  */
 
 #include <aws/gamelift/internal/model/request/WebSocketDescribePlayerSessionsRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketDescribePlayerSessionsRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_ID, m_playerId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_ID, m_playerSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_STATUS_FILTER, m_playerSessionStatusFilter);
-    JsonHelper::WriteNonEmptyString(writer, NEXT_TOKEN, m_nextToken);
-    JsonHelper::WritePositiveInt(writer, LIMIT, m_limit);
-
-    return true;
-}
-
-bool WebSocketDescribePlayerSessionsRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_playerId = JsonHelper::SafelyDeserializeString(value, PLAYER_ID);
-    m_playerSessionId = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_ID);
-    m_playerSessionStatusFilter = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_STATUS_FILTER);
-    m_nextToken = JsonHelper::SafelyDeserializeString(value, NEXT_TOKEN);
-    m_limit = JsonHelper::SafelyDeserializeInt(value, LIMIT);
-
-    return true;
-}
+const MessageField WebSocketDescribePlayerSessionsRequest::FIELDS[] = {
+    MessageFields::String<WebSocketDescribePlayerSessionsRequest, &WebSocketDescribePlayerSessionsRequest::m_gameSessionId>(GAME_SESSION_ID),
+    MessageFields::String<WebSocketDescribePlayerSessionsRequest, &WebSocketDescribePlayerSessionsRequest::m_playerId>(PLAYER_ID),
+    MessageFields::String<WebSocketDescribePlayerSessionsRequest, &WebSocketDescribePlayerSessionsRequest::m_playerSessionId>(PLAYER_SESSION_ID),
+    MessageFields::String<WebSocketDescribePlayerSessionsRequest, &WebSocketDescribePlayerSessionsRequest::m_playerSessionStatusFilter>(PLAYER_SESSION_STATUS_FILTER),
+    MessageFields::String<WebSocketDescribePlayerSessionsRequest, &WebSocketDescribePlayerSessionsRequest::m_nextToken>(NEXT_TOKEN),
+    MessageFields::PositiveInt<WebSocketDescribePlayerSessionsRequest, &WebSocketDescribePlayerSessionsRequest::m_limit>(LIMIT),
+};
+
+const MessageFieldTable WebSocketDescribePlayerSessionsRequest::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &WebSocketDescribePlayerSessionsRequest::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketDescribePlayerSessionsRequest &describePlayerSessionsRequest) {
     const Message *message = &describePlayerSessionsRequest;
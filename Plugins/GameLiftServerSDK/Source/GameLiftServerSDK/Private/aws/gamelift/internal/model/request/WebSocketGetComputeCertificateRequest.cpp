@@ -15,16 +15,6 @@
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketGetComputeCertificateRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    return true;
-}
-
-bool WebSocketGetComputeCertificateRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    return true;
-}
-
 std::ostream &operator<<(std::ostream &os, const WebSocketGetComputeCertificateRequest &getComputeCertificateRequest) {
     const Message *message = &getComputeCertificateRequest;
     os << message->Serialize();
@@ -11,28 +11,19 @@
  */
 
 #include <aws/gamelift/internal/model/request/WebSocketGetFleetRoleCredentialsRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketGetFleetRoleCredentialsRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
+const MessageField WebSocketGetFleetRoleCredentialsRequest::FIELDS[] = {
+    MessageFields::String<WebSocketGetFleetRoleCredentialsRequest, &WebSocketGetFleetRoleCredentialsRequest::m_roleArn>(ROLE_ARN),
+    MessageFields::String<WebSocketGetFleetRoleCredentialsRequest, &WebSocketGetFleetRoleCredentialsRequest::m_roleSessionName>(ROLE_SESSION_NAME),
+};
 
-    JsonHelper::WriteNonEmptyString(writer, ROLE_ARN, m_roleArn);
-    JsonHelper::WriteNonEmptyString(writer, ROLE_SESSION_NAME, m_roleSessionName);
+const MessageFieldTable WebSocketGetFleetRoleCredentialsRequest::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
 
-    return true;
-}
+const MessageFieldTable &WebSocketGetFleetRoleCredentialsRequest::GetFieldTable() const { return FIELD_TABLE; }
 
-bool WebSocketGetFleetRoleCredentialsRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-
-    m_roleArn = JsonHelper::SafelyDeserializeString(value, ROLE_ARN);
-    m_roleSessionName = JsonHelper::SafelyDeserializeString(value, ROLE_SESSION_NAME);
-
-    return true;
-}
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
@@ -0,0 +1,219 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/model/WebSocketAttributeValue.h>
+#include <aws/gamelift/internal/model/WebSocketPlayer.h>
+#include <aws/gamelift/internal/model/request/WebSocketStartMatchBackfillStreamingRequest.h>
+#include <algorithm>
+#include <cstring>
+#include <spdlog/spdlog.h>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+typedef rapidjson::Writer<rapidjson::StringBuffer> JsonWriter;
+typedef Server::Model::AttributeValue::AttrType AttrType;
+
+void WriteNonEmptyString(JsonWriter *writer, const char *key, const char *value) {
+    if (value != nullptr && value[0] != '\0') {
+        writer->String(key);
+        writer->String(value);
+    }
+}
+
+#ifdef GAMELIFT_USE_STD
+inline const char *CStr(const std::string &value) { return value.c_str(); }
+#else
+inline const char *CStr(const char *value) { return value; }
+
+// The non-STD model keeps attributes, latencies and map entries in arrays that may repeat a key.
+// The map-based conversion this replaces wrote them in ascending key order and kept the last value
+// of a repeated key; the indices in order reproduce both.
+template <typename T, typename KeyOf> void SortByKeyLastWins(const T *items, int count, KeyOf keyOf, std::vector<int> &order) {
+    order.resize(count);
+    for (int i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return strcmp(keyOf(items[a]), keyOf(items[b])) < 0; });
+    // Equal keys are adjacent and in array order, so keep the last index of each run.
+    size_t kept = 0;
+    for (size_t i = 0; i < order.size(); i++) {
+        if (i + 1 < order.size() && strcmp(keyOf(items[order[i]]), keyOf(items[order[i + 1]])) == 0) {
+            continue;
+        }
+        order[kept++] = order[i];
+    }
+    order.resize(kept);
+}
+#endif
+} // namespace
+
+WebSocketStartMatchBackfillStreamingRequest::WebSocketStartMatchBackfillStreamingRequest(const Server::Model::StartMatchBackfillRequest &request)
+    : m_request(request) {
+    SetAction(ACTION);
+}
+
+std::string WebSocketStartMatchBackfillStreamingRequest::Serialize() const {
+#ifdef GAMELIFT_USE_STD
+    const size_t playerCount = m_request.GetPlayers().size();
+#else
+    int playerCount;
+    m_request.GetPlayers(playerCount);
+#endif
+    rapidjson::StringBuffer buffer;
+    buffer.Reserve(ESTIMATED_BYTES_PER_PLAYER * (playerCount + 1));
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+    writer.StartObject();
+    if (Serialize(&writer)) {
+        writer.EndObject();
+        return std::string(buffer.GetString(), buffer.GetSize());
+    }
+    return "";
+}
+
+bool WebSocketStartMatchBackfillStreamingRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
+    Message::Serialize(writer);
+
+    WriteNonEmptyString(writer, TICKET_ID, CStr(m_request.GetTicketId()));
+    WriteNonEmptyString(writer, GAME_SESSION_ARN, CStr(m_request.GetGameSessionArn()));
+    WriteNonEmptyString(writer, MATCHMAKING_CONFIGURATION_ARN, CStr(m_request.GetMatchmakingConfigurationArn()));
+
+    writer->String(PLAYERS);
+    writer->StartArray();
+#ifdef GAMELIFT_USE_STD
+    for (const Server::Model::Player &player : m_request.GetPlayers()) {
+#else
+    int playerCount;
+    const Server::Model::Player *players = m_request.GetPlayers(playerCount);
+    std::vector<int> order;
+    std::vector<int> entryOrder;
+    for (const Server::Model::Player *playerIt = players; playerIt != players + playerCount; ++playerIt) {
+        const Server::Model::Player &player = *playerIt;
+#endif
+        writer->StartObject();
+        WriteNonEmptyString(writer, WebSocketPlayer::PLAYER_ID, CStr(player.GetPlayerId()));
+
+        writer->String(WebSocketPlayer::PLAYER_ATTRIBUTES);
+        writer->StartObject();
+#ifdef GAMELIFT_USE_STD
+        for (const auto &attribute : player.GetPlayerAttributes()) {
+            const char *name = attribute.first.c_str();
+            const Server::Model::AttributeValue &value = attribute.second;
+#else
+        int attributeCount;
+        const Server::Model::Player::NamedAttribute *attributes = player.GetPlayerAttributes(attributeCount);
+        SortByKeyLastWins(attributes, attributeCount, [](const Server::Model::Player::NamedAttribute &a) { return a.GetName(); }, order);
+        for (int i : order) {
+            const char *name = attributes[i].GetName();
+            const Server::Model::AttributeValue &value = attributes[i].GetValue();
+#endif
+            writer->String(name);
+            writer->StartObject();
+            writer->String(WebSocketAttributeValue::ATTR_TYPE);
+            switch (value.GetType()) {
+            case AttrType::STRING:
+                writer->String(WebSocketAttributeValue::STRING);
+                writer->String(WebSocketAttributeValue::S);
+                writer->String(CStr(value.GetS()));
+                break;
+            case AttrType::DOUBLE:
+                writer->String(WebSocketAttributeValue::DOUBLE);
+                writer->String(WebSocketAttributeValue::N);
+                writer->Double(value.GetN());
+                break;
+            case AttrType::STRING_LIST: {
+                writer->String(WebSocketAttributeValue::STRING_LIST);
+                writer->String(WebSocketAttributeValue::SL);
+                writer->StartArray();
+#ifdef GAMELIFT_USE_STD
+                for (const std::string &item : value.GetSL()) {
+                    writer->String(item.c_str(), static_cast<rapidjson::SizeType>(item.size()));
+                }
+#else
+                int itemCount;
+                const Server::Model::AttributeValue::AttributeStringType *items = value.GetSL(itemCount);
+                for (int item = 0; item < itemCount; item++) {
+                    writer->String(items[item]);
+                }
+#endif
+                writer->EndArray();
+                break;
+            }
+            case AttrType::STRING_DOUBLE_MAP: {
+                writer->String(WebSocketAttributeValue::STRING_DOUBLE_MAP);
+                writer->String(WebSocketAttributeValue::SDM);
+                writer->StartObject();
+#ifdef GAMELIFT_USE_STD
+                for (const auto &entry : value.GetSDM()) {
+                    writer->String(entry.first.c_str(), static_cast<rapidjson::SizeType>(entry.first.size()));
+                    writer->Double(entry.second);
+                }
+#else
+                int entryCount;
+                const Server::Model::AttributeValue::KeyAndValue *entries = value.GetSDM(entryCount);
+                SortByKeyLastWins(entries, entryCount, [](const Server::Model::AttributeValue::KeyAndValue &e) { return e.GetKey(); }, entryOrder);
+                for (int entry : entryOrder) {
+                    writer->String(entries[entry].GetKey());
+                    writer->Double(entries[entry].GetValue());
+                }
+#endif
+                writer->EndObject();
+                break;
+            }
+            default:
+                writer->String(WebSocketAttributeValue::NONE);
+                break;
+            }
+            writer->EndObject();
+        }
+        writer->EndObject();
+
+        writer->String(WebSocketPlayer::LATENCY_IN_MS);
+        writer->StartObject();
+#ifdef GAMELIFT_USE_STD
+        for (const auto &latency : player.GetLatencyInMs()) {
+            writer->String(latency.first.c_str(), static_cast<rapidjson::SizeType>(latency.first.size()));
+            writer->Int(latency.second);
+        }
+#else
+        int latencyCount;
+        const Server::Model::Player::RegionAndLatency *latencies = player.GetLatencyMs(latencyCount);
+        SortByKeyLastWins(latencies, latencyCount, [](const Server::Model::Player::RegionAndLatency &l) { return l.GetRegion(); }, order);
+        for (int i : order) {
+            writer->String(latencies[i].GetRegion());
+            writer->Int(latencies[i].GetLatencyMs());
+        }
+#endif
+        writer->EndObject();
+
+        WriteNonEmptyString(writer, WebSocketPlayer::TEAM, CStr(player.GetTeam()));
+        writer->EndObject();
+    }
+    writer->EndArray();
+
+    return true;
+}
+
+bool WebSocketStartMatchBackfillStreamingRequest::Deserialize(const std::string &) { return Deserialize(rapidjson::Value()); }
+
+bool WebSocketStartMatchBackfillStreamingRequest::Deserialize(const rapidjson::Value &) {
+    spdlog::error("WebSocketStartMatchBackfillStreamingRequest is write-only and cannot be deserialized");
+    return false;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -11,27 +11,20 @@
  */
 
 #include <aws/gamelift/internal/model/request/WebSocketStopMatchBackfillRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool WebSocketStopMatchBackfillRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ARN, m_gameSessionArn);
-    JsonHelper::WriteNonEmptyString(writer, MATCHMAKING_CONFIG_ARN, m_matchmakingConfigurationArn);
-    JsonHelper::WriteNonEmptyString(writer, TICKET_ID, m_ticketId);
-    return true;
-}
+const MessageField WebSocketStopMatchBackfillRequest::FIELDS[] = {
+    MessageFields::String<WebSocketStopMatchBackfillRequest, &WebSocketStopMatchBackfillRequest::m_gameSessionArn>(GAME_SESSION_ARN),
+    MessageFields::String<WebSocketStopMatchBackfillRequest, &WebSocketStopMatchBackfillRequest::m_matchmakingConfigurationArn>(MATCHMAKING_CONFIG_ARN),
+    MessageFields::String<WebSocketStopMatchBackfillRequest, &WebSocketStopMatchBackfillRequest::m_ticketId>(TICKET_ID),
+};
 
-bool WebSocketStopMatchBackfillRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionArn = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ARN);
-    m_matchmakingConfigurationArn = JsonHelper::SafelyDeserializeString(value, MATCHMAKING_CONFIG_ARN);
-    m_ticketId = JsonHelper::SafelyDeserializeString(value, TICKET_ID);
-    return true;
-}
+const MessageFieldTable WebSocketStopMatchBackfillRequest::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &WebSocketStopMatchBackfillRequest::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketStopMatchBackfillRequest &stopMatchBackfillMessage) {
     const Message *message = &stopMatchBackfillMessage;
@@ -11,47 +11,18 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketDescribePlayerSessionsResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketDescribePlayerSessionsResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
+const MessageField WebSocketDescribePlayerSessionsResponse::FIELDS[] = {
+    MessageFields::String<WebSocketDescribePlayerSessionsResponse, &WebSocketDescribePlayerSessionsResponse::m_nextToken>(NEXT_TOKEN),
+    MessageFields::Field<WebSocketDescribePlayerSessionsResponse, ObjectArrayFieldCodec<WebSocketPlayerSession>, &WebSocketDescribePlayerSessionsResponse::m_playerSessions>(PLAYER_SESSIONS),
+};
 
-    JsonHelper::WriteNonEmptyString(writer, NEXT_TOKEN, m_nextToken);
+const MessageFieldTable WebSocketDescribePlayerSessionsResponse::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
 
-    writer->String(PLAYER_SESSIONS);
-    writer->StartArray();
-    for (const WebSocketPlayerSession &playerSession : m_playerSessions) {
-        writer->StartObject();
-        playerSession.Serialize(writer);
-        writer->EndObject();
-    }
-    writer->EndArray();
-
-    return true;
-}
-
-bool WebSocketDescribePlayerSessionsResponse::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-
-    m_nextToken = JsonHelper::SafelyDeserializeString(value, NEXT_TOKEN);
-    m_playerSessions.clear();
-    if (value.HasMember(PLAYER_SESSIONS) && !value[PLAYER_SESSIONS].IsNull()) {
-        auto playerSessions = value[PLAYER_SESSIONS].GetArray();
-        for (rapidjson::SizeType i = 0; i < playerSessions.Size(); i++) {
-            auto &playerSession = playerSessions[i];
-            if (!playerSession.IsNull()) {
-                WebSocketPlayerSession webSocketPlayerSession;
-                webSocketPlayerSession.Deserialize(playerSession);
-                m_playerSessions.push_back(webSocketPlayerSession);
-            }
-        }
-    }
-
-    return true;
-}
+const MessageFieldTable &WebSocketDescribePlayerSessionsResponse::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketDescribePlayerSessionsResponse &describePlayerSessionsResponse) {
     const Message *message = &describePlayerSessionsResponse;
@@ -11,28 +11,18 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketGetComputeCertificateResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketGetComputeCertificateResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
+const MessageField WebSocketGetComputeCertificateResponse::FIELDS[] = {
+    MessageFields::String<WebSocketGetComputeCertificateResponse, &WebSocketGetComputeCertificateResponse::m_computeName>(COMPUTE_NAME),
+    MessageFields::String<WebSocketGetComputeCertificateResponse, &WebSocketGetComputeCertificateResponse::m_certificatePath>(CERTIFICATE_PATH),
+};
 
-    JsonHelper::WriteNonEmptyString(writer, COMPUTE_NAME, m_computeName);
-    JsonHelper::WriteNonEmptyString(writer, CERTIFICATE_PATH, m_certificatePath);
+const MessageFieldTable WebSocketGetComputeCertificateResponse::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
 
-    return true;
-}
-
-bool WebSocketGetComputeCertificateResponse::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-
-    m_computeName = JsonHelper::SafelyDeserializeString(value, COMPUTE_NAME);
-    m_certificatePath = JsonHelper::SafelyDeserializeString(value, CERTIFICATE_PATH);
-
-    return true;
-}
+const MessageFieldTable &WebSocketGetComputeCertificateResponse::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketGetComputeCertificateResponse &webSocketGetComputeCertificateResponse) {
     const Message *message = &webSocketGetComputeCertificateResponse;
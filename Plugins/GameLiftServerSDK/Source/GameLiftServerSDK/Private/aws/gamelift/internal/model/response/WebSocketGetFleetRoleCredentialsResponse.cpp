@@ -11,36 +11,23 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketGetFleetRoleCredentialsResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketGetFleetRoleCredentialsResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
+const MessageField WebSocketGetFleetRoleCredentialsResponse::FIELDS[] = {
+    MessageFields::String<WebSocketGetFleetRoleCredentialsResponse, &WebSocketGetFleetRoleCredentialsResponse::m_assumedRoleUserArn>(ASSUMED_ROLE_USER_ARN),
+    MessageFields::String<WebSocketGetFleetRoleCredentialsResponse, &WebSocketGetFleetRoleCredentialsResponse::m_assumedRoleId>(ASSUMED_ROLE_ID),
+    MessageFields::String<WebSocketGetFleetRoleCredentialsResponse, &WebSocketGetFleetRoleCredentialsResponse::m_accessKeyId>(ACCESS_KEY_ID),
+    MessageFields::String<WebSocketGetFleetRoleCredentialsResponse, &WebSocketGetFleetRoleCredentialsResponse::m_secretAccessKey>(SECRET_ACCESS_KEY),
+    MessageFields::String<WebSocketGetFleetRoleCredentialsResponse, &WebSocketGetFleetRoleCredentialsResponse::m_sessionToken>(SESSION_TOKEN),
+    MessageFields::PositiveInt64<WebSocketGetFleetRoleCredentialsResponse, &WebSocketGetFleetRoleCredentialsResponse::m_expiration>(EXPIRATION),
+};
 
-    JsonHelper::WriteNonEmptyString(writer, ASSUMED_ROLE_USER_ARN, m_assumedRoleUserArn);
-    JsonHelper::WriteNonEmptyString(writer, ASSUMED_ROLE_ID, m_assumedRoleId);
-    JsonHelper::WriteNonEmptyString(writer, ACCESS_KEY_ID, m_accessKeyId);
-    JsonHelper::WriteNonEmptyString(writer, SECRET_ACCESS_KEY, m_secretAccessKey);
-    JsonHelper::WriteNonEmptyString(writer, SESSION_TOKEN, m_sessionToken);
-    JsonHelper::WritePositiveInt64(writer, EXPIRATION, m_expiration);
+const MessageFieldTable WebSocketGetFleetRoleCredentialsResponse::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
 
-    return true;
-}
+const MessageFieldTable &WebSocketGetFleetRoleCredentialsResponse::GetFieldTable() const { return FIELD_TABLE; }
 
-bool WebSocketGetFleetRoleCredentialsResponse::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-
-    m_assumedRoleUserArn = JsonHelper::SafelyDeserializeString(value, ASSUMED_ROLE_USER_ARN);
-    m_assumedRoleId = JsonHelper::SafelyDeserializeString(value, ASSUMED_ROLE_ID);
-    m_accessKeyId = JsonHelper::SafelyDeserializeString(value, ACCESS_KEY_ID);
-    m_secretAccessKey = JsonHelper::SafelyDeserializeString(value, SECRET_ACCESS_KEY);
-    m_sessionToken = JsonHelper::SafelyDeserializeString(value, SESSION_TOKEN);
-    m_expiration = JsonHelper::SafelyDeserializeInt64(value, EXPIRATION);
-
-    return true;
-}
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
@@ -11,22 +11,17 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketStartMatchBackfillResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketStartMatchBackfillResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, TICKET_ID, m_ticketId);
-    return true;
-}
+const MessageField WebSocketStartMatchBackfillResponse::FIELDS[] = {
+    MessageFields::String<WebSocketStartMatchBackfillResponse, &WebSocketStartMatchBackfillResponse::m_ticketId>(TICKET_ID),
+};
 
-bool WebSocketStartMatchBackfillResponse::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_ticketId = JsonHelper::SafelyDeserializeString(value, TICKET_ID);
-    return true;
-}
+const MessageFieldTable WebSocketStartMatchBackfillResponse::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+
+const MessageFieldTable &WebSocketStartMatchBackfillResponse::GetFieldTable() const { return FIELD_TABLE; }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketStartMatchBackfillResponse &startMatchBackfillResponse) {
     const Message *message = &startMatchBackfillResponse;
@@ -0,0 +1,137 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/network/GameLiftEventHandlers.h>
+#include <aws/gamelift/internal/network/callback/CreateGameSessionCallback.h>
+#include <aws/gamelift/internal/network/callback/DescribePlayerSessionsCallback.h>
+#include <aws/gamelift/internal/network/callback/GetComputeCertificateCallback.h>
+#include <aws/gamelift/internal/network/callback/GetFleetRoleCredentialsCallback.h>
+#include <aws/gamelift/internal/network/callback/RefreshConnectionCallback.h>
+#include <aws/gamelift/internal/network/callback/StartMatchBackfillCallback.h>
+#include <aws/gamelift/internal/network/callback/TerminateProcessCallback.h>
+#include <aws/gamelift/internal/network/callback/UpdateGameSessionCallback.h>
+#include <string.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+constexpr size_t EVENT_COUNT = static_cast<size_t>(GameLiftEvent::COUNT);
+
+// Action names, in GameLiftEvent order.
+constexpr const char *EVENT_ACTIONS[EVENT_COUNT] = {
+    CreateGameSessionCallback::CREATE_GAME_SESSION,
+    DescribePlayerSessionsCallback::DESCRIBE_PLAYER_SESSIONS,
+    GetComputeCertificateCallback::GET_COMPUTE_CERTIFICATE,
+    GetFleetRoleCredentialsCallback::GET_FLEET_ROLE_CREDENTIALS,
+    RefreshConnectionCallback::REFRESH_CONNECTION,
+    StartMatchBackfillCallback::START_MATCH_BACKFILL,
+    TerminateProcessCallback::TERMINATE_PROCESS,
+    UpdateGameSessionCallback::UPDATE_GAME_SESSION,
+};
+
+constexpr size_t SLOT_COUNT = 16;
+constexpr int8_t EMPTY_SLOT = -1;
+
+constexpr size_t Length(const char *value) {
+    size_t length = 0;
+    while (value[length] != '\0') {
+        length++;
+    }
+    return length;
+}
+
+// The multiplier was picked so that every action lands in its own slot; the static_assert below
+// fails if a new action collides with an existing one.
+constexpr size_t Slot(const char *action, size_t length) { return (length * 14 + static_cast<unsigned char>(action[0])) % SLOT_COUNT; }
+
+constexpr bool IsPerfectHash() {
+    for (size_t i = 0; i < EVENT_COUNT; i++) {
+        for (size_t j = i + 1; j < EVENT_COUNT; j++) {
+            if (Slot(EVENT_ACTIONS[i], Length(EVENT_ACTIONS[i])) == Slot(EVENT_ACTIONS[j], Length(EVENT_ACTIONS[j]))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(IsPerfectHash(), "GameLiftEvent actions must hash to distinct slots, adjust Slot()");
+
+struct SlotTable {
+    int8_t events[SLOT_COUNT];
+    uint8_t lengths[EVENT_COUNT];
+};
+
+constexpr SlotTable BuildSlotTable() {
+    SlotTable table{};
+    for (size_t slot = 0; slot < SLOT_COUNT; slot++) {
+        table.events[slot] = EMPTY_SLOT;
+    }
+    for (size_t event = 0; event < EVENT_COUNT; event++) {
+        const size_t length = Length(EVENT_ACTIONS[event]);
+        table.events[Slot(EVENT_ACTIONS[event], length)] = static_cast<int8_t>(event);
+        table.lengths[event] = static_cast<uint8_t>(length);
+    }
+    return table;
+}
+
+constexpr SlotTable SLOTS = BuildSlotTable();
+} // namespace
+
+GameLiftEventHandlers::GameLiftEventHandlers() : m_table(nullptr) {}
+
+GameLiftEventHandlers::~GameLiftEventHandlers() = default;
+
+bool GameLiftEventHandlers::ParseEvent(const char *action, size_t length, GameLiftEvent &event) {
+    if (length == 0) {
+        return false;
+    }
+    const int8_t candidate = SLOTS.events[Slot(action, length)];
+    if (candidate == EMPTY_SLOT || SLOTS.lengths[candidate] != length || memcmp(EVENT_ACTIONS[candidate], action, length) != 0) {
+        return false;
+    }
+    event = static_cast<GameLiftEvent>(candidate);
+    return true;
+}
+
+bool GameLiftEventHandlers::Register(const std::string &action, const Handler &handler) {
+    GameLiftEvent event;
+    if (!ParseEvent(action.c_str(), action.size(), event)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_registerLock);
+    const Table *current = m_table.load(std::memory_order_relaxed);
+    std::unique_ptr<Table> updated(current == nullptr ? new Table() : new Table(*current));
+    updated->handlers[static_cast<size_t>(event)] = handler;
+    m_table.store(updated.get(), std::memory_order_release);
+    m_tables.push_back(std::move(updated));
+    return true;
+}
+
+const GameLiftEventHandlers::Handler *GameLiftEventHandlers::Find(const std::string &action) const {
+    GameLiftEvent event;
+    if (!ParseEvent(action.c_str(), action.size(), event)) {
+        return nullptr;
+    }
+    const Table *table = m_table.load(std::memory_order_acquire);
+    if (table == nullptr || !table->handlers[static_cast<size_t>(event)]) {
+        return nullptr;
+    }
+    return &table->handlers[static_cast<size_t>(event)];
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
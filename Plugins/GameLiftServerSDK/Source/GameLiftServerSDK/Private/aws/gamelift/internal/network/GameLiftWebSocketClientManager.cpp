@@ -60,12 +60,11 @@ GenericOutcome GameLiftWebSocketClientManager::Connect(std::string websocketUrl,
     return m_webSocketClientWrapper->Connect(uri);
 }
 
-GenericOutcome GameLiftWebSocketClientManager::SendSocketMessage(Message &message) {
+ResponseOutcome GameLiftWebSocketClientManager::SendSocketMessage(Message &message) {
     // Serialize the message
     std::string jsonMessage = message.Serialize();
 
-    GenericOutcome outcome = m_webSocketClientWrapper->SendSocketMessage(message.GetRequestId(), jsonMessage);
-    return outcome;
+    return m_webSocketClientWrapper->SendSocketMessage(message.GetRequestIdValue(), jsonMessage);
 }
 
 void GameLiftWebSocketClientManager::Disconnect() { m_webSocketClientWrapper->Disconnect(); }
@@ -0,0 +1,315 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/network/ReplayWebSocketClientWrapper.h>
+#include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/model/ResponseMessage.h>
+#include <chrono>
+#include <cstdlib>
+#include <spdlog/spdlog.h>
+#ifdef _WIN32
+    #include <windows.h>
+    #include <tlhelp32.h>
+#else
+    #include <sys/resource.h>
+    #include <fstream>
+#endif
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+// User and kernel CPU time of this process so far.
+int64_t GetProcessCpuMicros() {
+#ifdef _WIN32
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return 0;
+    }
+    const auto toMicros = [](const FILETIME &time) { return ((static_cast<int64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) / 10; };
+    return toMicros(kernelTime) + toMicros(userTime);
+#else
+    rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    return (static_cast<int64_t>(usage.ru_utime.tv_sec) + usage.ru_stime.tv_sec) * 1000000 + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+#endif
+}
+
+// Threads of this process, or -1 where they cannot be counted.
+int GetProcessThreadCount() {
+#ifdef _WIN32
+    HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+    if (snapshot == INVALID_HANDLE_VALUE) {
+        return -1;
+    }
+    int threadCount = 0;
+    THREADENTRY32 entry;
+    entry.dwSize = sizeof(entry);
+    for (BOOL found = Thread32First(snapshot, &entry); found; found = Thread32Next(snapshot, &entry)) {
+        if (entry.th32OwnerProcessID == GetCurrentProcessId()) {
+            threadCount++;
+        }
+    }
+    CloseHandle(snapshot);
+    return threadCount;
+#else
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 8, "Threads:") == 0) {
+            return std::atoi(line.c_str() + 8);
+        }
+    }
+    return -1;
+#endif
+}
+} // namespace
+
+ReplayWebSocketClientWrapper::ReplayWebSocketClientWrapper() : ReplayWebSocketClientWrapper("", 1.0, "") {
+    const char *capturePath = std::getenv(ENV_VAR_REPLAY_FILE);
+    const char *replaySpeed = std::getenv(ENV_VAR_REPLAY_SPEED);
+    const char *connectionId = std::getenv(ENV_VAR_REPLAY_CONNECTION_ID);
+    m_capturePath = capturePath == nullptr ? "" : capturePath;
+    m_connectionId = connectionId == nullptr ? "" : connectionId;
+    if (replaySpeed != nullptr && std::atof(replaySpeed) > 0) {
+        m_replaySpeed = std::atof(replaySpeed);
+    }
+}
+
+ReplayWebSocketClientWrapper::ReplayWebSocketClientWrapper(const std::string &capturePath, double replaySpeed, const std::string &connectionId)
+    : m_capturePath(capturePath), m_replaySpeed(replaySpeed > 0 ? replaySpeed : 1.0), m_connectionId(connectionId), m_captureLoaded(false), m_captureStartMicros(0),
+      m_connected(false), m_stopRequested(false), m_dispatchedPushCount(0), m_answeredRequestCount(0), m_unansweredRequestCount(0),
+      m_maxDispatchLagMicros(0), m_connectCpuMicros(0), m_connectThreadCount(-1), m_peakThreadCount(-1) {}
+
+ReplayWebSocketClientWrapper::~ReplayWebSocketClientWrapper() { Disconnect(); }
+
+GenericOutcome ReplayWebSocketClientWrapper::Connect(const Uri &uri) {
+    // The query string carries the auth token; leave it out of the log.
+    spdlog::info("Opening replay connection for {} from capture {}", uri.GetBaseUriString(), m_capturePath);
+    if (!m_captureLoaded && !LoadCapture()) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE, "Replay capture could not be loaded."));
+    }
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_connected = true;
+    if (m_connectThreadCount < 0) {
+        m_connectCpuMicros = GetProcessCpuMicros();
+        m_connectThreadCount = GetProcessThreadCount();
+        m_peakThreadCount = m_connectThreadCount;
+    }
+    // A RefreshConnection push re-enters Connect from the replay thread; keep the timeline running.
+    if (!m_replayThread) {
+        m_stopRequested = false;
+        m_replayThread = std::unique_ptr<std::thread>(new std::thread([this] { ReplayUnsolicitedFrames(); }));
+    }
+    return GenericOutcome(nullptr);
+}
+
+bool ReplayWebSocketClientWrapper::LoadCapture() {
+    std::vector<CapturedWebSocketFrame> capturedFrames;
+    if (!WebSocketFrameRecorder::ReadCapture(m_capturePath, capturedFrames)) {
+        return false;
+    }
+
+    // Keep one connection's frames; the pushes of logical server processes belong to their own.
+    if (m_connectionId.empty() && !capturedFrames.empty()) {
+        m_connectionId = capturedFrames.front().connectionId;
+    }
+    std::vector<CapturedWebSocketFrame> frames;
+    for (CapturedWebSocketFrame &frame : capturedFrames) {
+        if (frame.connectionId == m_connectionId) {
+            frames.push_back(std::move(frame));
+        }
+    }
+
+    // Pair recorded responses with the action of the request that produced them.
+    std::map<std::string, std::string> actionByRequestId;
+    for (const CapturedWebSocketFrame &frame : frames) {
+        if (frame.direction != WebSocketFrameDirection::OUTBOUND) {
+            continue;
+        }
+        Message request;
+        if (request.Deserialize(frame.payload)) {
+            actionByRequestId[request.GetRequestId()] = request.GetAction();
+        }
+    }
+
+    for (CapturedWebSocketFrame &frame : frames) {
+        if (frame.direction != WebSocketFrameDirection::INBOUND) {
+            continue;
+        }
+        ResponseMessage responseMessage;
+        Message &message = responseMessage;
+        if (!message.Deserialize(frame.payload)) {
+            continue;
+        }
+        auto request = actionByRequestId.find(responseMessage.GetRequestId());
+        if (!responseMessage.GetRequestId().empty() && request != actionByRequestId.end()) {
+            m_responsesByAction[request->second].push_back(std::move(frame.payload));
+        } else {
+            m_unsolicitedFrames.push_back(std::move(frame));
+        }
+    }
+
+    m_captureStartMicros = frames.empty() ? 0 : frames.front().timestampMicros;
+    m_captureLoaded = true;
+    spdlog::info("Loaded {} of {} frames from capture {} for connection {}: {} service pushes, responses for {} actions", frames.size(),
+                 capturedFrames.size(), m_capturePath, m_connectionId, m_unsolicitedFrames.size(), m_responsesByAction.size());
+    return true;
+}
+
+void ReplayWebSocketClientWrapper::ReplayUnsolicitedFrames() {
+    const std::chrono::steady_clock::time_point replayStart = std::chrono::steady_clock::now();
+
+    for (const CapturedWebSocketFrame &frame : m_unsolicitedFrames) {
+        const auto offset = std::chrono::microseconds(static_cast<int64_t>((frame.timestampMicros - m_captureStartMicros) / m_replaySpeed));
+        const std::chrono::steady_clock::time_point dueTime = replayStart + offset;
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (m_cond.wait_until(lock, dueTime, [this] { return m_stopRequested; })) {
+                return;
+            }
+        }
+
+        const int64_t lagMicros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - dueTime).count();
+        Dispatch(frame.payload);
+
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_dispatchedPushCount++;
+        if (lagMicros > m_maxDispatchLagMicros) {
+            m_maxDispatchLagMicros = lagMicros;
+        }
+        SampleThreadCount();
+    }
+    spdlog::info("Replay of capture {} finished", m_capturePath);
+}
+
+ResponseOutcome ReplayWebSocketClientWrapper::Dispatch(const std::string &message) {
+    ResponseMessage responseMessage;
+    Message &gameLiftMessage = responseMessage;
+    if (!gameLiftMessage.Deserialize(message)) {
+        spdlog::error("Error Deserializing replayed Message");
+        return ResponseOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
+    }
+
+    // Mirror WebSocketppClientWrapper::OnMessage: error responses never reach the event handlers.
+    if (responseMessage.GetStatusCode() != OK_STATUS_CODE && responseMessage.HasRequestId()) {
+        return ResponseOutcome(GameLiftError(responseMessage.GetStatusCode(), message.c_str()));
+    }
+
+    const GameLiftEventHandlers::Handler *handler = m_eventHandlers.Find(responseMessage.GetAction());
+    if (handler != nullptr) {
+        spdlog::info("Executing Amazon GameLift Servers Event Handler for replayed {}", responseMessage.GetAction());
+        return (*handler)(message);
+    }
+    return ResponseOutcome(ResponsePayload());
+}
+
+ResponseOutcome ReplayWebSocketClientWrapper::SendSocketMessage(uint64_t requestId, const std::string &message) {
+    if (requestId == 0) {
+        spdlog::error("Request does not have request ID, cannot process");
+        return ResponseOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
+    }
+
+    Message request;
+    request.Deserialize(message);
+
+    std::string response;
+    bool hasHandler = false;
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (!m_connected) {
+            return ResponseOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+        }
+        std::deque<std::string> &responses = m_responsesByAction[request.GetAction()];
+        if (!responses.empty()) {
+            response = std::move(responses.front());
+            responses.pop_front();
+            m_answeredRequestCount++;
+            SampleThreadCount();
+        } else {
+            m_unansweredRequestCount++;
+            hasHandler = m_eventHandlers.Find(request.GetAction()) != nullptr;
+        }
+    }
+
+    if (!response.empty()) {
+        return Dispatch(response);
+    }
+
+    // Requests without a typed result (heartbeats, policy updates...) succeed even when the capture
+    // ran out of responses; callers expecting a result pointer must get an error instead.
+    spdlog::warn("Capture has no recorded response left for {}", request.GetAction());
+    if (hasHandler) {
+        return ResponseOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION, "No recorded response left in the replay capture."));
+    }
+    return ResponseOutcome(ResponsePayload());
+}
+
+void ReplayWebSocketClientWrapper::Disconnect() {
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (!m_connected && !m_replayThread) {
+            return;
+        }
+        m_connected = false;
+    }
+    StopReplayThread();
+    spdlog::info("Replay disconnected: {} service pushes dispatched (max lag {} us), {} requests answered, {} requests without a recorded response",
+                 m_dispatchedPushCount, m_maxDispatchLagMicros, m_answeredRequestCount, m_unansweredRequestCount);
+    spdlog::info("Replay used {} ms of process CPU time; {} threads at connect, {} at peak", (GetProcessCpuMicros() - m_connectCpuMicros) / 1000,
+                 m_connectThreadCount, m_peakThreadCount);
+}
+
+void ReplayWebSocketClientWrapper::SampleThreadCount() {
+    const int threadCount = GetProcessThreadCount();
+    if (threadCount > m_peakThreadCount) {
+        m_peakThreadCount = threadCount;
+    }
+}
+
+void ReplayWebSocketClientWrapper::StopReplayThread() {
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_stopRequested = true;
+    }
+    m_cond.notify_all();
+
+    if (m_replayThread) {
+        // Replayed pushes such as TerminateProcess may tear the SDK down from the replay thread itself.
+        if (m_replayThread->get_id() == std::this_thread::get_id()) {
+            m_replayThread->detach();
+        } else if (m_replayThread->joinable()) {
+            m_replayThread->join();
+        }
+        m_replayThread = nullptr;
+    }
+}
+
+void ReplayWebSocketClientWrapper::RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<ResponseOutcome(std::string)> &callback) {
+    spdlog::info("Registering GameLift CallBack for replay: {}", gameLiftEvent);
+    if (!m_eventHandlers.Register(gameLiftEvent, callback)) {
+        spdlog::warn("Ignoring GameLift CallBack for unknown event: {}", gameLiftEvent);
+    }
+}
+
+bool ReplayWebSocketClientWrapper::IsConnected() {
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_connected;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,143 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/network/WebSocketFrameRecorder.h>
+#include <chrono>
+#include <cstring>
+#include <spdlog/spdlog.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+template <typename T> void WriteLittleEndian(std::ostream &out, T value) {
+    char bytes[sizeof(T)];
+    for (size_t i = 0; i < sizeof(T); i++) {
+        bytes[i] = static_cast<char>((static_cast<uint64_t>(value) >> (8 * i)) & 0xFF);
+    }
+    out.write(bytes, sizeof(T));
+}
+
+template <typename T> bool ReadLittleEndian(std::istream &in, T &value) {
+    unsigned char bytes[sizeof(T)];
+    if (!in.read(reinterpret_cast<char *>(bytes), sizeof(T))) {
+        return false;
+    }
+    uint64_t raw = 0;
+    for (size_t i = 0; i < sizeof(T); i++) {
+        raw |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+    }
+    value = static_cast<T>(raw);
+    return true;
+}
+} // namespace
+
+WebSocketFrameRecorder::~WebSocketFrameRecorder() { Close(); }
+
+bool WebSocketFrameRecorder::Open(const std::string &capturePath) {
+    std::lock_guard<std::mutex> lock(m_captureLock);
+    m_captureFile.open(capturePath, std::ios::binary | std::ios::app);
+    if (!m_captureFile.is_open()) {
+        spdlog::error("Failed to open websocket capture file {}", capturePath);
+        return false;
+    }
+
+    // Only a fresh file gets a header; re-opened captures keep appending records.
+    m_captureFile.seekp(0, std::ios::end);
+    if (m_captureFile.tellp() == std::streampos(0)) {
+        m_captureFile.write(CAPTURE_MAGIC, CAPTURE_MAGIC_LENGTH);
+        WriteLittleEndian<uint16_t>(m_captureFile, CAPTURE_VERSION);
+        m_captureFile.flush();
+    }
+    spdlog::warn("Recording websocket frames to {}. The capture contains credentials, handle it as a secret.", capturePath);
+    return true;
+}
+
+void WebSocketFrameRecorder::Close() {
+    std::lock_guard<std::mutex> lock(m_captureLock);
+    if (m_captureFile.is_open()) {
+        m_captureFile.close();
+    }
+}
+
+void WebSocketFrameRecorder::Record(WebSocketFrameDirection direction, const std::string &connectionId, const std::string &payload) {
+    const int64_t timestampMicros =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+    std::lock_guard<std::mutex> lock(m_captureLock);
+    if (!m_captureFile.is_open()) {
+        return;
+    }
+    WriteLittleEndian<int64_t>(m_captureFile, timestampMicros);
+    WriteLittleEndian<uint8_t>(m_captureFile, static_cast<uint8_t>(direction));
+    WriteLittleEndian<uint16_t>(m_captureFile, static_cast<uint16_t>(connectionId.size()));
+    m_captureFile.write(connectionId.data(), static_cast<uint16_t>(connectionId.size()));
+    WriteLittleEndian<uint32_t>(m_captureFile, static_cast<uint32_t>(payload.size()));
+    m_captureFile.write(payload.data(), payload.size());
+    // Flush every frame so the capture still covers the incident if the process dies.
+    m_captureFile.flush();
+}
+
+bool WebSocketFrameRecorder::ReadCapture(const std::string &capturePath, std::vector<CapturedWebSocketFrame> &frames) {
+    std::ifstream captureFile(capturePath, std::ios::binary);
+    if (!captureFile.is_open()) {
+        spdlog::error("Failed to open websocket capture file {}", capturePath);
+        return false;
+    }
+
+    char magic[CAPTURE_MAGIC_LENGTH];
+    uint16_t version = 0;
+    if (!captureFile.read(magic, CAPTURE_MAGIC_LENGTH) || std::memcmp(magic, CAPTURE_MAGIC, CAPTURE_MAGIC_LENGTH) != 0 ||
+        !ReadLittleEndian<uint16_t>(captureFile, version) || (version != CAPTURE_VERSION && version != CAPTURE_VERSION_WITHOUT_CONNECTION_ID)) {
+        spdlog::error("{} is not a websocket capture file this SDK can read", capturePath);
+        return false;
+    }
+
+    while (captureFile.peek() != std::char_traits<char>::eof()) {
+        CapturedWebSocketFrame frame;
+        uint8_t direction = 0;
+        uint16_t connectionIdLength = 0;
+        uint32_t payloadLength = 0;
+        if (!ReadLittleEndian<int64_t>(captureFile, frame.timestampMicros) || !ReadLittleEndian<uint8_t>(captureFile, direction)) {
+            spdlog::error("Websocket capture {} is truncated after {} frames", capturePath, frames.size());
+            return false;
+        }
+        if (version != CAPTURE_VERSION_WITHOUT_CONNECTION_ID) {
+            if (!ReadLittleEndian<uint16_t>(captureFile, connectionIdLength)) {
+                spdlog::error("Websocket capture {} is truncated after {} frames", capturePath, frames.size());
+                return false;
+            }
+            frame.connectionId.resize(connectionIdLength);
+            if (connectionIdLength > 0 && !captureFile.read(&frame.connectionId[0], connectionIdLength)) {
+                spdlog::error("Websocket capture {} is truncated after {} frames", capturePath, frames.size());
+                return false;
+            }
+        }
+        if (!ReadLittleEndian<uint32_t>(captureFile, payloadLength)) {
+            spdlog::error("Websocket capture {} is truncated after {} frames", capturePath, frames.size());
+            return false;
+        }
+        frame.direction = static_cast<WebSocketFrameDirection>(direction);
+        frame.payload.resize(payloadLength);
+        if (payloadLength > 0 && !captureFile.read(&frame.payload[0], payloadLength)) {
+            spdlog::error("Websocket capture {} is truncated after {} frames", capturePath, frames.size());
+            return false;
+        }
+        frames.push_back(std::move(frame));
+    }
+    return true;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -15,6 +15,8 @@
 #include <aws/gamelift/internal/model/ResponseMessage.h>
 #include <aws/gamelift/internal/retry/GeometricBackoffRetryStrategy.h>
 #include <aws/gamelift/internal/retry/RetryingCallable.h>
+#include <aws/gamelift/internal/util/ProfilerTrace.h>
+#include <cstdlib>
 #include <memory>
 #include <websocketpp/error.hpp>
 #include <spdlog/spdlog.h>
@@ -23,8 +25,7 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppClientType> webSocketClient)
-    : m_webSocketClient(webSocketClient), m_connectionStateChanged(false) {
+WebSocketppClientContext::WebSocketppClientContext(std::shared_ptr<WebSocketppClientType> webSocketClient) : m_webSocketClient(webSocketClient) {
     // configure logging. comment these out to get websocket logs on stdout for debugging
     m_webSocketClient->clear_access_channels(websocketpp::log::alevel::all);
     m_webSocketClient->clear_error_channels(websocketpp::log::elevel::all);
@@ -59,46 +60,83 @@ WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppCl
     m_socket_thread_1 = std::unique_ptr<std::thread>(new std::thread([this] { m_webSocketClient->run(); }));
     m_socket_thread_2 = std::unique_ptr<std::thread>(new std::thread([this] { m_webSocketClient->run(); }));
 
-    // Set callbacks
     using std::placeholders::_1;
-    using std::placeholders::_2;
+    m_webSocketClient->set_tls_init_handler(std::bind(&WebSocketppClientContext::OnTlsInit, this, _1));
 
-    // Set timeout waiting for GameLift websocket server to respond on initial connection.
-    // See: https://github.com/zaphoyd/websocketpp/blob/master/websocketpp/connection.hpp#L501
-    m_webSocketClient->set_open_handshake_timeout(WEBSOCKET_OPEN_HANDSHAKE_TIMEOUT_MILLIS);
+    const char *capturePath = std::getenv(WebSocketFrameRecorder::ENV_VAR_CAPTURE_FILE);
+    if (capturePath != nullptr && capturePath[0] != '\0') {
+        m_frameRecorder = std::unique_ptr<WebSocketFrameRecorder>(new WebSocketFrameRecorder());
+        if (!m_frameRecorder->Open(capturePath)) {
+            m_frameRecorder = nullptr;
+        }
+    }
+}
 
-    m_webSocketClient->set_tls_init_handler(std::bind(&WebSocketppClientWrapper::OnTlsInit, this, _1));
-    m_webSocketClient->set_open_handler(std::bind(&WebSocketppClientWrapper::OnConnected, this, _1));
-    m_webSocketClient->set_message_handler(std::bind(&WebSocketppClientWrapper::OnMessage, this, _1, _2));
-    m_webSocketClient->set_fail_handler(std::bind(&WebSocketppClientWrapper::OnError, this, _1));
-    m_webSocketClient->set_close_handler(std::bind(&WebSocketppClientWrapper::OnClose, this, _1));
-    m_webSocketClient->set_interrupt_handler(std::bind(&WebSocketppClientWrapper::OnInterrupt, this, _1));
+std::shared_ptr<WebSocketppClientContext> WebSocketppClientContext::Create(std::shared_ptr<WebSocketppClientType> webSocketClient) {
+    return std::shared_ptr<WebSocketppClientContext>(new WebSocketppClientContext(webSocketClient), [](WebSocketppClientContext *context) {
+        if (context->IsSocketThread()) {
+            // The releasing handler returns to run(), which exits once the destructor stops perpetual mode.
+            std::thread([context] { delete context; }).detach();
+        } else {
+            delete context;
+        }
+    });
 }
 
-WebSocketppClientWrapper::~WebSocketppClientWrapper() {
+WebSocketppClientContext::~WebSocketppClientContext() {
     // stop perpetual mode, allowing the websocketClient to destroy itself
-    if (m_webSocketClient) {
-        m_webSocketClient->stop_perpetual();
+    m_webSocketClient->stop_perpetual();
+
+    spdlog::info("Destroying WebSocketppClientContext");
+    for (std::unique_ptr<std::thread> *socketThread : {&m_socket_thread_1, &m_socket_thread_2}) {
+        if (*socketThread && (*socketThread)->joinable()) {
+            (*socketThread)->join();
+        }
     }
+}
+
+bool WebSocketppClientContext::IsSocketThread() const {
+    const std::thread::id currentThread = std::this_thread::get_id();
+    return (m_socket_thread_1 && m_socket_thread_1->get_id() == currentThread) || (m_socket_thread_2 && m_socket_thread_2->get_id() == currentThread);
+}
+
+websocketpp::lib::shared_ptr<asio::ssl::context> WebSocketppClientContext::OnTlsInit(websocketpp::connection_hdl hdl) {
+    // One context serves every connection, including reconnects and those of other wrappers.
+    std::lock_guard<std::mutex> lock(m_tlsContextLock);
+    if (!m_tlsContext) {
+        m_tlsContext = websocketpp::lib::shared_ptr<asio::ssl::context>(new asio::ssl::context(asio::ssl::context::tlsv12));
+    }
+    return m_tlsContext;
+}
+
+WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppClientType> webSocketClient)
+    : WebSocketppClientWrapper(WebSocketppClientContext::Create(webSocketClient)) {}
 
+WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppClientContext> clientContext)
+    : m_clientContext(clientContext), m_webSocketClient(clientContext->GetClient()), m_connectionStateChanged(false),
+      m_frameRecorder(clientContext->GetFrameRecorder()) {
+    // Set timeout waiting for GameLift websocket server to respond on initial connection.
+    // See: https://github.com/zaphoyd/websocketpp/blob/master/websocketpp/connection.hpp#L501
+    m_webSocketClient->set_open_handshake_timeout(WEBSOCKET_OPEN_HANDSHAKE_TIMEOUT_MILLIS);
+}
+
+WebSocketppClientWrapper::~WebSocketppClientWrapper() {
     spdlog::info("Destroying WebsocketPPClientWrapper");
-    // close connections and join the thread
+    // close connections; the context stops and joins the socket threads once no wrapper uses it
     if (m_connection && m_connection->get_state() == websocketpp::session::state::open) {
         Disconnect();
     }
-    if (m_socket_thread_1 && m_socket_thread_1->joinable()) {
-        m_socket_thread_1->join();
-    }
-    if (m_socket_thread_2 && m_socket_thread_2->joinable()) {
-        m_socket_thread_2->join();
-    }
 }
 
 GenericOutcome WebSocketppClientWrapper::Connect(const Uri &uri) {
+    GAMELIFT_TRACE_SCOPE("GameLift::Connect");
     spdlog::info("Opening Connection");
     // Perform connection with retries.
     // This attempts to start up a new websocket connection / thread
     m_uri = uri;
+    // Captured frames are tagged with the process ID the connection registers, see GameLiftWebSocketClientManager::PID_KEY.
+    auto processId = uri.GetQueryMap().find("pID");
+    m_connectionId = processId == uri.GetQueryMap().end() ? std::string() : processId->second;
     websocketpp::lib::error_code errorCode;
     GeometricBackoffRetryStrategy retryStrategy;
     RetryingCallable callable = RetryingCallable::Builder()
@@ -193,6 +231,35 @@ WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(c
         spdlog::info("Connection request created successfully. Waiting for connection to establish...");
     }
 
+    // The client may be shared, so handlers belong to the connection. They hold the wrapper weakly,
+    // since the socket threads can outlive it.
+    std::weak_ptr<WebSocketppClientWrapper> weakThis = shared_from_this();
+    newConnection->set_open_handler([weakThis](websocketpp::connection_hdl hdl) {
+        if (auto wrapper = weakThis.lock()) {
+            wrapper->OnConnected(hdl);
+        }
+    });
+    newConnection->set_message_handler([weakThis](websocketpp::connection_hdl hdl, websocketpp::config::asio_client::message_type::ptr msgPtr) {
+        if (auto wrapper = weakThis.lock()) {
+            wrapper->OnMessage(hdl, msgPtr);
+        }
+    });
+    newConnection->set_fail_handler([weakThis](websocketpp::connection_hdl hdl) {
+        if (auto wrapper = weakThis.lock()) {
+            wrapper->OnError(hdl);
+        }
+    });
+    newConnection->set_close_handler([weakThis](websocketpp::connection_hdl hdl) {
+        if (auto wrapper = weakThis.lock()) {
+            wrapper->OnClose(hdl);
+        }
+    });
+    newConnection->set_interrupt_handler([weakThis](websocketpp::connection_hdl hdl) {
+        if (auto wrapper = weakThis.lock()) {
+            wrapper->OnInterrupt(hdl);
+        }
+    });
+
     // Queue a new connection request (the socket thread will act on it and attempt to connect)
     try {
         m_webSocketClient->connect(newConnection);
@@ -201,6 +268,7 @@ WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(c
         spdlog::error("Exception while trying to connect with the webSocketClient: {}", e.what());
     }
     spdlog::info("Connection request queued.");
+    GAMELIFT_TRACE_SCOPE("GameLift::WaitForConnection");
     // Wait for connection to succeed or fail (this makes connection synchronous)
     {
         std::unique_lock<std::mutex> lk(m_lock);
@@ -222,10 +290,10 @@ WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(c
     return newConnection;
 }
 
-GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &requestId, const std::string &message) {
-    if (requestId.empty()) {
+ResponseOutcome WebSocketppClientWrapper::SendSocketMessage(uint64_t requestId, const std::string &message) {
+    if (requestId == 0) {
         spdlog::error("Request does not have request ID, cannot process");
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
+        return ResponseOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
     }
 
     auto waitForReconnectRetryCount = 0;
@@ -233,28 +301,29 @@ GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &re
         // m_connection will be null if reconnect failed after max reties
         if(m_connection == nullptr || ++waitForReconnectRetryCount >= WAIT_FOR_RECONNECT_MAX_RETRIES) {
             spdlog::warn("WebSocket is not connected... WebSocket failed to send message due to an error.");
-            return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+            return ResponseOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
         }
         spdlog::warn("WebSocket is not connected... isConnected: {}, remoteEndpoint: {}, host: {}, port: {}",
                 IsConnected(), m_connection->get_remote_endpoint(), m_connection->get_host(), m_connection->get_port());
         std::this_thread::sleep_for(std::chrono::seconds(WAIT_FOR_RECONNECT_RETRY_DELAY_SECONDS));
     }
 
-    std::future<GenericOutcome> responseFuture;
+    std::future<ResponseOutcome> responseFuture;
     // Lock whenever we make use of 'm_requestIdToPromise' to avoid concurrent writes/reads
     {
         std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
         // This indicates we've already sent this message, and it's still in flight
         if (m_requestIdToPromise.count(requestId) > 0) {
-            spdlog::error("Request {} already exists", requestId);
-            return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
+            spdlog::error("Request {} already exists", RequestId::ToString(requestId));
+            return ResponseOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
         }
 
-        std::promise<GenericOutcome> responsePromise;
+        std::promise<ResponseOutcome> responsePromise;
         responseFuture = responsePromise.get_future();
         m_requestIdToPromise[requestId] = std::move(responsePromise);
     }
 
+    TraceCounterScope inFlight(TraceCounter::REQUESTS_IN_FLIGHT);
     GenericOutcome immediateResponse = SendSocketMessageAsync(message);
 
     if (!immediateResponse.IsSuccess()) {
@@ -262,25 +331,30 @@ GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &re
                       immediateResponse.GetError().GetErrorName(), immediateResponse.GetError().GetErrorMessage());
         std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
         m_requestIdToPromise.erase(requestId);
-        return immediateResponse;
+        return ResponseOutcome(immediateResponse.GetError());
     }
 
-    std::future_status promiseStatus = responseFuture.wait_for(std::chrono::milliseconds(SERVICE_CALL_TIMEOUT_MILLIS));
+    std::future_status promiseStatus;
+    {
+        GAMELIFT_TRACE_SCOPE("GameLift::WaitForResponse");
+        promiseStatus = responseFuture.wait_for(std::chrono::milliseconds(SERVICE_CALL_TIMEOUT_MILLIS));
+    }
 
     if (promiseStatus == std::future_status::timeout) {
         std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-        spdlog::error("Response not received within the time limit of {} ms for request {}", SERVICE_CALL_TIMEOUT_MILLIS, requestId);
+        spdlog::error("Response not received within the time limit of {} ms for request {}", SERVICE_CALL_TIMEOUT_MILLIS, RequestId::ToString(requestId));
         spdlog::warn("isConnected: {}, remoteEndpoint: {}, host: {}, port: {}", IsConnected(),
                      m_connection->get_remote_endpoint(), m_connection->get_host(), m_connection->get_port());
         m_requestIdToPromise.erase(requestId);
         // If a call times out, retry
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE));
+        return ResponseOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE));
     }
 
     return responseFuture.get();
 }
 
 GenericOutcome WebSocketppClientWrapper::SendSocketMessageAsync(const std::string &message) {
+    GAMELIFT_TRACE_SCOPE("GameLift::Send");
     spdlog::info("Sending Socket Message, isConnected:{}, endpoint: {}, host: {}, port: {}", IsConnected(),
                  m_connection->get_remote_endpoint(), m_connection->get_host(), m_connection->get_port());
     websocketpp::lib::error_code errorCode;
@@ -297,6 +371,9 @@ GenericOutcome WebSocketppClientWrapper::SendSocketMessageAsync(const std::strin
                                                 errorCode.message().c_str()));
         }
     }
+    if (m_frameRecorder) {
+        m_frameRecorder->Record(WebSocketFrameDirection::OUTBOUND, m_connectionId, message);
+    }
     return GenericOutcome(nullptr);
 }
 
@@ -312,9 +389,11 @@ void WebSocketppClientWrapper::Disconnect() {
     }
 }
 
-void WebSocketppClientWrapper::RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) {
+void WebSocketppClientWrapper::RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<ResponseOutcome(std::string)> &callback) {
     spdlog::info("Registering GameLift CallBack for: {}", gameLiftEvent);
-    m_eventHandlers[gameLiftEvent] = callback;
+    if (!m_eventHandlers.Register(gameLiftEvent, callback)) {
+        spdlog::warn("Ignoring GameLift CallBack for unknown event: {}", gameLiftEvent);
+    }
 }
 
 bool WebSocketppClientWrapper::IsConnected() {
@@ -324,6 +403,7 @@ bool WebSocketppClientWrapper::IsConnected() {
 
 void WebSocketppClientWrapper::OnConnected(websocketpp::connection_hdl connection) {
     spdlog::info("Connected to WebSocket");
+    TraceCounterAdd(TraceCounter::CONNECTED, 1);
     // aquire lock and set condition variables (let main thread know connection is successful)
     {
         std::lock_guard<std::mutex> lk(m_lock);
@@ -349,7 +429,11 @@ void WebSocketppClientWrapper::OnError(websocketpp::connection_hdl connection) {
 }
 
 void WebSocketppClientWrapper::OnMessage(websocketpp::connection_hdl connection, websocketpp::config::asio_client::message_type::ptr msg) {
+    GAMELIFT_TRACE_SCOPE("GameLift::OnMessage");
     std::string message = msg->get_payload();
+    if (m_frameRecorder) {
+        m_frameRecorder->Record(WebSocketFrameDirection::INBOUND, m_connectionId, message);
+    }
     spdlog::info("Received message from websocket endpoint: {}, host: {}, port: {}",
                  m_connection->get_remote_endpoint(), m_connection->get_host(), m_connection->get_port());
 
@@ -362,39 +446,37 @@ void WebSocketppClientWrapper::OnMessage(websocketpp::connection_hdl connection,
 
     const std::string &action = responseMessage.GetAction();
     spdlog::info("Deserialized Message has Action: {}", action);
-    const std::string &requestId = responseMessage.GetRequestId();
+    const uint64_t requestId = responseMessage.GetRequestIdValue();
     const int statusCode = responseMessage.GetStatusCode();
     const std::string &errorMessage = responseMessage.GetErrorMessage();
 
-    // Default to a success response with no result pointer
-    GenericOutcome response(nullptr);
+    // Default to a success response with an empty payload
+    ResponseOutcome response = ResponseOutcome(ResponsePayload());
     // Check if the response was an error. If so, update the response based on status code.
     // RequestId will be empty when we get a message not associated with a request, in which case we
     // don't expect a 200 status code either.
-    if (statusCode != OK_STATUS_CODE && !requestId.empty()) {
-        response = GenericOutcome(GameLiftError(statusCode, message.c_str()));
+    if (statusCode != OK_STATUS_CODE && responseMessage.HasRequestId()) {
+        response = ResponseOutcome(GameLiftError(statusCode, message.c_str()));
     } else {
         // If we got a success response, and we have a special event handler for this action, invoke
         // it to get the real parsed result
-        if (m_eventHandlers.count(action)) {
+        const GameLiftEventHandlers::Handler *handler = m_eventHandlers.Find(action);
+        if (handler != nullptr) {
             spdlog::info("Executing Amazon GameLift Servers Event Handler for {}", action);
-            response = m_eventHandlers[action](message);
+            GAMELIFT_TRACE_SCOPE("GameLift::DispatchEvent");
+            response = (*handler)(message);
         }
     }
 
     // Lock whenever we make use of 'm_requestIdToPromise' to avoid concurrent writes/reads
     std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-    if (m_requestIdToPromise.count(requestId) > 0) {
-        m_requestIdToPromise[requestId].set_value(response);
-        m_requestIdToPromise.erase(requestId);
+    auto promise = m_requestIdToPromise.find(requestId);
+    if (promise != m_requestIdToPromise.end()) {
+        promise->second.set_value(std::move(response));
+        m_requestIdToPromise.erase(promise);
     }
 }
 
-websocketpp::lib::shared_ptr<asio::ssl::context> WebSocketppClientWrapper::OnTlsInit(websocketpp::connection_hdl hdl) {
-    websocketpp::lib::shared_ptr<asio::ssl::context> contextPtr(new asio::ssl::context(asio::ssl::context::tlsv12));
-    return contextPtr;
-}
-
 void WebSocketppClientWrapper::OnClose(websocketpp::connection_hdl connection) {
     auto connectionPointer = m_webSocketClient->get_con_from_hdl(connection);
     auto localCloseCode = connectionPointer->get_local_close_code();
@@ -403,6 +485,7 @@ void WebSocketppClientWrapper::OnClose(websocketpp::connection_hdl connection) {
                            || localCloseCode == websocketpp::close::status::going_away
                            || remoteCloseCode == websocketpp::close::status::normal
                            || remoteCloseCode == websocketpp::close::status::going_away;
+    TraceCounterAdd(TraceCounter::CONNECTED, -1);
     spdlog::info("Connection to Amazon GameLift Servers websocket server lost, Local Close Code = {}, Remote Close Code = {}.",
            websocketpp::close::status::get_string(localCloseCode).c_str(),
            websocketpp::close::status::get_string(remoteCloseCode).c_str());
@@ -411,6 +494,7 @@ void WebSocketppClientWrapper::OnClose(websocketpp::connection_hdl connection) {
         return;
     } else {
         spdlog::info("Abnormal Connection Closure, reconnecting.");
+        TraceCounterAdd(TraceCounter::RECONNECTS, 1);
         WebSocketppClientWrapper::Connect(m_uri);
     }
 }
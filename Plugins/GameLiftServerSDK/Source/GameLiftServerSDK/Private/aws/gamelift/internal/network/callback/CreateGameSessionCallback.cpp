@@ -12,6 +12,7 @@
 
 #include <aws/gamelift/internal/network/callback/CreateGameSessionCallback.h>
 #include <aws/gamelift/internal/model/message/CreateGameSessionMessage.h>
+#include <aws/gamelift/internal/model/adapter/MatchmakerDataAdapter.h>
 #include <spdlog/spdlog.h>
 
 using namespace Aws::GameLift;
@@ -36,12 +37,16 @@ GenericOutcome CreateGameSessionCallback::OnStartGameSession(const std::string &
         .WithMatchmakerData(createGameSessionMessage.GetMatchmakerData().c_str())
         .WithDnsName(createGameSessionMessage.GetDnsName().c_str());
 
+    // Parsed once here so game code never re-parses the JSON.
+    gameSession.SetMatchmakerDataModel(MatchmakerDataAdapter::convert(createGameSessionMessage.GetMatchmakerData()));
+
+    gameSession.ReserveGameProperties(static_cast<int>(createGameSessionMessage.GetGameProperties().size()));
     std::map<std::string, std::string>::const_iterator mapIterator;
     for (mapIterator = createGameSessionMessage.GetGameProperties().begin(); mapIterator != createGameSessionMessage.GetGameProperties().end(); mapIterator++) {
         GameProperty gameProperty;
         gameProperty.SetKey(mapIterator->first.c_str());
         gameProperty.SetValue(mapIterator->second.c_str());
-        gameSession.AddGameProperty(gameProperty);
+        gameSession.AddGameProperty(std::move(gameProperty));
     }
 
     m_gameLiftMessageHandler->OnStartGameSession(gameSession);
@@ -19,13 +19,14 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome DescribePlayerSessionsCallback::OnDescribePlayerSessions(const std::string &data) {
+ResponseOutcome DescribePlayerSessionsCallback::OnDescribePlayerSessions(const std::string &data) {
     spdlog::info("OnDescribePlayerSessions Received with raw data: {}", data);
-    WebSocketDescribePlayerSessionsResponse *describePlayerSessionsResponse = new WebSocketDescribePlayerSessionsResponse();
-    Message *message = describePlayerSessionsResponse;
-    message->Deserialize(data);
+    // Deserialize in place; the payload is moved to the waiting caller without a heap allocation
+    ResponsePayload payload;
+    Message &message = payload.Emplace<WebSocketDescribePlayerSessionsResponse>();
+    message.Deserialize(data);
 
-    return GenericOutcome(describePlayerSessionsResponse);
+    return ResponseOutcome(std::move(payload));
 }
 } // namespace Internal
 } // namespace GameLift
@@ -19,13 +19,13 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome GetComputeCertificateCallback::OnGetComputeCertificateCallback(const std::string &data) {
+ResponseOutcome GetComputeCertificateCallback::OnGetComputeCertificateCallback(const std::string &data) {
     spdlog::info("OnGetComputeCertificate Received");
-    auto *response = new WebSocketGetComputeCertificateResponse();
-    Message *message = response;
-    message->Deserialize(data);
+    ResponsePayload payload;
+    Message &message = payload.Emplace<WebSocketGetComputeCertificateResponse>();
+    message.Deserialize(data);
 
-    return GenericOutcome(response);
+    return ResponseOutcome(std::move(payload));
 }
 } // namespace Internal
 } // namespace GameLift
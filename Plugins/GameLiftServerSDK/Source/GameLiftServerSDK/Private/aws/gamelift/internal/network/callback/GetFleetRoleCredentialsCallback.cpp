@@ -19,13 +19,13 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome GetFleetRoleCredentialsCallback::OnGetFleetRoleCredentials(const std::string &data) {
+ResponseOutcome GetFleetRoleCredentialsCallback::OnGetFleetRoleCredentials(const std::string &data) {
     spdlog::info("OnGetFleetRoleCredentials Received");
-    auto *getFleetRoleCredentialsResponse = new WebSocketGetFleetRoleCredentialsResponse();
-    Message *message = getFleetRoleCredentialsResponse;
-    message->Deserialize(data);
+    ResponsePayload payload;
+    Message &message = payload.Emplace<WebSocketGetFleetRoleCredentialsResponse>();
+    message.Deserialize(data);
 
-    return GenericOutcome(getFleetRoleCredentialsResponse);
+    return ResponseOutcome(std::move(payload));
 }
 } // namespace Internal
 } // namespace GameLift
@@ -19,13 +19,13 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome StartMatchBackfillCallback::OnStartMatchBackfill(const std::string &data) {
+ResponseOutcome StartMatchBackfillCallback::OnStartMatchBackfill(const std::string &data) {
     spdlog::info("OnStartMatchBackfill Received with raw data: {}", data);
-    WebSocketStartMatchBackfillResponse *startMatchBackfillResponse = new WebSocketStartMatchBackfillResponse();
-    Message *message = startMatchBackfillResponse;
-    message->Deserialize(data);
+    ResponsePayload payload;
+    Message &message = payload.Emplace<WebSocketStartMatchBackfillResponse>();
+    message.Deserialize(data);
 
-    return GenericOutcome(startMatchBackfillResponse);
+    return ResponseOutcome(std::move(payload));
 }
 } // namespace Internal
 } // namespace GameLift
@@ -12,6 +12,7 @@
 
 #include <aws/gamelift/internal/network/callback/UpdateGameSessionCallback.h>
 #include <aws/gamelift/internal/model/message/UpdateGameSessionMessage.h>
+#include <aws/gamelift/internal/model/adapter/MatchmakerDataAdapter.h>
 #include <spdlog/spdlog.h>
 
 using namespace Aws::GameLift;
@@ -38,15 +39,19 @@ GenericOutcome UpdateGameSessionCallback::OnUpdateGameSession(const std::string
         .WithMatchmakerData(webSocketGameSession.GetMatchmakerData().c_str())
         .WithDnsName(webSocketGameSession.GetDnsName().c_str());
 
+    // Parsed once here so game code never re-parses the JSON.
+    gameSession.SetMatchmakerDataModel(MatchmakerDataAdapter::convert(webSocketGameSession.GetMatchmakerData()));
+
+    gameSession.ReserveGameProperties(static_cast<int>(webSocketGameSession.GetGameProperties().size()));
     std::map<std::string, std::string>::const_iterator mapIterator;
     for (mapIterator = webSocketGameSession.GetGameProperties().begin(); mapIterator != webSocketGameSession.GetGameProperties().end(); mapIterator++) {
         GameProperty gameProperty;
         gameProperty.SetKey(mapIterator->first.c_str());
         gameProperty.SetValue(mapIterator->second.c_str());
-        gameSession.AddGameProperty(gameProperty);
+        gameSession.AddGameProperty(std::move(gameProperty));
     }
 
-    UpdateGameSession updateGameSession(gameSession, UpdateReasonMapper::GetUpdateReasonForName(updateGameSessionMessage.GetUpdateReason().c_str()),
+    UpdateGameSession updateGameSession(std::move(gameSession), UpdateReasonMapper::GetUpdateReasonForName(updateGameSessionMessage.GetUpdateReason().c_str()),
                                         updateGameSessionMessage.GetBackfillTicketId().c_str());
 
     m_gameLiftMessageHandler->OnUpdateGameSession(updateGameSession);
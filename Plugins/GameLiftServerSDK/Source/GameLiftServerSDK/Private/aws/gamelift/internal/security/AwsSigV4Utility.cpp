@@ -20,6 +20,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <algorithm>
+#include <cctype>
 #include <vector>
 
 using namespace Aws::GameLift::Internal;
@@ -44,7 +45,7 @@ Aws::GameLift::Outcome<std::map<std::string, std::string>, std::string> AwsSigV4
 
     const std::string hashedCanonicalRequest = ComputeSha256Hash(canonicalRequest);
 
-    const std::string scope = formattedRequestDate + "/" + parameters.AwsRegion + "/" + ServiceName + "/" + TerminationString;
+    const std::string scope = formattedRequestDate + "/" + parameters.AwsRegion + "/" + parameters.ServiceName + "/" + TerminationString;
 
     const std::string stringToSign = std::string(Algorithm) + "\n" + formattedRequestDateTime + "\n" + scope + "\n" + hashedCanonicalRequest;
 
@@ -54,7 +55,7 @@ Aws::GameLift::Outcome<std::map<std::string, std::string>, std::string> AwsSigV4
             parameters.AwsRegion,
             parameters.Credentials.SecretKey,
             formattedRequestDate,
-            ServiceName,
+            parameters.ServiceName,
             stringToSign);
 
     return GenerateSigV4QueryParameters(
@@ -64,8 +65,85 @@ Aws::GameLift::Outcome<std::map<std::string, std::string>, std::string> AwsSigV4
             signature);
 }
 
+Aws::GameLift::Outcome<std::map<std::string, std::string>, std::string> AwsSigV4Utility::GenerateSigV4Headers(
+        const SigV4Parameters &parameters,
+        const std::string &httpMethod,
+        const std::string &path,
+        const std::map<std::string, std::string> &headers,
+        const std::string &payload) {
+
+    try {
+        ValidateCredentialParameters(parameters);
+    } catch (std::invalid_argument const &ex) {
+        return std::string(ex.what());
+    }
+
+    char dateBuffer[16];
+    char dateTimeBuffer[32];
+    strftime(dateBuffer, sizeof(dateBuffer), DateFormat, &parameters.RequestTime);
+    strftime(dateTimeBuffer, sizeof(dateTimeBuffer), DateTimeFormat, &parameters.RequestTime);
+
+    const std::string formattedRequestDate(dateBuffer);
+    const std::string formattedRequestDateTime(dateTimeBuffer);
+
+    // The date and token headers are part of the signature, so they are signed along with the caller's.
+    std::map<std::string, std::string> canonicalHeaders;
+    for (const auto &header : headers) {
+        std::string name = header.first;
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        canonicalHeaders[name] = header.second;
+    }
+    canonicalHeaders["x-amz-date"] = formattedRequestDateTime;
+    if (!parameters.Credentials.SessionToken.empty()) {
+        canonicalHeaders["x-amz-security-token"] = parameters.Credentials.SessionToken;
+    }
+
+    std::ostringstream canonicalHeadersBuffer;
+    std::ostringstream signedHeadersBuffer;
+    for (auto header = canonicalHeaders.begin(); header != canonicalHeaders.end(); ++header) {
+        canonicalHeadersBuffer << header->first << ":" << header->second << "\n";
+        if (header != canonicalHeaders.begin()) {
+            signedHeadersBuffer << ";";
+        }
+        signedHeadersBuffer << header->first;
+    }
+    const std::string signedHeaders = signedHeadersBuffer.str();
+
+    const std::string canonicalRequest = httpMethod + "\n" + path + "\n" + ToSortedEncodedQueryString(parameters.QueryParams) + "\n" +
+                                         canonicalHeadersBuffer.str() + "\n" + signedHeaders + "\n" + ComputeSha256Hash(payload);
+
+    const std::string scope = formattedRequestDate + "/" + parameters.AwsRegion + "/" + parameters.ServiceName + "/" + TerminationString;
+
+    const std::string stringToSign = std::string(Algorithm) + "\n" + formattedRequestDateTime + "\n" + scope + "\n" + ComputeSha256Hash(canonicalRequest);
+
+    const std::string signature = GenerateSignature(
+            parameters.AwsRegion,
+            parameters.Credentials.SecretKey,
+            formattedRequestDate,
+            parameters.ServiceName,
+            stringToSign);
+
+    std::map<std::string, std::string> sigV4Headers;
+    sigV4Headers[AmzDateKey] = formattedRequestDateTime;
+    if (!parameters.Credentials.SessionToken.empty()) {
+        sigV4Headers[AmzSecurityTokenHeadersKey] = parameters.Credentials.SessionToken;
+    }
+    sigV4Headers[AuthorizationKey] = std::string(Algorithm) + " Credential=" + parameters.Credentials.AccessKey + "/" + scope +
+                                     ", SignedHeaders=" + signedHeaders + ", Signature=" + signature;
+    return sigV4Headers;
+}
+
 void AwsSigV4Utility::ValidateParameters(const SigV4Parameters &parameters) {
 
+    ValidateCredentialParameters(parameters);
+
+    if (parameters.QueryParams.empty()) {
+        throw std::invalid_argument("QueryParams is required");
+    }
+}
+
+void AwsSigV4Utility::ValidateCredentialParameters(const SigV4Parameters &parameters) {
+
     if (parameters.AwsRegion.empty()) {
         throw std::invalid_argument("AwsRegion is required");
     }
@@ -78,10 +156,6 @@ void AwsSigV4Utility::ValidateParameters(const SigV4Parameters &parameters) {
         throw std::invalid_argument("SecretKey is required");
     }
 
-    if (parameters.QueryParams.empty()) {
-        throw std::invalid_argument("QueryParams is required");
-    }
-
     if (parameters.RequestTime.tm_year == 0) {
         throw std::invalid_argument("RequestTime is required");
     }
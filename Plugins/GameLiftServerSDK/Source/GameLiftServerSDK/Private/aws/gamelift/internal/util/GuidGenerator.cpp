@@ -11,37 +11,39 @@
  */
 
 #include <aws/gamelift/internal/util/GuidGenerator.h>
-#include <iostream>
-#include <string>
-#include <random>
-#include <sstream>
-#include <iomanip>
+#include <aws/gamelift/internal/util/RandomNumberGenerator.h>
 
 using namespace Aws::GameLift::Internal;
 
-std::string GuidGenerator::GenerateGuid() {
-    std::random_device rd;
-    std::uniform_int_distribution<int> dist(0, 15);
-    std::uniform_int_distribution<int> dist2(8, 11);
-
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-
-    for (int i = 0; i < 8; ++i) ss << dist(rd);
-    ss << "-";
-
-    for (int i = 0; i < 4; ++i) ss << dist(rd);
-    ss << "-";
+namespace {
+const char HEX_DIGITS[] = "0123456789abcdef";
 
-    ss << "4";
-    for (int i = 0; i < 3; ++i) ss << dist(rd);
-    ss << "-";
+// Hex digit positions of the version and variant nibbles, counted without the dashes.
+constexpr int VERSION_NIBBLE = 12;
+constexpr int VARIANT_NIBBLE = 16;
+} // namespace
 
-    ss << dist2(rd);
-    for (int i = 0; i < 3; ++i) ss << dist(rd);
-    ss << "-";
-
-    for (int i = 0; i < 12; ++i) ss << dist(rd);
+std::string GuidGenerator::GenerateGuid() {
+    char buffer[GUID_LENGTH + 1];
+    GenerateGuid(buffer);
+    return std::string(buffer, GUID_LENGTH);
+}
 
-    return ss.str();
+void GuidGenerator::GenerateGuid(char (&buffer)[GUID_LENGTH + 1]) {
+    const uint64_t random[2] = {RandomNumberGenerator::Next(), RandomNumberGenerator::Next()};
+
+    size_t position = 0;
+    for (int nibble = 0; nibble < 32; nibble++) {
+        if (nibble == 8 || nibble == 12 || nibble == 16 || nibble == 20) {
+            buffer[position++] = '-';
+        }
+        unsigned value = static_cast<unsigned>(random[nibble / 16] >> ((nibble % 16) * 4)) & 0xF;
+        if (nibble == VERSION_NIBBLE) {
+            value = 4;
+        } else if (nibble == VARIANT_NIBBLE) {
+            value = 8 | (value & 3);
+        }
+        buffer[position++] = HEX_DIGITS[value];
+    }
+    buffer[position] = '\0';
 }
@@ -13,10 +13,15 @@
 
 using namespace Aws::GameLift::Internal;
 
-std::string JsonHelper::SafelyDeserializeString(const rapidjson::Value &value, const char *key) {
-    return value.HasMember(key) && value[key].IsString() ? value[key].GetString() : "";
+const rapidjson::Value *JsonHelper::FindMember(const rapidjson::Value &value, const char *key) {
+    rapidjson::Value::ConstMemberIterator member = value.FindMember(key);
+    return member == value.MemberEnd() ? nullptr : &member->value;
 }
 
+std::string JsonHelper::DeserializeString(const rapidjson::Value *value) { return value != nullptr && value->IsString() ? value->GetString() : ""; }
+
+std::string JsonHelper::SafelyDeserializeString(const rapidjson::Value &value, const char *key) { return DeserializeString(FindMember(value, key)); }
+
 void JsonHelper::WriteNonEmptyString(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, const std::string &value) {
     if (!value.empty()) {
         writer->String(key);
@@ -24,9 +29,9 @@ void JsonHelper::WriteNonEmptyString(rapidjson::Writer<rapidjson::StringBuffer>
     }
 }
 
-int JsonHelper::SafelyDeserializeInt(const rapidjson::Value &value, const char *key) {
-    return value.HasMember(key) && value[key].IsInt() ? value[key].GetInt() : -1;
-}
+int JsonHelper::DeserializeInt(const rapidjson::Value *value) { return value != nullptr && value->IsInt() ? value->GetInt() : -1; }
+
+int JsonHelper::SafelyDeserializeInt(const rapidjson::Value &value, const char *key) { return DeserializeInt(FindMember(value, key)); }
 
 void JsonHelper::WritePositiveInt(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, int value) {
     if (value > 0) {
@@ -35,9 +40,11 @@ void JsonHelper::WritePositiveInt(rapidjson::Writer<rapidjson::StringBuffer> *wr
     }
 }
 
-int64_t JsonHelper::SafelyDeserializeInt64(const rapidjson::Value &value, const char *key) {
-    return value.HasMember(key) && value[key].IsInt64() ? value[key].GetInt64() : -1;
-}
+int64_t JsonHelper::DeserializeInt64(const rapidjson::Value *value) { return value != nullptr && value->IsInt64() ? value->GetInt64() : -1; }
+
+int64_t JsonHelper::SafelyDeserializeInt64(const rapidjson::Value &value, const char *key) { return DeserializeInt64(FindMember(value, key)); }
+
+bool JsonHelper::DeserializeBool(const rapidjson::Value *value) { return value != nullptr && value->IsBool() ? value->GetBool() : false; }
 
 void JsonHelper::WritePositiveInt64(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, int64_t value) {
     if (value > 0) {
@@ -46,12 +53,12 @@ void JsonHelper::WritePositiveInt64(rapidjson::Writer<rapidjson::StringBuffer> *
     }
 }
 
-Aws::GameLift::Server::LogParameters JsonHelper::SafelyDeserializeLogParameters(const rapidjson::Value &value, const char *key) {
-    if (!value.HasMember(key) || !value[key].IsArray() || value[key].Size() == 0) {
+Aws::GameLift::Server::LogParameters JsonHelper::DeserializeLogParameters(const rapidjson::Value *value) {
+    if (value == nullptr || !value->IsArray() || value->Size() == 0) {
         return Aws::GameLift::Server::LogParameters();
     }
 
-    const rapidjson::SizeType numLogPaths = value[key].Size();
+    const rapidjson::SizeType numLogPaths = value->Size();
 #ifdef GAMELIFT_USE_STD
     std::vector<std::string> logPaths = std::vector<std::string>();
 #else
@@ -59,15 +66,15 @@ Aws::GameLift::Server::LogParameters JsonHelper::SafelyDeserializeLogParameters(
 #endif
 
     for (rapidjson::SizeType i = 0; i < numLogPaths; i++) {
-        if (value[key][i].IsString()) {
+        if ((*value)[i].IsString()) {
 #ifdef GAMELIFT_USE_STD
-            logPaths.push_back(value[key][i].GetString());
+            logPaths.push_back((*value)[i].GetString());
 #else
             logPaths[i] = new char[MAX_PATH_LENGTH];
 #ifdef WIN32
-            strcpy_s(logPaths[i], MAX_PATH_LENGTH, value[key][i].GetString());
+            strcpy_s(logPaths[i], MAX_PATH_LENGTH, (*value)[i].GetString());
 #else
-            strncpy(logPaths[i], value[key][i].GetString(), MAX_PATH_LENGTH);
+            strncpy(logPaths[i], (*value)[i].GetString(), MAX_PATH_LENGTH);
 #endif
 #endif
         }
@@ -87,6 +94,10 @@ Aws::GameLift::Server::LogParameters JsonHelper::SafelyDeserializeLogParameters(
 #endif
 }
 
+Aws::GameLift::Server::LogParameters JsonHelper::SafelyDeserializeLogParameters(const rapidjson::Value &value, const char *key) {
+    return DeserializeLogParameters(FindMember(value, key));
+}
+
 void JsonHelper::WriteLogParameters(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, const Aws::GameLift::Server::LogParameters &value) {
     if (value.getLogPathCount() == 0) {
         return;
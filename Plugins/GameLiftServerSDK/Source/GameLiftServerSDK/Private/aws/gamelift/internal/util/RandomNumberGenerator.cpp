@@ -0,0 +1,75 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/util/RandomNumberGenerator.h>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <thread>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+inline uint64_t RotateLeft(uint64_t value, int bits) { return (value << bits) | (value >> (64 - bits)); }
+
+// Spreads seed material over the whole state, as recommended by the xoshiro authors.
+inline uint64_t SplitMix64(uint64_t &seed) {
+    uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+class Xoshiro256 {
+public:
+    Xoshiro256() {
+        std::random_device randomDevice;
+        // Some standard libraries fall back to a deterministic random_device; mixing in the
+        // clock and the thread keeps the streams of different threads and processes apart.
+        uint64_t fallback = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count()) ^
+                            (static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) << 1);
+        for (uint64_t &word : m_state) {
+            const uint64_t entropy = (static_cast<uint64_t>(randomDevice()) << 32) | randomDevice();
+            word = entropy ^ SplitMix64(fallback);
+        }
+        if ((m_state[0] | m_state[1] | m_state[2] | m_state[3]) == 0) {
+            m_state[0] = 1;
+        }
+    }
+
+    uint64_t Next() {
+        const uint64_t result = RotateLeft(m_state[1] * 5, 7) * 9;
+        const uint64_t shifted = m_state[1] << 17;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= shifted;
+        m_state[3] = RotateLeft(m_state[3], 45);
+        return result;
+    }
+
+private:
+    uint64_t m_state[4];
+};
+} // namespace
+
+uint64_t RandomNumberGenerator::Next() {
+    static thread_local Xoshiro256 generator;
+    return generator.Next();
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
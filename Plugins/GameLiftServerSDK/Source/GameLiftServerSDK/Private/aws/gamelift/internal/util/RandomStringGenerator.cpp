@@ -10,31 +10,51 @@
  *
  */
 
+#include <aws/gamelift/internal/util/RandomNumberGenerator.h>
 #include <aws/gamelift/internal/util/RandomStringGenerator.h>
-#include <random>
-#include <sstream>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+namespace {
+const char ALPHA_NUM_CHARS[] = "0123456789"
+                               "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                               "abcdefghijklmnopqrstuvwxyz";
+// Excludes the null terminator.
+constexpr unsigned ALPHA_NUM_CHAR_COUNT = sizeof(ALPHA_NUM_CHARS) - 1;
+constexpr int BITS_PER_DRAW = 6;
+} // namespace
+
 std::string RandomStringGenerator::GenerateRandomAlphaNumericString(const int stringLength) {
-    std::stringstream ss;
-    static const char alphaNumChars[] = "0123456789"
-                                        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                        "abcdefghijklmnopqrstuvwxyz";
-    static thread_local std::mt19937 randomNumberGenerator(std::random_device{}());
-    // Distribution has an inclusive upper bound. "alphaNumChars" will end in a null terminator, so
-    // we use "sizeof() - 2" to avoid out of bounds errors, and also to avoid including the null
-    // terminator.
-    std::uniform_int_distribution<int> distribution(0, sizeof(alphaNumChars) - 2);
+    if (stringLength <= 0) {
+        return std::string();
+    }
+    std::string result(static_cast<size_t>(stringLength), '\0');
+    GenerateRandomAlphaNumeric(&result[0], result.size());
+    return result;
+}
 
-    for (int i = 0; i < stringLength; i++) {
-        ss << alphaNumChars[distribution(randomNumberGenerator)];
+void RandomStringGenerator::GenerateRandomAlphaNumeric(char *buffer, size_t length) {
+    // Each 64-bit draw yields ten 6-bit values; the ones past the alphabet are rejected so that
+    // every character stays equally likely.
+    uint64_t bits = 0;
+    int remainingDraws = 0;
+    size_t written = 0;
+    while (written < length) {
+        if (remainingDraws == 0) {
+            bits = RandomNumberGenerator::Next();
+            remainingDraws = 64 / BITS_PER_DRAW;
+        }
+        const unsigned index = static_cast<unsigned>(bits & ((1u << BITS_PER_DRAW) - 1));
+        bits >>= BITS_PER_DRAW;
+        remainingDraws--;
+        if (index < ALPHA_NUM_CHAR_COUNT) {
+            buffer[written++] = ALPHA_NUM_CHARS[index];
+        }
     }
-    return ss.str();
 }
 
 } // namespace Internal
 } // namespace GameLift
-} // namespace Aws
\ No newline at end of file
+} // namespace Aws
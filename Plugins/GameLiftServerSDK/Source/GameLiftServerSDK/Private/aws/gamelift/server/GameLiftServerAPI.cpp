@@ -12,14 +12,24 @@
 #include <aws/gamelift/server/GameLiftServerAPI.h>
 #include <aws/gamelift/internal/GameLiftServerState.h>
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
+#include <aws/gamelift/internal/network/ReplayWebSocketClientWrapper.h>
 #include <aws/gamelift/internal/network/WebSocketppClientWrapper.h>
 #include <aws/gamelift/server/ProcessParameters.h>
 
 #include <aws/gamelift/internal/util/LoggerHelper.h>
+#include <cstdlib>
 #include <spdlog/spdlog.h>
 
 using namespace Aws::GameLift;
 
+namespace {
+// Replaying a capture swaps the real websocket for a fake transport, see ReplayWebSocketClientWrapper.
+bool IsReplayRequested() {
+    const char *replayFile = std::getenv(Aws::GameLift::Internal::ReplayWebSocketClientWrapper::ENV_VAR_REPLAY_FILE);
+    return replayFile != nullptr && replayFile[0] != '\0';
+}
+} // namespace
+
 static const std::string sdkVersion = "5.3.0";
 
 #ifdef GAMELIFT_USE_STD
@@ -32,8 +42,13 @@ Server::InitSDKOutcome Server::InitSDK(const Aws::GameLift::Server::Model::Serve
     spdlog::info("Initializing GameLift SDK");
     // Initialize the WebSocketWrapper
     std::shared_ptr<Internal::IWebSocketClientWrapper> webSocketClientWrapper;
-    std::shared_ptr<Internal::WebSocketppClientType> wsClientPointer = std::make_shared<Internal::WebSocketppClientType>();
-    webSocketClientWrapper = std::make_shared<Internal::WebSocketppClientWrapper>(wsClientPointer);
+    if (IsReplayRequested()) {
+        spdlog::warn("Replaying captured websocket traffic instead of connecting to Amazon GameLift Servers");
+        webSocketClientWrapper = std::make_shared<Internal::ReplayWebSocketClientWrapper>();
+    } else {
+        std::shared_ptr<Internal::WebSocketppClientType> wsClientPointer = std::make_shared<Internal::WebSocketppClientType>();
+        webSocketClientWrapper = std::make_shared<Internal::WebSocketppClientWrapper>(wsClientPointer);
+    }
 
     InitSDKOutcome initOutcome = InitSDKOutcome(Internal::GameLiftServerState::CreateInstance(webSocketClientWrapper));
     if (initOutcome.IsSuccess()) {
@@ -125,11 +140,13 @@ Aws::GameLift::AwsStringOutcome Server::GetGameSessionId() {
 
     Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
 
-    if (!serverState->IsProcessReady()) {
+    // Read readiness and the session from one snapshot so a concurrent change cannot split them.
+    const Internal::GameLiftServerStateStore::Reader state = serverState->GetState();
+    if (!state->processReady) {
         return AwsStringOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
     }
 
-    return AwsStringOutcome(serverState->GetGameSessionId());
+    return AwsStringOutcome(state->gameSessionId);
 }
 
 Aws::GameLift::AwsLongOutcome Server::GetTerminationTime() {
@@ -185,8 +202,14 @@ GenericOutcome Server::InitSDK(const Aws::GameLift::Server::Model::ServerParamet
     Internal::LoggerHelper::InitializeLogger(serverParameters.GetProcessId());
     spdlog::info("Initializing server SDK");
     // Initialize the WebSocketWrapper
-    Internal::InitSDKOutcome initOutcome =
-        Internal::InitSDKOutcome(Internal::GameLiftServerState::CreateInstance<Internal::WebSocketppClientWrapper, Internal::WebSocketppClientType>());
+    Internal::InitSDKOutcome initOutcome;
+    if (IsReplayRequested()) {
+        spdlog::warn("Replaying captured websocket traffic instead of connecting to Amazon GameLift Servers");
+        initOutcome = Internal::InitSDKOutcome(Internal::GameLiftServerState::CreateInstance<Internal::ReplayWebSocketClientWrapper>());
+    } else {
+        initOutcome =
+            Internal::InitSDKOutcome(Internal::GameLiftServerState::CreateInstance<Internal::WebSocketppClientWrapper, Internal::WebSocketppClientType>());
+    }
     if (initOutcome.IsSuccess()) {
         spdlog::info("Created Instance");
         GenericOutcome networkingOutcome = initOutcome.GetResult()->InitializeNetworking(serverParameters);
@@ -276,11 +299,14 @@ Aws::GameLift::AwsStringOutcome Server::GetGameSessionId() {
 
     Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
 
-    if (!serverState->IsProcessReady()) {
+    // Read readiness and the session from one snapshot so a concurrent change cannot split them.
+    // The C string is interned by the server state, so the returned pointer outlives the snapshot.
+    const Internal::GameLiftServerStateStore::Reader state = serverState->GetState();
+    if (!state->processReady) {
         return AwsStringOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
     }
 
-    return AwsStringOutcome(serverState->GetGameSessionId());
+    return AwsStringOutcome(state->gameSessionIdCStr);
 }
 
 Aws::GameLift::AwsLongOutcome Server::GetTerminationTime() {
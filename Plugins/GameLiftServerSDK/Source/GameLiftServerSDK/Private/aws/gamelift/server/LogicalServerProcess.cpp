@@ -0,0 +1,121 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/server/LogicalServerProcess.h>
+#include <aws/gamelift/internal/GameLiftServerState.h>
+#include <aws/gamelift/internal/network/WebSocketppClientWrapper.h>
+#include <memory>
+#include <spdlog/spdlog.h>
+
+using namespace Aws::GameLift;
+
+Server::CreateLogicalServerProcessOutcome Server::LogicalServerProcess::Create(const Aws::GameLift::Server::Model::ServerParameters &serverParameters,
+                                                                              const char *processIdSuffix) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return CreateLogicalServerProcessOutcome(giOutcome.GetError());
+    }
+
+    Internal::GameLiftServerState *primaryState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    // Logical processes ride on the websocketpp client of the process-wide instance. A replayed
+    // capture only covers the process-wide connection, so there is nothing to share then.
+    std::shared_ptr<Internal::WebSocketppClientWrapper> primaryWrapper =
+        std::dynamic_pointer_cast<Internal::WebSocketppClientWrapper>(primaryState->GetWebSocketClientWrapper());
+    if (!primaryWrapper) {
+        return CreateLogicalServerProcessOutcome(
+            GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Logical server processes require a websocket connection to Amazon GameLift Servers."));
+    }
+
+    std::shared_ptr<Internal::IWebSocketClientWrapper> webSocketClientWrapper =
+        std::make_shared<Internal::WebSocketppClientWrapper>(primaryWrapper->GetClientContext());
+    Outcome<Internal::GameLiftServerState *, GameLiftError> createOutcome =
+        Internal::GameLiftServerState::CreateLogicalInstance(webSocketClientWrapper, processIdSuffix == nullptr ? std::string() : std::string(processIdSuffix));
+    if (!createOutcome.IsSuccess()) {
+        return CreateLogicalServerProcessOutcome(createOutcome.GetError());
+    }
+
+    std::unique_ptr<Internal::GameLiftServerState> serverState(createOutcome.GetResult());
+    spdlog::info("Initializing logical server process {}", processIdSuffix);
+    GenericOutcome networkingOutcome = serverState->InitializeNetworking(serverParameters);
+    if (!networkingOutcome.IsSuccess()) {
+        spdlog::error("Networking outcome failure when creating logical server process {}", processIdSuffix);
+        return CreateLogicalServerProcessOutcome(networkingOutcome.GetError());
+    }
+
+    return new LogicalServerProcess(serverState.release());
+}
+
+Server::LogicalServerProcess::LogicalServerProcess(Internal::GameLiftServerState *serverState) : m_serverState(serverState) {}
+
+Server::LogicalServerProcess::~LogicalServerProcess() { delete m_serverState; }
+
+GenericOutcome Server::LogicalServerProcess::ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters) {
+    return m_serverState->ProcessReady(processParameters);
+}
+
+GenericOutcome Server::LogicalServerProcess::ProcessEnding() { return m_serverState->ProcessEnding(); }
+
+GenericOutcome Server::LogicalServerProcess::ActivateGameSession() { return m_serverState->ActivateGameSession(); }
+
+GenericOutcome Server::LogicalServerProcess::UpdatePlayerSessionCreationPolicy(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy) {
+    return m_serverState->UpdatePlayerSessionCreationPolicy(newPlayerSessionPolicy);
+}
+
+AwsStringOutcome Server::LogicalServerProcess::GetGameSessionId() {
+    // Read readiness and the session from one snapshot so a concurrent change cannot split them.
+    const Internal::GameLiftServerStateStore::Reader state = m_serverState->GetState();
+    if (!state->processReady) {
+        return AwsStringOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
+    }
+
+#ifdef GAMELIFT_USE_STD
+    return AwsStringOutcome(state->gameSessionId);
+#else
+    return AwsStringOutcome(state->gameSessionIdCStr);
+#endif
+}
+
+#ifdef GAMELIFT_USE_STD
+GenericOutcome Server::LogicalServerProcess::AcceptPlayerSession(const std::string &playerSessionId) {
+    if (!m_serverState->IsProcessReady()) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
+    }
+
+    return m_serverState->AcceptPlayerSession(playerSessionId);
+}
+
+GenericOutcome Server::LogicalServerProcess::RemovePlayerSession(const std::string &playerSessionId) {
+    if (!m_serverState->IsProcessReady()) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
+    }
+
+    return m_serverState->RemovePlayerSession(playerSessionId);
+}
+#else
+GenericOutcome Server::LogicalServerProcess::AcceptPlayerSession(const char *playerSessionId) {
+    if (!m_serverState->IsProcessReady()) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
+    }
+
+    return m_serverState->AcceptPlayerSession(playerSessionId);
+}
+
+GenericOutcome Server::LogicalServerProcess::RemovePlayerSession(const char *playerSessionId) {
+    if (!m_serverState->IsProcessReady()) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
+    }
+
+    return m_serverState->RemovePlayerSession(playerSessionId);
+}
+#endif
@@ -0,0 +1,78 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include "GameLiftServerSDK.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#endif
+
+#include "aws/gamelift/server/LogicalServerProcess.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+
+/**
+ * An additional server process registered by this OS process, so that it can host one more game
+ * session next to the one of FGameLiftServerSDKModule. Create it after InitSDK, Connect it with the
+ * same server parameters, then use it like the module's process-wide calls. Its FProcessParameters
+ * callbacks are delivered on the game thread through the module, like the module's own.
+ *
+ * Connect and the service calls block; issue them through FGameLiftServerSDKModule::CallAsync.
+ */
+class GAMELIFTSERVERSDK_API FGameLiftLogicalServerProcess
+{
+public:
+    /** ProcessIdSuffix is appended to the process ID and must be unique within the OS process. */
+    explicit FGameLiftLogicalServerProcess(const FString& InProcessIdSuffix);
+    ~FGameLiftLogicalServerProcess();
+
+    FGameLiftLogicalServerProcess(const FGameLiftLogicalServerProcess&) = delete;
+    FGameLiftLogicalServerProcess& operator=(const FGameLiftLogicalServerProcess&) = delete;
+
+    const FString& GetProcessIdSuffix() const { return ProcessIdSuffix; }
+
+    FGameLiftGenericOutcome Connect(const FServerParameters& serverParameters);
+
+    // May be called again once the game session ends, to host another one.
+    FGameLiftGenericOutcome ProcessReady(FProcessParameters& processParameters);
+
+    FGameLiftGenericOutcome ProcessEnding();
+    FGameLiftGenericOutcome ActivateGameSession();
+    FGameLiftGenericOutcome AcceptPlayerSession(const FString& playerSessionId);
+    FGameLiftGenericOutcome RemovePlayerSession(const FString& playerSessionId);
+    FGameLiftGenericOutcome UpdatePlayerSessionCreationPolicy(EPlayerSessionCreationPolicy policy);
+    FGameLiftStringOutcome GetGameSessionId();
+
+private:
+    // What the SDK trampolines are handed as state. Callbacks hold it weakly, so events still
+    // queued for the game thread when the process is destroyed are dropped.
+    struct FCallbackState
+    {
+        FGameLiftServerSDKModule* Module = nullptr;
+        TSharedPtr<FProcessParameters, ESPMode::ThreadSafe> Parameters;
+    };
+
+    static void OnActivateFunctionInternal(const Aws::GameLift::Server::Model::GameSession& gameSession, void* state);
+    static void OnUpdateFunctionInternal(const Aws::GameLift::Server::Model::UpdateGameSession& updateGameSession, void* state);
+    static void OnTerminateFunctionInternal(void* state);
+    static bool OnHealthCheckInternal(void* state);
+
+    FString ProcessIdSuffix;
+    FCallbackState CallbackState;
+
+#if WITH_GAMELIFT
+    Aws::GameLift::Server::LogicalServerProcess* Process = nullptr;
+#endif
+};
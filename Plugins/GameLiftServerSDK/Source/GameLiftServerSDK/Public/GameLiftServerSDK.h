@@ -14,6 +14,10 @@
 
 #include "Modules/ModuleManager.h"
 #include "Delegates/DelegateCombinations.h"
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "GameLiftServerSDKTrace.h"
 
 #if PLATFORM_WINDOWS
 #include "Windows/AllowWindowsPlatformTypes.h"
@@ -28,8 +32,8 @@
 #include "Windows/HideWindowsPlatformTypes.h"
 #endif
 
-DECLARE_DELEGATE_OneParam(FOnStartGameSession, Aws::GameLift::Server::Model::GameSession);
-DECLARE_DELEGATE_OneParam(FOnUpdateGameSession, Aws::GameLift::Server::Model::UpdateGameSession);
+DECLARE_DELEGATE_OneParam(FOnStartGameSession, const Aws::GameLift::Server::Model::GameSession&);
+DECLARE_DELEGATE_OneParam(FOnUpdateGameSession, const Aws::GameLift::Server::Model::UpdateGameSession&);
 DECLARE_DELEGATE_RetVal(bool, FOnHealthCheck);
 
 struct GAMELIFTSERVERSDK_API FProcessParameters {
@@ -51,11 +55,11 @@ struct GAMELIFTSERVERSDK_API FProcessParameters {
         return false;
     }
 
-    void OnActivateFunction(Aws::GameLift::Server::Model::GameSession gameSession) {
+    void OnActivateFunction(const Aws::GameLift::Server::Model::GameSession& gameSession) {
         this->OnStartGameSession.ExecuteIfBound(gameSession);
     }
 
-    void OnUpdateFunction(Aws::GameLift::Server::Model::UpdateGameSession updateGameSession) {
+    void OnUpdateFunction(const Aws::GameLift::Server::Model::UpdateGameSession& updateGameSession) {
         this->OnUpdateGameSession.ExecuteIfBound(updateGameSession);
     }
 };
@@ -136,6 +140,8 @@ public:
     virtual FGameLiftGenericOutcome RemovePlayerSession(const FString& playerSessionId);
     virtual FGameLiftGenericOutcome Destroy();
     virtual FGameLiftDescribePlayerSessionsOutcome DescribePlayerSessions(const FGameLiftDescribePlayerSessionsRequest& describePlayerSessionsRequest);
+    // Same request as DescribePlayerSessions, converting only the player session IDs, player IDs and statuses.
+    virtual FGameLiftDescribePlayerSessionSummariesOutcome DescribePlayerSessionSummaries(const FGameLiftDescribePlayerSessionsRequest& describePlayerSessionsRequest);
 
     virtual FGameLiftGenericOutcome UpdatePlayerSessionCreationPolicy(EPlayerSessionCreationPolicy policy);
     virtual FGameLiftStringOutcome GetGameSessionId();
@@ -147,9 +153,53 @@ public:
     virtual FGameLiftGetComputeCertificateOutcome GetComputeCertificate();
     virtual FGameLiftGetFleetRoleCredentialsOutcome GetFleetRoleCredentials(const FGameLiftGetFleetRoleCredentialsRequest& request);
 
+    /**
+     * Runs Event on the game thread when the core ticker next ticks. Safe to call from any thread.
+     * The FProcessParameters callbacks are delivered this way, so they never run on SDK threads.
+     */
+    void EnqueueGameThreadEvent(TUniqueFunction<void()> Event);
+
+    /**
+     * Runs Call on a thread pool thread and hands its outcome to OnComplete on the game thread.
+     * SDK requests block until the service answers, so issue them through this from game code.
+     */
+    template <typename OutcomeType>
+    void CallAsync(TUniqueFunction<OutcomeType(FGameLiftServerSDKModule&)> Call, TUniqueFunction<void(const OutcomeType&)> OnComplete)
+    {
+        Async(EAsyncExecution::ThreadPool, [this, Call = MoveTemp(Call), OnComplete = MoveTemp(OnComplete)]() mutable {
+            GAMELIFT_TRACE_CPU_SCOPE("GameLift::CallAsync");
+            OutcomeType Outcome = Call(*this);
+            EnqueueGameThreadEvent([OnComplete = MoveTemp(OnComplete), Outcome = MoveTemp(Outcome)]() {
+                GAMELIFT_TRACE_CPU_SCOPE("GameLift::CallAsyncComplete");
+                OnComplete(Outcome);
+            });
+        });
+    }
+
+    // SDK health checks time out after 50 seconds; answer before that even if the game thread hangs.
+    static constexpr float HEALTH_CHECK_GAME_THREAD_TIMEOUT_SECONDS = 45.0f;
+
+    // Conversions shared with FGameLiftLogicalServerProcess.
+    static Aws::GameLift::Server::Model::ServerParameters ToSdkServerParameters(const FServerParameters& serverParameters);
+    static Aws::GameLift::Server::LogParameters ToSdkLogParameters(const TArray<FString>& logParameters);
+
 private:
+    bool Tick(float DeltaTime);
+
+    static void OnActivateFunctionInternal(const Aws::GameLift::Server::Model::GameSession& gameSession, void* state);
+    static void OnUpdateFunctionInternal(const Aws::GameLift::Server::Model::UpdateGameSession& updateGameSession, void* state);
+    static void OnTerminateFunctionInternal(void* state);
+    static bool OnHealthCheckInternal(void* state);
+
     /** Handle to the dll we will load */
     static void* GameLiftServerSDKLibraryHandle;
     static bool LoadDependency(const FString& Dir, const FString& Name, void*& Handle);
     static void FreeDependency(void*& Handle);
+
+    // Copy of the parameters passed to ProcessReady, only used on the game thread.
+    FProcessParameters GameLiftProcessParameters;
+
+    // Written by SDK and pool threads, drained by Tick on the game thread.
+    TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> GameThreadEvents;
+    FTSTicker::FDelegateHandle TickHandle;
 };
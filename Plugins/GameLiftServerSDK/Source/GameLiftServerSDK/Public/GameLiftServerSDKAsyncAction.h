@@ -0,0 +1,81 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "GameLiftServerSDK.h"
+#include "GameLiftServerSDKAsyncAction.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGameLiftAsyncActionPin, const FString&, Result, const FString&, ErrorMessage);
+
+/**
+ * Latent Blueprint nodes for the GameLift server SDK calls. Each node runs its call on a thread pool
+ * thread and fires OnSuccess or OnFailure on the game thread, so Blueprints never block on the service.
+ * Calls whose requests or results have no Blueprint representation are available to C++ through
+ * FGameLiftServerSDKModule::CallAsync.
+ */
+UCLASS()
+class GAMELIFTSERVERSDK_API UGameLiftServerSDKAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintAssignable)
+    FGameLiftAsyncActionPin OnSuccess;
+
+    UPROPERTY(BlueprintAssignable)
+    FGameLiftAsyncActionPin OnFailure;
+
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* ActivateGameSession(UObject* WorldContextObject);
+
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* ProcessEnding(UObject* WorldContextObject);
+
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* AcceptPlayerSession(UObject* WorldContextObject, const FString& PlayerSessionId);
+
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* RemovePlayerSession(UObject* WorldContextObject, const FString& PlayerSessionId);
+
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* UpdatePlayerSessionCreationPolicy(UObject* WorldContextObject, bool bAcceptAll);
+
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* GetGameSessionId(UObject* WorldContextObject);
+
+    /** Result is the termination time in seconds since the epoch. */
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* GetTerminationTime(UObject* WorldContextObject);
+
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* StopMatchBackfill(UObject* WorldContextObject, const FString& TicketId, const FString& GameSessionArn, const FString& MatchmakingConfigurationArn);
+
+    /** Result is the certificate path. */
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* GetComputeCertificate(UObject* WorldContextObject);
+
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* Destroy(UObject* WorldContextObject);
+
+    UFUNCTION(BlueprintCallable, Category = "GameLift", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UGameLiftServerSDKAsyncAction* GetSdkVersion(UObject* WorldContextObject);
+
+    virtual void Activate() override;
+
+private:
+    static UGameLiftServerSDKAsyncAction* Create(UObject* WorldContextObject, TFunction<FGameLiftStringOutcome(FGameLiftServerSDKModule&)> Call);
+    static UGameLiftServerSDKAsyncAction* CreateGeneric(UObject* WorldContextObject, TFunction<FGameLiftGenericOutcome(FGameLiftServerSDKModule&)> Call);
+
+    TFunction<FGameLiftStringOutcome(FGameLiftServerSDKModule&)> Call;
+};
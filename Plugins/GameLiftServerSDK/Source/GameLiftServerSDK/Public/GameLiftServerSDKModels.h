@@ -117,6 +117,23 @@ struct GAMELIFTSERVERSDK_API FGameLiftDescribePlayerSessionsResult
     FString m_nextToken;
 };
 
+/**
+ * The identifying fields of an FGameLiftPlayerSession, for callers that only need to know which
+ * players hold which sessions.
+ */
+struct GAMELIFTSERVERSDK_API FGameLiftPlayerSessionSummary
+{
+    FString m_playerSessionId;
+    FString m_playerId;
+    EPlayerSessionStatus m_status = EPlayerSessionStatus::NOT_SET;
+};
+
+struct GAMELIFTSERVERSDK_API FGameLiftDescribePlayerSessionSummariesResult
+{
+    TArray<FGameLiftPlayerSessionSummary> m_playerSessions;
+    FString m_nextToken;
+};
+
 struct GAMELIFTSERVERSDK_API FGameLiftDescribePlayerSessionsRequest 
 {
     FString m_gameSessionId;
@@ -266,5 +283,6 @@ typedef TGameLiftOutcome<void*, FGameLiftError> FGameLiftGenericOutcome;
 typedef TGameLiftOutcome<FString, FGameLiftError> FGameLiftStringOutcome;
 typedef TGameLiftOutcome<long, FGameLiftError> FGameLiftLongOutcome;
 typedef TGameLiftOutcome<FGameLiftDescribePlayerSessionsResult, FGameLiftError> FGameLiftDescribePlayerSessionsOutcome;
+typedef TGameLiftOutcome<FGameLiftDescribePlayerSessionSummariesResult, FGameLiftError> FGameLiftDescribePlayerSessionSummariesOutcome;
 typedef TGameLiftOutcome<FGameLiftGetComputeCertificateResult, FGameLiftError> FGameLiftGetComputeCertificateOutcome;
 typedef TGameLiftOutcome<FGameLiftGetFleetRoleCredentialsResult, FGameLiftError> FGameLiftGetFleetRoleCredentialsOutcome;
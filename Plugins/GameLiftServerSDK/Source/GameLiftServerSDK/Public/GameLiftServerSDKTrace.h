@@ -0,0 +1,28 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/**
+ * The "GameLift" trace channel. SDK requests and the waits for their responses, connection events,
+ * health checks and the callbacks delivered to the game thread emit CPU events on it, and the SDK
+ * reports its requests in flight, connection state, reconnects and health as counters. Record it
+ * together with the frame timing, e.g. -trace=default,counters,gamelift, to see control plane stalls
+ * against server hitches in one Unreal Insights capture.
+ */
+UE_TRACE_CHANNEL_EXTERN(GameLiftChannel, GAMELIFTSERVERSDK_API);
+
+/** Times the rest of the enclosing scope as a CPU event on the GameLift channel. */
+#define GAMELIFT_TRACE_CPU_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, GameLiftChannel)
@@ -86,9 +86,11 @@ typedef Outcome<std::string, GameLiftError> AwsStringOutcome;
 typedef Outcome<long, GameLiftError> AwsLongOutcome;
 #else
 public:
-    Outcome() : success(false) {}                     // Default constructor
-    Outcome(const R &r) : result(r), success(true) {} // Result copy constructor
-    Outcome(const E &e) : error(e), success(false) {} // Error copy constructor
+    Outcome() : success(false) {}                                 // Default constructor
+    Outcome(const R &r) : result(r), success(true) {}             // Result copy constructor
+    Outcome(const E &e) : error(e), success(false) {}             // Error copy constructor
+    Outcome(R &&r) : result(std::forward<R>(r)), success(true) {} // Result move constructor
+    Outcome(E &&e) : error(std::forward<E>(e)), success(false) {} // Error move constructor
 
     Outcome(const Outcome &o) : result(o.result), error(o.error), success(o.success) {}
 
@@ -102,6 +104,18 @@ public:
         return *this;
     }
 
+    Outcome(Outcome &&o) : result(std::move(o.result)), error(std::move(o.error)), success(o.success) {}
+
+    Outcome &operator=(Outcome &&o) {
+        if (this != &o) {
+            result = std::move(o.result);
+            error = std::move(o.error);
+            success = o.success;
+        }
+
+        return *this;
+    }
+
     inline const R &GetResult() const { return result; }
 
     inline R &GetResult() { return result; }
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/GameLiftCommonState.h>
+#include <aws/gamelift/internal/GameLiftServerStateStore.h>
 #include <aws/gamelift/internal/network/GameLiftWebSocketClientManager.h>
 #include <aws/gamelift/internal/network/IGameLiftMessageHandler.h>
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
@@ -81,6 +82,8 @@ private:
     void ReportHealth();
     void HealthCheck();
     int GetNextHealthCheckIntervalMillis();
+    // Wakes the health check thread, if any, and waits for it to exit. processReady must be false.
+    void StopHealthCheckThread();
 
 #ifdef GAMELIFT_USE_STD
 public:
@@ -102,6 +105,9 @@ public:
 
     GenericOutcome SendSocketMessageWithRetries(Message &message);
 
+    // Like SendSocketMessageWithRetries, but hands the typed response payload back to the caller.
+    ResponseOutcome SendSocketRequestWithRetries(Message &message);
+
     GenericOutcome ActivateGameSession();
 
     GenericOutcome UpdatePlayerSessionCreationPolicy(PlayerSessionCreationPolicy newPlayerSessionPolicy);
@@ -122,7 +128,7 @@ public:
 
     GetComputeCertificateOutcome GetComputeCertificate();
 
-    bool IsProcessReady() const { return m_processReady; }
+    bool IsProcessReady() const { return m_state.Get()->processReady; }
 
     // From Network::AuxProxyMessageHandler
     void OnStartGameSession(GameSession &gameSession) override;
@@ -142,8 +148,6 @@ public:
         return ConstructInternal(std::make_shared<WrapperT>(std::make_shared<ClientT>()));
     }
 
-    std::shared_ptr<IWebSocketClientWrapper> GetWebSocketClientWrapper() const;
-
     virtual GAMELIFT_INTERNAL_STATE_TYPE GetStateType() override { return GAMELIFT_INTERNAL_STATE_TYPE::SERVER; };
 
     // Singleton constructors should be private, but we are using a custom allocator that needs to
@@ -160,6 +164,9 @@ public:
 
     GenericOutcome SendSocketMessageWithRetries(Message &message);
 
+    // Like SendSocketMessageWithRetries, but hands the typed response payload back to the caller.
+    ResponseOutcome SendSocketRequestWithRetries(Message &message);
+
     GenericOutcome ActivateGameSession();
 
     GenericOutcome UpdatePlayerSessionCreationPolicy(PlayerSessionCreationPolicy newPlayerSessionPolicy);
@@ -180,7 +187,7 @@ public:
 
     GetComputeCertificateOutcome GetComputeCertificate();
 
-    bool IsProcessReady() { return m_processReady; }
+    bool IsProcessReady() { return m_state.Get()->processReady; }
 
     // From Network::AuxProxyMessageHandler
     void OnStartGameSession(GameSession &gameSession) override;
@@ -189,8 +196,8 @@ public:
     void OnRefreshConnection(const std::string &refreshConnectionEndpoint, const std::string &authToken) override;
 
 private:
-    std::function<void(Aws::GameLift::Server::Model::GameSession, void *)> m_onStartGameSession;
-    std::function<void(Aws::GameLift::Server::Model::UpdateGameSession, void *)> m_onUpdateGameSession;
+    std::function<void(const Aws::GameLift::Server::Model::GameSession &, void *)> m_onStartGameSession;
+    std::function<void(const Aws::GameLift::Server::Model::UpdateGameSession &, void *)> m_onUpdateGameSession;
     std::function<void(void *)> m_onProcessTerminate;
     std::function<bool(void *)> m_onHealthCheck;
 
@@ -205,21 +212,38 @@ private:
     static Internal::InitSDKOutcome ConstructInternal(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper);
 #endif
 public:
+    /**
+     * Creates a server state that is not the process-wide instance, for a logical server process
+     * hosting one of several game sessions in this OS process. Once networking is initialized, its
+     * process ID is the one resolved for this OS process followed by processIdSuffix. The caller
+     * owns the returned state.
+     */
+    static Outcome<GameLiftServerState *, GameLiftError> CreateLogicalInstance(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper,
+                                                                               const std::string &processIdSuffix);
+
+    std::shared_ptr<IWebSocketClientWrapper> GetWebSocketClientWrapper() const;
+
     GetFleetRoleCredentialsOutcome GetFleetRoleCredentials(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request);
 
     // When within 15 minutes of expiration we retrieve new instance role credentials
     static constexpr const time_t INSTANCE_ROLE_CREDENTIAL_TTL_MIN = 60 * 15;
 
+    // A consistent view of the lifecycle state, safe to read from any thread without blocking.
+    // The snapshot is valid while the returned Reader exists.
+    GameLiftServerStateStore::Reader GetState() const { return m_state.Get(); }
+
+    // Calls listener after every lifecycle state change, see GameLiftServerStateStore::Subscribe.
+    int SubscribeToStateChanges(const GameLiftServerStateStore::Listener &listener) { return m_state.Subscribe(listener); }
+
+    void UnsubscribeFromStateChanges(int subscriptionId) { m_state.Unsubscribe(subscriptionId); }
+
 private:
     bool AssertNetworkInitialized();
     void SetUpCallbacks();
 
-    bool m_processReady;
-
-    // Only one game session per process.
-    std::string m_gameSessionId;
-
-    long m_terminationTime;
+    // Process readiness, game session, termination time and connection settings. Written from
+    // websocket callbacks and read from game and health check threads.
+    GameLiftServerStateStore m_state;
 
     GameLiftWebSocketClientManager *m_webSocketClientManager;
     std::shared_ptr<IWebSocketClientWrapper> m_webSocketClientWrapper;
@@ -234,11 +258,12 @@ private:
     std::unique_ptr<StartMatchBackfillCallback> m_startMatchBackfillCallback;
     std::unique_ptr<RefreshConnectionCallback> m_refreshConnectionCallback;
 
-    std::string m_connectionEndpoint;
-    std::string m_authToken;
+    // Set once while initializing networking.
     std::string m_fleetId;
     std::string m_hostId;
     std::string m_processId;
+    // Distinguishes the logical server processes of a multi-session server, empty otherwise.
+    std::string m_processIdSuffix;
     // Assume we're on managed EC2, if GetFleetRoleCredentials fails we know to set this to false
     bool m_onManagedEC2OrContainers = true;
     std::map<std::string, GetFleetRoleCredentialsResult> m_instanceRoleResultCache;
@@ -0,0 +1,128 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * The lifecycle state of the server process at one point in time. Snapshots are never modified
+ * once published.
+ */
+struct GameLiftServerStateSnapshot {
+    // Incremented by every published change.
+    uint64_t version = 0;
+    bool processReady = false;
+    // Only one game session per process.
+    std::string gameSessionId;
+    // gameSessionId as a C string that stays valid for the lifetime of the store, for the non-STD API.
+    const char *gameSessionIdCStr = "";
+    long terminationTime = -1;
+    std::string connectionEndpoint;
+    std::string authToken;
+};
+
+/**
+ * Holds the current GameLiftServerStateSnapshot and publishes replacements.
+ *
+ * Writers copy the current snapshot, change the copy and publish it with a single atomic store,
+ * so readers on any thread see one consistent snapshot without taking a lock. A replaced snapshot
+ * is retired and freed by a later update once no Reader is open, so a snapshot is only valid
+ * while the Reader it was read through exists.
+ */
+class GameLiftServerStateStore {
+public:
+    typedef std::function<bool(GameLiftServerStateSnapshot &)> Change;
+    typedef std::function<void(const GameLiftServerStateSnapshot &previous, const GameLiftServerStateSnapshot &current)> Listener;
+
+    /**
+     * A read of the current snapshot, which stays valid while the Reader exists. Opening and
+     * closing a Reader is wait-free. Readers should be short-lived: retired snapshots pile up
+     * until an update finds none open.
+     */
+    class Reader {
+    public:
+        explicit Reader(const GameLiftServerStateStore &store) : m_store(store) {
+            // Counting the reader before loading the snapshot orders the load after the count, so
+            // an update that saw no readers cannot free the snapshot loaded here.
+            m_store.m_readers.fetch_add(1, std::memory_order_seq_cst);
+            m_snapshot = m_store.m_current.load(std::memory_order_seq_cst);
+        }
+
+        ~Reader() { m_store.m_readers.fetch_sub(1, std::memory_order_release); }
+
+        Reader(const Reader &) = delete;
+        Reader &operator=(const Reader &) = delete;
+
+        const GameLiftServerStateSnapshot &operator*() const { return *m_snapshot; }
+        const GameLiftServerStateSnapshot *operator->() const { return m_snapshot; }
+
+    private:
+        const GameLiftServerStateStore &m_store;
+        const GameLiftServerStateSnapshot *m_snapshot;
+    };
+
+    GameLiftServerStateStore();
+    ~GameLiftServerStateStore();
+
+    GameLiftServerStateStore(const GameLiftServerStateStore &) = delete;
+    GameLiftServerStateStore &operator=(const GameLiftServerStateStore &) = delete;
+
+    /**
+     * Reads the current snapshot. Wait-free.
+     */
+    Reader Get() const { return Reader(*this); }
+
+    /**
+     * Applies change to a copy of the current snapshot and publishes it, unless change returns
+     * false. Updates are serialized, so change always sees the latest state. Returns whether a
+     * new snapshot was published. Frees the retired snapshots if no Reader is open.
+     */
+    bool Update(const Change &change);
+
+    /**
+     * Registers listener to be called after every published change, on the updating thread and
+     * in publication order. Listeners must not block or update the store. Returns an ID for
+     * Unsubscribe.
+     */
+    int Subscribe(const Listener &listener);
+
+    void Unsubscribe(int subscriptionId);
+
+private:
+    const char *InternGameSessionId(const std::string &gameSessionId);
+
+    std::atomic<const GameLiftServerStateSnapshot *> m_current;
+    mutable std::atomic<int> m_readers;
+    std::mutex m_updateLock;
+    // Owns the current snapshot, followed by the retired ones that readers may still hold.
+    std::vector<std::unique_ptr<const GameLiftServerStateSnapshot>> m_snapshots;
+    // Every game session ID published so far, backing gameSessionIdCStr. One per game session.
+    std::unordered_set<std::string> m_gameSessionIds;
+    std::vector<std::pair<int, Listener>> m_listeners;
+    int m_nextSubscriptionId;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -13,6 +13,8 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/ISerializable.h>
+#include <aws/gamelift/internal/model/MessageFields.h>
+#include <aws/gamelift/internal/model/RequestId.h>
 #include <iostream>
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
@@ -27,13 +29,13 @@ namespace Internal {
 /**
  * Base Message class representing a message that is sent to and from the Amazon GameLift Servers WebSocket. All
  * messages have a request ID, which represents the following:
- * - For outgoing messages: A randomly generated ID
+ * - For outgoing messages: A new ID, see RequestId
  * - For incoming messages: The ID of the outgoing message which triggered the incoming
  * messages/response
  */
 class Message : public ISerializable {
 public:
-    Message() : m_requestId(Message::GenerateRandomRequestId()) {}
+    Message() : m_requestId(RequestId::Next()) {}
     Message(const Message &) = default;
     Message(Message &&) = default;
     Message &operator=(const Message &) = default;
@@ -42,11 +44,19 @@ public:
 
     inline const std::string &GetAction() const { return m_action; }
 
-    inline const std::string &GetRequestId() const { return m_requestId; }
+    inline std::string GetRequestId() const { return m_requestId.ToString(); }
+
+    /**
+     * The 64-bit form of the request ID that requests are correlated by, 0 if the message has no
+     * ID or one this process did not create.
+     */
+    inline uint64_t GetRequestIdValue() const { return m_requestId.GetValue(); }
+
+    inline bool HasRequestId() const { return !m_requestId.IsEmpty(); }
 
     inline void SetAction(const std::string &action) { m_action = action; }
 
-    inline void SetRequestId(const std::string &requestId) { m_requestId = requestId; }
+    inline void SetRequestId(const std::string &requestId) { m_requestId = RequestId::FromString(requestId.c_str(), requestId.size()); }
 
     inline Message &WithAction(const std::string &action) {
         SetAction(action);
@@ -65,6 +75,8 @@ public:
 
     /**
      * Deserialize the given json string and populate the member variables.
+     * Messages made only of scalar fields are read straight from the parser events without
+     * building a document.
      */
     bool Deserialize(const std::string &jsonString) override;
 
@@ -72,27 +84,35 @@ public:
 
 protected:
     /**
-     * Write this message's member variables to the stringBuffer using the provided writer
-     * Subclasses of Message should override this function in order to allow for polymorphic
-     * serialization.
+     * Write this message's member variables to the stringBuffer using the provided writer.
+     * The default implementation writes the fields of GetFieldTable(), base fields first.
      */
     virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
 
     /**
      * Given RapidJson Value deserialize and populate this message's member variables.
-     * Subclasses of Message should override this function in order to allow for polymorphic
-     * deserialization.
+     * The default implementation resets the fields of GetFieldTable() and then assigns them in a
+     * single pass over the object's members. As with a lookup by name, the first occurrence of a
+     * duplicated member wins.
      */
     virtual bool Deserialize(const rapidjson::Value &obj);
 
+    /**
+     * Fields of this message type. Subclasses list their own fields in a MessageFieldTable whose
+     * base is their parent's table and override this function to return it.
+     */
+    virtual const MessageFieldTable &GetFieldTable() const;
+
+    static const MessageFieldTable FIELD_TABLE;
+
 private:
     static constexpr const char *ACTION = "Action";
     static constexpr const char *REQUEST_ID = "RequestId";
 
-    std::string m_action;
-    std::string m_requestId;
+    static const MessageField FIELDS[];
 
-    static std::string GenerateRandomRequestId();
+    std::string m_action;
+    RequestId m_requestId;
 };
 
 } // namespace Internal
@@ -0,0 +1,282 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/internal/model/RequestId.h>
+#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <map>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+class Message;
+
+/**
+ * Describes one top-level JSON field of a Message type: its name and the functions that write
+ * it and read it back. Message serializes and deserializes from these descriptors instead of
+ * hand-written code, see MessageFields below for how they are built.
+ */
+struct MessageField {
+    typedef void (*WriteFunction)(const Message &message, const char *name, rapidjson::Writer<rapidjson::StringBuffer> *writer);
+    // value is nullptr when the field is missing; the field is then reset to its default.
+    typedef void (*ReadFunction)(Message &message, const rapidjson::Value *value);
+
+    const char *name;
+    rapidjson::SizeType nameLength;
+    // True when the field is read from a single JSON scalar, which allows streaming deserialization.
+    bool scalar;
+    WriteFunction write;
+    ReadFunction read;
+};
+
+/**
+ * The fields of a Message type in serialization order. base points to the table of the parent
+ * type, whose fields are written first.
+ */
+struct MessageFieldTable {
+    const MessageField *fields;
+    size_t count;
+    const MessageFieldTable *base;
+};
+
+/**
+ * Field codecs: how a member of type Type is written and read. The scalar codecs below keep the
+ * exact behaviour of the JsonHelper functions they wrap; message types with other members define
+ * their own codec with the same shape.
+ */
+struct StringFieldCodec {
+    typedef std::string Type;
+    static constexpr bool SCALAR = true;
+
+    static void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *name, const std::string &value) {
+        JsonHelper::WriteNonEmptyString(writer, name, value);
+    }
+
+    static void Read(const rapidjson::Value *value, std::string &out) {
+        if (value != nullptr && value->IsString()) {
+            out.assign(value->GetString());
+        } else {
+            out.clear();
+        }
+    }
+};
+
+struct PositiveIntFieldCodec {
+    typedef int Type;
+    static constexpr bool SCALAR = true;
+
+    static void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *name, const int &value) { JsonHelper::WritePositiveInt(writer, name, value); }
+
+    static void Read(const rapidjson::Value *value, int &out) { out = JsonHelper::DeserializeInt(value); }
+};
+
+struct PositiveInt64FieldCodec {
+    typedef int64_t Type;
+    static constexpr bool SCALAR = true;
+
+    static void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *name, const int64_t &value) {
+        JsonHelper::WritePositiveInt64(writer, name, value);
+    }
+
+    static void Read(const rapidjson::Value *value, int64_t &out) { out = JsonHelper::DeserializeInt64(value); }
+};
+
+// Always written, false when missing.
+struct BoolFieldCodec {
+    typedef bool Type;
+    static constexpr bool SCALAR = true;
+
+    static void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *name, const bool &value) {
+        writer->String(name);
+        writer->Bool(value);
+    }
+
+    static void Read(const rapidjson::Value *value, bool &out) { out = JsonHelper::DeserializeBool(value); }
+};
+
+// Written like a string: omitted when empty.
+struct RequestIdFieldCodec {
+    typedef RequestId Type;
+    static constexpr bool SCALAR = true;
+
+    static void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *name, const RequestId &value) {
+        char buffer[RequestId::WIRE_LENGTH + 1];
+        if (value.Format(buffer)) {
+            writer->String(name);
+            writer->String(buffer, static_cast<rapidjson::SizeType>(RequestId::WIRE_LENGTH));
+        } else if (!value.IsEmpty()) {
+            const std::string foreign = value.ToString();
+            writer->String(name);
+            writer->String(foreign.c_str(), static_cast<rapidjson::SizeType>(foreign.size()));
+        }
+    }
+
+    static void Read(const rapidjson::Value *value, RequestId &out) {
+        if (value != nullptr && value->IsString()) {
+            out = RequestId::FromString(value->GetString(), value->GetStringLength());
+        } else {
+            out = RequestId();
+        }
+    }
+};
+
+struct LogParametersFieldCodec {
+    typedef Aws::GameLift::Server::LogParameters Type;
+    static constexpr bool SCALAR = false;
+
+    static void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *name, const Type &value) { JsonHelper::WriteLogParameters(writer, name, value); }
+
+    static void Read(const rapidjson::Value *value, Type &out) { out = JsonHelper::DeserializeLogParameters(value); }
+};
+
+// Always written, possibly as {}. Non-string entries are skipped.
+struct StringMapFieldCodec {
+    typedef std::map<std::string, std::string> Type;
+    static constexpr bool SCALAR = false;
+
+    static void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *name, const Type &value) {
+        writer->String(name);
+        writer->StartObject();
+        for (auto const &entry : value) {
+            writer->String(entry.first.c_str());
+            writer->String(entry.second.c_str());
+        }
+        writer->EndObject();
+    }
+
+    static void Read(const rapidjson::Value *value, Type &out) {
+        out.clear();
+        if (value == nullptr || !value->IsObject()) {
+            return;
+        }
+        for (auto entry = value->MemberBegin(); entry != value->MemberEnd(); ++entry) {
+            if (entry->name.IsString() && entry->value.IsString()) {
+                out[entry->name.GetString()] = entry->value.GetString();
+            }
+        }
+    }
+};
+
+// A nested model object with Serialize(writer) / Deserialize(value); always written.
+template <typename T> struct ObjectFieldCodec {
+    typedef T Type;
+    static constexpr bool SCALAR = false;
+
+    static void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *name, const T &value) {
+        writer->String(name);
+        writer->StartObject();
+        value.Serialize(writer);
+        writer->EndObject();
+    }
+
+    static void Read(const rapidjson::Value *value, T &out) {
+        out = T();
+        if (value != nullptr && value->IsObject()) {
+            out.Deserialize(*value);
+        }
+    }
+};
+
+// An array of nested model objects; always written, null entries are skipped when reading.
+template <typename T> struct ObjectArrayFieldCodec {
+    typedef std::vector<T> Type;
+    static constexpr bool SCALAR = false;
+
+    static void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *name, const Type &value) {
+        writer->String(name);
+        writer->StartArray();
+        for (const T &item : value) {
+            writer->StartObject();
+            item.Serialize(writer);
+            writer->EndObject();
+        }
+        writer->EndArray();
+    }
+
+    static void Read(const rapidjson::Value *value, Type &out) {
+        out.clear();
+        if (value == nullptr || !value->IsArray()) {
+            return;
+        }
+        out.reserve(value->Size());
+        for (auto item = value->Begin(); item != value->End(); ++item) {
+            if (item->IsObject()) {
+                out.emplace_back();
+                out.back().Deserialize(*item);
+            }
+        }
+    }
+};
+
+/**
+ * Builders for field tables. A message type lists its fields once, in the order they are
+ * serialized, and overrides Message::GetFieldTable:
+ *
+ *     const MessageField AcceptPlayerSessionRequest::FIELDS[] = {
+ *         MessageFields::String<AcceptPlayerSessionRequest, &AcceptPlayerSessionRequest::m_gameSessionId>(GAME_SESSION_ID),
+ *         ...
+ *     };
+ *     const MessageFieldTable AcceptPlayerSessionRequest::FIELD_TABLE = MessageFields::Table(FIELDS, &Message::FIELD_TABLE);
+ *
+ * Everything is resolved at compile time: each descriptor holds the field name, its length and
+ * two functions instantiated for that exact member, so the tables are constant-initialized.
+ */
+class MessageFields {
+public:
+    template <typename C, typename Codec, typename Codec::Type C::*Member> static constexpr MessageField Field(const char *name) {
+        return MessageField{name, Length(name), Codec::SCALAR, &WriteMember<C, Codec, Member>, &ReadMember<C, Codec, Member>};
+    }
+
+    template <typename C, std::string C::*Member> static constexpr MessageField String(const char *name) {
+        return Field<C, StringFieldCodec, Member>(name);
+    }
+
+    template <typename C, int C::*Member> static constexpr MessageField PositiveInt(const char *name) {
+        return Field<C, PositiveIntFieldCodec, Member>(name);
+    }
+
+    template <typename C, int64_t C::*Member> static constexpr MessageField PositiveInt64(const char *name) {
+        return Field<C, PositiveInt64FieldCodec, Member>(name);
+    }
+
+    template <typename C, bool C::*Member> static constexpr MessageField Bool(const char *name) { return Field<C, BoolFieldCodec, Member>(name); }
+
+    template <size_t N> static constexpr MessageFieldTable Table(const MessageField (&fields)[N], const MessageFieldTable *base) {
+        return MessageFieldTable{fields, N, base};
+    }
+
+private:
+    static constexpr rapidjson::SizeType Length(const char *name) {
+        rapidjson::SizeType length = 0;
+        while (name[length] != '\0') {
+            length++;
+        }
+        return length;
+    }
+
+    template <typename C, typename Codec, typename Codec::Type C::*Member>
+    static void WriteMember(const Message &message, const char *name, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        Codec::Write(writer, name, static_cast<const C &>(message).*Member);
+    }
+
+    template <typename C, typename Codec, typename Codec::Type C::*Member> static void ReadMember(Message &message, const rapidjson::Value *value) {
+        Codec::Read(value, static_cast<C &>(message).*Member);
+    }
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
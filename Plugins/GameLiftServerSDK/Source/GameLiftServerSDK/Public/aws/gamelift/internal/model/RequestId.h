@@ -0,0 +1,67 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Request ID of a websocket message.
+ *
+ * IDs created by this process are a 64-bit sequence number, which is what requests are correlated
+ * by internally. Their wire form is WIRE_LENGTH alphanumeric characters: a random prefix drawn
+ * once per process, which keeps IDs unique across processes and reconnections, followed by the
+ * sequence number in base 62. Any other ID read from the wire, e.g. from a replayed capture, is
+ * kept verbatim and has no number.
+ */
+class RequestId {
+public:
+    static constexpr size_t WIRE_LENGTH = 32;
+
+    // An empty ID, as carried by service pushes.
+    RequestId() : m_value(0) {}
+
+    // A new ID, distinct from every other one created by this process.
+    static RequestId Next();
+
+    static RequestId FromString(const char *requestId, size_t length);
+
+    /**
+     * The sequence number of an ID created by this process, or 0 for empty and foreign IDs.
+     */
+    inline uint64_t GetValue() const { return m_value; }
+
+    inline bool IsEmpty() const { return m_value == 0 && m_foreign.empty(); }
+
+    /**
+     * Writes the wire form of an ID created by this process, followed by a null terminator.
+     * Returns false, leaving buffer untouched, for empty and foreign IDs.
+     */
+    bool Format(char (&buffer)[WIRE_LENGTH + 1]) const;
+
+    std::string ToString() const;
+
+    static std::string ToString(uint64_t value);
+
+private:
+    uint64_t m_value;
+    std::string m_foreign;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -56,14 +56,15 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const ResponseMessage &responseMessage);
 
 protected:
-    virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
-
-    virtual bool Deserialize(const rapidjson::Value &obj);
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *STATUS_CODE = "StatusCode";
     static constexpr const char *ERROR_MESSAGE = "ErrorMessage";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     int m_statusCode;
     std::string m_errorMessage;
 };
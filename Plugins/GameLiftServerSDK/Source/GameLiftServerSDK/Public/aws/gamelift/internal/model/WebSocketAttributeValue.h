@@ -114,6 +114,9 @@ public:
     bool Deserialize(const rapidjson::Value &value);
 
 private:
+    // Shares the field names when writing the public model directly.
+    friend class WebSocketStartMatchBackfillStreamingRequest;
+
     static constexpr const char *ATTR_TYPE = "AttrType";
     static constexpr const char *S = "S";
     static constexpr const char *N = "N";
@@ -74,6 +74,9 @@ public:
     bool Deserialize(const rapidjson::Value &value);
 
 private:
+    // Shares the field names when writing the public model directly.
+    friend class WebSocketStartMatchBackfillStreamingRequest;
+
     static constexpr const char *PLAYER_ID = "PlayerId";
     static constexpr const char *PLAYER_ATTRIBUTES = "PlayerAttributes";
     static constexpr const char *LATENCY_IN_MS = "LatencyInMs";
@@ -0,0 +1,27 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/server/model/MatchmakerData.h>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+class MatchmakerDataAdapter {
+public:
+    // Returns an empty pointer when matchmakerData is empty or not valid matchmaker data JSON.
+    static Server::Model::MatchmakerDataPtr convert(const std::string &matchmakerData);
+};
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
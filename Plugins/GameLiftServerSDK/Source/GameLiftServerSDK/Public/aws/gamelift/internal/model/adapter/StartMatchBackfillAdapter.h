@@ -12,13 +12,8 @@
 
 #pragma once
 
-#include <aws/gamelift/internal/model/request/WebSocketStartMatchBackfillRequest.h>
 #include <aws/gamelift/internal/model/response/WebSocketStartMatchBackfillResponse.h>
-#include <aws/gamelift/server/model/AttributeValue.h>
-#include <aws/gamelift/server/model/Player.h>
-#include <aws/gamelift/server/model/StartMatchBackfillRequest.h>
 #include <aws/gamelift/server/model/StartMatchBackfillResult.h>
-#include <cstring>
 
 namespace Aws {
 namespace GameLift {
@@ -26,11 +21,6 @@ namespace Internal {
 class StartMatchBackfillAdapter {
 public:
     static Server::Model::StartMatchBackfillResult convert(const WebSocketStartMatchBackfillResponse *webSocketResponse);
-    static WebSocketStartMatchBackfillRequest convert(const Server::Model::StartMatchBackfillRequest &request);
-    static std::map<std::string, int> fetchAndConvertLatency(const Server::Model::Player &player);
-    static std::map<std::string, WebSocketAttributeValue> fetchAndConvertAttributes(const Server::Model::Player &player);
-    static std::vector<std::string> convertStringList(const Server::Model::AttributeValue &attributeValue);
-    static std::map<std::string, double> convertStringDoubleMap(const Server::Model::AttributeValue &attributeValue);
 };
 } // namespace Internal
 } // namespace GameLift
@@ -117,8 +117,7 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const CreateGameSessionMessage &createGameSessionMessage);
 
 protected:
-    virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
-    virtual bool Deserialize(const rapidjson::Value &obj);
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *CREATE_GAME_SESSION = "CreateGameSession";
@@ -132,6 +131,9 @@ private:
     static constexpr const char *PORT = "Port";
     static constexpr const char *GAME_PROPERTIES = "GameProperties";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_gameSessionId;
     std::string m_gameSessionName;
     std::string m_gameSessionData;
@@ -48,14 +48,16 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const RefreshConnectionMessage &refreshConnectionMessage);
 
 protected:
-    virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
-    virtual bool Deserialize(const rapidjson::Value &obj);
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *REFRESH_CONNECTION = "RefreshConnection";
     static constexpr const char *REFRESH_CONNECTION_ENDPOINT = "RefreshConnectionEndpoint";
     static constexpr const char *AUTH_TOKEN = "AuthToken";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_refreshConnectionEndpoint;
     std::string m_authToken;
 };
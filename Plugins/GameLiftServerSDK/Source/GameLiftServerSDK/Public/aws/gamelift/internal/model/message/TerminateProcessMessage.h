@@ -31,7 +31,7 @@ public:
     TerminateProcessMessage &operator=(TerminateProcessMessage &&) = default;
     ~TerminateProcessMessage() = default;
 
-    inline long GetTerminationTime() const { return m_terminationTime; }
+    inline long GetTerminationTime() const { return static_cast<long>(m_terminationTime); }
 
     inline void SetTerminationTime(const long terminationTime) { m_terminationTime = terminationTime; }
 
@@ -43,14 +43,16 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const TerminateProcessMessage &terminateProcessMessage);
 
 protected:
-    virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
-    virtual bool Deserialize(const rapidjson::Value &obj);
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *TERMINATE_PROCESS = "TerminateProcess";
     static constexpr const char *TERMINATION_TIME = "TerminationTime";
 
-    long m_terminationTime;
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
+    int64_t m_terminationTime;
 };
 
 } // namespace Internal
@@ -61,8 +61,7 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const UpdateGameSessionMessage &createGameSessionMessage);
 
 protected:
-    virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
-    virtual bool Deserialize(const rapidjson::Value &obj);
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *UPDATE_GAME_SESSION = "UpdateGameSession";
@@ -70,6 +69,9 @@ private:
     static constexpr const char *UPDATE_REASON = "UpdateReason";
     static constexpr const char *BACKFILL_TICKET_ID = "BackfillTicketId";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     WebSocketGameSession m_gameSession;
     std::string m_updateReason;
     std::string m_backfillTicketId;
@@ -54,14 +54,16 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const AcceptPlayerSessionRequest &request);
 
 protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
-    bool Deserialize(const rapidjson::Value &value);
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *ACTION = "AcceptPlayerSession";
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
     static constexpr const char *PLAYER_SESSION_ID = "PlayerSessionId";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_gameSessionId;
     std::string m_playerSessionId;
 };
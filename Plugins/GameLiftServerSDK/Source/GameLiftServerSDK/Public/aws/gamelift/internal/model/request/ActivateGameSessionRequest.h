@@ -45,13 +45,15 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const ActivateGameSessionRequest &request);
 
 protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
-    bool Deserialize(const rapidjson::Value &value);
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *ACTIVATE_GAME_SESSION = "ActivateGameSession";
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_gameSessionId;
 };
 
@@ -91,8 +91,7 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const ActivateServerProcessRequest &request);
 
 protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
-    bool Deserialize(const rapidjson::Value &value);
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *ACTIVATE_SERVER_PROCESS = "ActivateServerProcess";
@@ -103,6 +102,9 @@ private:
     static constexpr const char *PORT = "Port";
     static constexpr const char *LOG_PATHS = "LogPaths";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_sdkVersion;
     std::string m_sdkLanguage;
     std::string m_sdkToolName;
@@ -43,13 +43,15 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const HeartbeatServerProcessRequest &HeartbeatServerProcessRequest);
 
 protected:
-    virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
-    virtual bool Deserialize(const rapidjson::Value &obj);
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *HEARTBEAT_SERVER_PROCESS = "HeartbeatServerProcess";
     static constexpr const char *HEALTH_STATUS = "HealthStatus";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     bool m_healthy;
 };
 
@@ -50,16 +50,7 @@ public:
 
     inline const WebSocketPlayerSessionCreationPolicy &GetPlayerSessionCreationPolicy() const { return m_playerSessionCreationPolicy; }
 
-    inline const std::string GetPlayerSessionCreationPolicyAsString() const {
-        switch (m_playerSessionCreationPolicy) {
-        case WebSocketPlayerSessionCreationPolicy::ACCEPT_ALL:
-            return std::string(ACCEPT_ALL);
-        case WebSocketPlayerSessionCreationPolicy::DENY_ALL:
-            return std::string(DENY_ALL);
-        default:
-            return std::string(NOT_SET);
-        }
-    }
+    inline const std::string GetPlayerSessionCreationPolicyAsString() const { return std::string(ToString(m_playerSessionCreationPolicy)); }
 
     inline void SetPlayerSessionCreationPolicy(const WebSocketPlayerSessionCreationPolicy &playerSessionCreationPolicy) {
         m_playerSessionCreationPolicy = playerSessionCreationPolicy;
@@ -71,13 +62,7 @@ public:
     }
 
     inline void SetPlayerSessionCreationPolicy(const std::string &playerSessionCreationPolicy) {
-        if (strcmp(playerSessionCreationPolicy.c_str(), ACCEPT_ALL) == 0) {
-            m_playerSessionCreationPolicy = WebSocketPlayerSessionCreationPolicy::ACCEPT_ALL;
-        } else if (strcmp(playerSessionCreationPolicy.c_str(), DENY_ALL) == 0) {
-            m_playerSessionCreationPolicy = WebSocketPlayerSessionCreationPolicy::DENY_ALL;
-        } else {
-            m_playerSessionCreationPolicy = WebSocketPlayerSessionCreationPolicy::NOT_SET;
-        }
+        m_playerSessionCreationPolicy = FromString(playerSessionCreationPolicy);
     }
 
     inline UpdatePlayerSessionCreationPolicyRequest &WithPlayerSessionCreationPolicy(const std::string &playerSessionCreationPolicy) {
@@ -88,8 +73,7 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const UpdatePlayerSessionCreationPolicyRequest &describePlayerSessionsRequest);
 
 protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const override;
-    bool Deserialize(const rapidjson::Value &value) override;
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *ACTION = "UpdatePlayerSessionCreationPolicy";
@@ -100,6 +84,38 @@ private:
     static constexpr const char *DENY_ALL = "DENY_ALL";
     static constexpr const char *NOT_SET = "NOT_SET";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
+    // Writes and reads the policy as its string form.
+    struct PlayerSessionCreationPolicyFieldCodec {
+        typedef WebSocketPlayerSessionCreationPolicy Type;
+        static constexpr bool SCALAR = true;
+
+        static void Write(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *name, const Type &value);
+        static void Read(const rapidjson::Value *value, Type &out);
+    };
+
+    static inline const char *ToString(WebSocketPlayerSessionCreationPolicy playerSessionCreationPolicy) {
+        switch (playerSessionCreationPolicy) {
+        case WebSocketPlayerSessionCreationPolicy::ACCEPT_ALL:
+            return ACCEPT_ALL;
+        case WebSocketPlayerSessionCreationPolicy::DENY_ALL:
+            return DENY_ALL;
+        default:
+            return NOT_SET;
+        }
+    }
+
+    static inline WebSocketPlayerSessionCreationPolicy FromString(const std::string &playerSessionCreationPolicy) {
+        if (strcmp(playerSessionCreationPolicy.c_str(), ACCEPT_ALL) == 0) {
+            return WebSocketPlayerSessionCreationPolicy::ACCEPT_ALL;
+        } else if (strcmp(playerSessionCreationPolicy.c_str(), DENY_ALL) == 0) {
+            return WebSocketPlayerSessionCreationPolicy::DENY_ALL;
+        }
+        return WebSocketPlayerSessionCreationPolicy::NOT_SET;
+    }
+
     std::string m_gameSessionId;
     WebSocketPlayerSessionCreationPolicy m_playerSessionCreationPolicy = WebSocketPlayerSessionCreationPolicy::NOT_SET;
 };
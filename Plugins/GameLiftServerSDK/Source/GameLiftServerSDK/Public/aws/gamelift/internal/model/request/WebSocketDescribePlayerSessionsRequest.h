@@ -87,8 +87,7 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const WebSocketDescribePlayerSessionsRequest &describePlayerSessionsRequest);
 
 protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const override;
-    bool Deserialize(const rapidjson::Value &value) override;
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *ACTION = "DescribePlayerSessions";
@@ -100,6 +99,9 @@ private:
     static constexpr const char *NEXT_TOKEN = "NextToken";
     static constexpr const char *LIMIT = "Limit";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_gameSessionId;
     std::string m_playerId;
     std::string m_playerSessionId;
@@ -32,10 +32,6 @@ public:
 
     friend std::ostream &operator<<(std::ostream &os, const WebSocketGetComputeCertificateRequest &describePlayerSessionsRequest);
 
-protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const override;
-    bool Deserialize(const rapidjson::Value &value) override;
-
 private:
     static constexpr const char *ACTION = "GetComputeCertificate";
 };
@@ -50,9 +50,8 @@ public:
     }
 
 protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const override;
 
-    bool Deserialize(const rapidjson::Value &value) override;
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *ACTION = "GetFleetRoleCredentials";
@@ -60,6 +59,9 @@ private:
     static constexpr const char *ROLE_ARN = "RoleArn";
     static constexpr const char *ROLE_SESSION_NAME = "RoleSessionName";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_roleArn;
     std::string m_roleSessionName;
 };
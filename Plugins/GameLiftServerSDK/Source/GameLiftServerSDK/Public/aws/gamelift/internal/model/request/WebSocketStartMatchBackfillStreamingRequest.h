@@ -0,0 +1,56 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/server/model/StartMatchBackfillRequest.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+/**
+ * StartMatchBackfill request that writes the public StartMatchBackfillRequest straight to the JSON
+ * writer, without copying the players into WebSocketPlayer maps first. Each player is written as
+ * WebSocketPlayer would write it: attribute, latency and string/double map keys in ascending order,
+ * the last value of a key repeated in the non-STD arrays winning.
+ *
+ * Only a reference to the request is kept, so it must outlive this message. The message is
+ * write-only; deserialize responses with the regular response types.
+ */
+class WebSocketStartMatchBackfillStreamingRequest : public Message {
+public:
+    explicit WebSocketStartMatchBackfillStreamingRequest(const Server::Model::StartMatchBackfillRequest &request);
+
+    std::string Serialize() const override;
+
+    bool Deserialize(const std::string &jsonString) override;
+
+protected:
+    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const override;
+    bool Deserialize(const rapidjson::Value &value) override;
+
+private:
+    static constexpr const char *ACTION = "StartMatchBackfill";
+
+    static constexpr const char *TICKET_ID = "TicketId";
+    static constexpr const char *GAME_SESSION_ARN = "GameSessionArn";
+    static constexpr const char *MATCHMAKING_CONFIGURATION_ARN = "MatchmakingConfigurationArn";
+    static constexpr const char *PLAYERS = "Players";
+
+    // Rough serialized size of a player with a few attributes, used to size the buffer up front.
+    static constexpr const size_t ESTIMATED_BYTES_PER_PLAYER = 256;
+
+    const Server::Model::StartMatchBackfillRequest &m_request;
+};
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -55,8 +55,7 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const WebSocketStopMatchBackfillRequest &stopMatchBackfillMessage);
 
 protected:
-    virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
-    virtual bool Deserialize(const rapidjson::Value &obj);
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *STOP_MATCH_BACKFILL = "StopMatchBackfill";
@@ -64,6 +63,9 @@ private:
     static constexpr const char *MATCHMAKING_CONFIG_ARN = "MatchmakingConfigurationArn";
     static constexpr const char *TICKET_ID = "TicketId";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_gameSessionArn;
     std::string m_matchmakingConfigurationArn;
     std::string m_ticketId;
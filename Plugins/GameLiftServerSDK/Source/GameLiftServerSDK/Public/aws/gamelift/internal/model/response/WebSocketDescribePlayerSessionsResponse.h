@@ -53,8 +53,7 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const WebSocketDescribePlayerSessionsResponse &describePlayerSessionsResponse);
 
 protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const override;
-    bool Deserialize(const rapidjson::Value &value) override;
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *ACTION = "DescribePlayerSessions";
@@ -62,6 +61,9 @@ private:
     static constexpr const char *PLAYER_SESSIONS = "PlayerSessions";
     static constexpr const char *NEXT_TOKEN = "NextToken";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::vector<WebSocketPlayerSession> m_playerSessions;
     std::string m_nextToken;
 };
@@ -52,8 +52,7 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const WebSocketGetComputeCertificateResponse &webSocketGetComputeCertificateResponse);
 
 protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const override;
-    bool Deserialize(const rapidjson::Value &value) override;
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *ACTION = "GetComputeCertificate";
@@ -61,6 +60,9 @@ private:
     static constexpr const char *COMPUTE_NAME = "ComputeName";
     static constexpr const char *CERTIFICATE_PATH = "CertificatePath";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_computeName;
     std::string m_certificatePath;
 };
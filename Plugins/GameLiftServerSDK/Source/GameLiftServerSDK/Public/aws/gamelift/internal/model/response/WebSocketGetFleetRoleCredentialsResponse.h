@@ -86,9 +86,8 @@ public:
     }
 
 protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const override;
 
-    bool Deserialize(const rapidjson::Value &value) override;
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *ACTION = "GetFleetRoleCredentials";
@@ -100,6 +99,9 @@ private:
     static constexpr const char *SESSION_TOKEN = "SessionToken";
     static constexpr const char *EXPIRATION = "Expiration";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_assumedRoleUserArn;
     std::string m_assumedRoleId;
     std::string m_accessKeyId;
@@ -20,7 +20,7 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 /**
- * WebSocketStartMatchBackfillRequest Response. This response is sent to the Amazon GameLift Servers WebSocket
+ * WebSocketStartMatchBackfillStreamingRequest Response. This response is sent to the Amazon GameLift Servers WebSocket
  * during a DescribePlayerSessions call
  */
 class WebSocketStartMatchBackfillResponse : public Message {
@@ -44,14 +44,16 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const WebSocketStartMatchBackfillResponse &describePlayerSessionsResponse);
 
 protected:
-    bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const override;
-    bool Deserialize(const rapidjson::Value &value) override;
+    const MessageFieldTable &GetFieldTable() const override;
 
 private:
     static constexpr const char *ACTION = "StartMatchBackfill";
 
     static constexpr const char *TICKET_ID = "TicketId";
 
+    static const MessageField FIELDS[];
+    static const MessageFieldTable FIELD_TABLE;
+
     std::string m_ticketId;
 };
 } // namespace Internal
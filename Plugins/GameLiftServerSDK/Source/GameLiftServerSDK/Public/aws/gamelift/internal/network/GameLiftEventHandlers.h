@@ -0,0 +1,90 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/internal/network/ResponseOutcome.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Actions of inbound websocket messages that have an event handler.
+ */
+enum class GameLiftEvent : uint8_t {
+    CREATE_GAME_SESSION,
+    DESCRIBE_PLAYER_SESSIONS,
+    GET_COMPUTE_CERTIFICATE,
+    GET_FLEET_ROLE_CREDENTIALS,
+    REFRESH_CONNECTION,
+    START_MATCH_BACKFILL,
+    TERMINATE_PROCESS,
+    UPDATE_GAME_SESSION,
+    COUNT
+};
+
+/**
+ * Event handlers of a websocket client wrapper, looked up by message action.
+ *
+ * Actions are mapped to a GameLiftEvent with a perfect hash that is checked at compile time, so a
+ * lookup costs one string compare. Handlers live in an immutable table that Register replaces
+ * with an updated copy and publishes atomically: Find never blocks and stays safe while
+ * callbacks are re-registered, e.g. while reconnecting. Replaced tables are kept until
+ * destruction because a concurrent dispatch may still be using them; there are only a handful
+ * of registrations per connection.
+ */
+class GameLiftEventHandlers {
+public:
+    typedef std::function<ResponseOutcome(std::string)> Handler;
+
+    GameLiftEventHandlers();
+    ~GameLiftEventHandlers();
+
+    GameLiftEventHandlers(const GameLiftEventHandlers &) = delete;
+    GameLiftEventHandlers &operator=(const GameLiftEventHandlers &) = delete;
+
+    /**
+     * Maps an action name to its event. Returns false for actions without an event handler.
+     */
+    static bool ParseEvent(const char *action, size_t length, GameLiftEvent &event);
+
+    /**
+     * Sets the handler for action, replacing any previous one. Returns false if action is not a
+     * GameLiftEvent.
+     */
+    bool Register(const std::string &action, const Handler &handler);
+
+    /**
+     * Returns the handler for action, or nullptr if there is none. The handler stays valid for
+     * the lifetime of this object.
+     */
+    const Handler *Find(const std::string &action) const;
+
+private:
+    struct Table {
+        Handler handlers[static_cast<size_t>(GameLiftEvent::COUNT)];
+    };
+
+    std::atomic<const Table *> m_table;
+    std::mutex m_registerLock;
+    std::vector<std::unique_ptr<const Table>> m_tables;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
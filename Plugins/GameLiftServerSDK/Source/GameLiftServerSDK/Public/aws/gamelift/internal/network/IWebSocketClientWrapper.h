@@ -12,7 +12,9 @@
 #pragma once
 #include <aws/gamelift/common/Outcome.h>
 #include <aws/gamelift/internal/model/Uri.h>
+#include <aws/gamelift/internal/network/ResponseOutcome.h>
 #include <functional>
+#include <stdint.h>
 #include <string>
 
 namespace Aws {
@@ -25,9 +27,10 @@ namespace Internal {
 class IWebSocketClientWrapper {
 public:
     virtual Aws::GameLift::GenericOutcome Connect(const Uri &uri) = 0;
-    virtual Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const std::string &message) = 0;
+    // requestId is the Message::GetRequestIdValue() of the serialized message.
+    virtual ResponseOutcome SendSocketMessage(uint64_t requestId, const std::string &message) = 0;
     virtual void Disconnect() = 0;
-    virtual void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) = 0;
+    virtual void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<ResponseOutcome(std::string)> &callback) = 0;
     virtual bool IsConnected() = 0;
 
     virtual ~IWebSocketClientWrapper() = default;
@@ -0,0 +1,107 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/internal/network/GameLiftEventHandlers.h>
+#include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
+#include <aws/gamelift/internal/network/WebSocketFrameRecorder.h>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Fake transport that feeds a capture written by WebSocketFrameRecorder back through the SDK
+ * instead of talking to Amazon GameLift Servers.
+ *
+ * - Messages pushed by the service (CreateGameSession, RefreshConnection, TerminateProcess...)
+ *   are dispatched to the registered callbacks on a replay thread, keeping the recorded spacing
+ *   between frames divided by the replay speed.
+ * - Requests sent by the SDK are answered with the recorded response to the next recorded
+ *   request of the same action, so request IDs generated during replay do not need to match.
+ *
+ * On disconnect it logs the dispatch lag of the pushes, the process CPU time spent during the
+ * replay and the thread count of the process at connect and at its peak.
+ *
+ * Only the frames of one connection are replayed: the one named by GAMELIFT_SDK_REPLAY_CONNECTION_ID,
+ * or else the first one in the capture, which is the process-wide connection. Logical server
+ * processes record their frames into the same capture under their own process IDs.
+ *
+ * InitSDK selects this wrapper when GAMELIFT_SDK_REPLAY_FILE is set. The usual GAMELIFT_SDK_*
+ * environment variables still need placeholder values to pass InitSDK validation.
+ */
+class ReplayWebSocketClientWrapper : public IWebSocketClientWrapper {
+public:
+    static constexpr const char *ENV_VAR_REPLAY_FILE = "GAMELIFT_SDK_REPLAY_FILE";
+    static constexpr const char *ENV_VAR_REPLAY_SPEED = "GAMELIFT_SDK_REPLAY_SPEED";
+    static constexpr const char *ENV_VAR_REPLAY_CONNECTION_ID = "GAMELIFT_SDK_REPLAY_CONNECTION_ID";
+
+    // Reads the capture path, replay speed and connection ID from the environment.
+    ReplayWebSocketClientWrapper();
+    // An empty connectionId replays the first connection in the capture.
+    ReplayWebSocketClientWrapper(const std::string &capturePath, double replaySpeed = 1.0, const std::string &connectionId = "");
+
+    Aws::GameLift::GenericOutcome Connect(const Uri &uri) override;
+    ResponseOutcome SendSocketMessage(uint64_t requestId, const std::string &message) override;
+    void Disconnect() override;
+    void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<ResponseOutcome(std::string)> &callback) override;
+    bool IsConnected() override;
+
+    ~ReplayWebSocketClientWrapper();
+
+private:
+    const int OK_STATUS_CODE = 200;
+
+    bool LoadCapture();
+    void ReplayUnsolicitedFrames();
+    ResponseOutcome Dispatch(const std::string &message);
+    void StopReplayThread();
+    // Records the peak thread count; called after every replayed frame. Caller holds m_lock.
+    void SampleThreadCount();
+
+    std::string m_capturePath;
+    double m_replaySpeed;
+    std::string m_connectionId;
+    bool m_captureLoaded;
+    int64_t m_captureStartMicros;
+
+    // Recorded service responses, keyed by the action of the request that triggered them.
+    std::map<std::string, std::deque<std::string>> m_responsesByAction;
+    // Recorded service pushes, in capture order.
+    std::vector<CapturedWebSocketFrame> m_unsolicitedFrames;
+
+    std::mutex m_lock;
+    std::condition_variable m_cond;
+    bool m_connected;
+    bool m_stopRequested;
+    std::unique_ptr<std::thread> m_replayThread;
+    GameLiftEventHandlers m_eventHandlers;
+
+    // Replay statistics, logged on disconnect.
+    int m_dispatchedPushCount;
+    int m_answeredRequestCount;
+    int m_unansweredRequestCount;
+    int64_t m_maxDispatchLagMicros;
+    int64_t m_connectCpuMicros;
+    int m_connectThreadCount;
+    int m_peakThreadCount;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,125 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/common/Outcome.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Move-only holder for a deserialized websocket response, stored inline rather than on the heap.
+ *
+ * Callbacks deserialize the response directly into the holder, which is then moved through the
+ * request promise to the thread waiting on the response. The caller reads it back with Get<T>(),
+ * which returns nullptr when the holder is empty or contains a different response type.
+ */
+class ResponsePayload {
+public:
+    // Large enough for every WebSocket*Response, enforced in Emplace().
+    static constexpr const size_t INLINE_CAPACITY = 512;
+
+    ResponsePayload() : m_operations(nullptr) {}
+
+    ResponsePayload(ResponsePayload &&other) : m_operations(nullptr) { MoveFrom(other); }
+
+    ResponsePayload &operator=(ResponsePayload &&other) {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    ResponsePayload(const ResponsePayload &) = delete;
+    ResponsePayload &operator=(const ResponsePayload &) = delete;
+
+    ~ResponsePayload() { Reset(); }
+
+    /**
+     * Destroys any held response and default-constructs a T in the inline storage.
+     */
+    template <typename T> T &Emplace() {
+        static_assert(sizeof(T) <= INLINE_CAPACITY, "Response type does not fit into ResponsePayload::INLINE_CAPACITY");
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Response type is over-aligned for ResponsePayload");
+        static_assert(std::is_move_constructible<T>::value, "Response type must be movable");
+
+        Reset();
+        T *value = new (m_storage) T();
+        m_operations = &Operations<T>::Table;
+        return *value;
+    }
+
+    template <typename T> T *Get() { return Holds<T>() ? reinterpret_cast<T *>(m_storage) : nullptr; }
+
+    template <typename T> const T *Get() const { return Holds<T>() ? reinterpret_cast<const T *>(m_storage) : nullptr; }
+
+    template <typename T> bool Holds() const { return m_operations == &Operations<T>::Table; }
+
+    bool IsEmpty() const { return m_operations == nullptr; }
+
+    void Reset() {
+        if (m_operations != nullptr) {
+            m_operations->destroy(m_storage);
+            m_operations = nullptr;
+        }
+    }
+
+private:
+    // Per-type destroy/move entry points; the table address doubles as the type tag. Tables are
+    // deliberately non-const so identical-COMDAT folding can never merge two types' tags.
+    struct OperationTable {
+        void (*destroy)(void *storage);
+        void (*move)(void *from, void *to);
+    };
+
+    template <typename T> struct Operations {
+        static void Destroy(void *storage) { reinterpret_cast<T *>(storage)->~T(); }
+
+        static void Move(void *from, void *to) {
+            T *source = reinterpret_cast<T *>(from);
+            new (to) T(std::move(*source));
+            source->~T();
+        }
+
+        static OperationTable Table;
+    };
+
+    void MoveFrom(ResponsePayload &other) {
+        if (other.m_operations != nullptr) {
+            other.m_operations->move(other.m_storage, m_storage);
+            m_operations = other.m_operations;
+            other.m_operations = nullptr;
+        }
+    }
+
+    const OperationTable *m_operations;
+    alignas(std::max_align_t) unsigned char m_storage[INLINE_CAPACITY];
+};
+
+template <typename T> ResponsePayload::OperationTable ResponsePayload::Operations<T>::Table = {&ResponsePayload::Operations<T>::Destroy,
+                                                                                              &ResponsePayload::Operations<T>::Move};
+
+/**
+ * Outcome of a websocket request. Successful outcomes carry the typed response in place, if the
+ * action has a response callback registered, or an empty payload otherwise.
+ */
+typedef Outcome<ResponsePayload, GameLiftError> ResponseOutcome;
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
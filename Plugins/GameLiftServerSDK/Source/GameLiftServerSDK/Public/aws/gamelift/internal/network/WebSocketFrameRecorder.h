@@ -0,0 +1,87 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+enum class WebSocketFrameDirection : uint8_t { INBOUND = 0, OUTBOUND = 1 };
+
+/**
+ * A single websocket frame read back from a capture file.
+ */
+struct CapturedWebSocketFrame {
+    int64_t timestampMicros;
+    WebSocketFrameDirection direction;
+    // The process ID the frame's connection registered, empty in version 1 captures.
+    std::string connectionId;
+    std::string payload;
+};
+
+/**
+ * Writes every inbound and outbound websocket frame to a compact binary capture file so that
+ * control-plane traffic can be replayed offline through ReplayWebSocketClientWrapper.
+ *
+ * Capture layout (all integers little-endian):
+ * - Header: 4 byte magic "GLWC", uint16 format version.
+ * - Records: int64 wall-clock timestamp in microseconds, uint8 direction, uint16 connection ID
+ *   length, the connection ID bytes, uint32 payload length, followed by the raw payload bytes.
+ *   Version 1 records have no connection ID.
+ *
+ * One recorder serves every connection of a websocketpp client, including those of logical server
+ * processes, which tell their frames apart by connection ID. The file is opened in append mode so
+ * that a capture survives the websocket client being re-created during reconnects. Captures contain
+ * auth tokens and credentials sent by Amazon GameLift Servers and must be handled as secrets.
+ */
+class WebSocketFrameRecorder {
+public:
+    // Recording is opt-in and enabled by pointing this environment variable at a capture file.
+    static constexpr const char *ENV_VAR_CAPTURE_FILE = "GAMELIFT_SDK_CAPTURE_FILE";
+
+    WebSocketFrameRecorder() = default;
+    ~WebSocketFrameRecorder();
+
+    WebSocketFrameRecorder(const WebSocketFrameRecorder &) = delete;
+    WebSocketFrameRecorder &operator=(const WebSocketFrameRecorder &) = delete;
+
+    bool Open(const std::string &capturePath);
+    void Close();
+    bool IsOpen() const { return m_captureFile.is_open(); }
+
+    void Record(WebSocketFrameDirection direction, const std::string &connectionId, const std::string &payload);
+
+    /**
+     * Reads all frames from the given capture file, in the order they were recorded.
+     * Returns false if the file is missing, has an unknown header, or is truncated mid-record.
+     */
+    static bool ReadCapture(const std::string &capturePath, std::vector<CapturedWebSocketFrame> &frames);
+
+private:
+    static constexpr const char *CAPTURE_MAGIC = "GLWC";
+    static constexpr const size_t CAPTURE_MAGIC_LENGTH = 4;
+    static constexpr const uint16_t CAPTURE_VERSION = 2;
+    static constexpr const uint16_t CAPTURE_VERSION_WITHOUT_CONNECTION_ID = 1;
+
+    std::mutex m_captureLock;
+    std::ofstream m_captureFile;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
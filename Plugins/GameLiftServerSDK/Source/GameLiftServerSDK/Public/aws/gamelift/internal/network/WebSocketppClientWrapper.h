@@ -11,9 +11,13 @@
  */
 #pragma once
 
+#include <aws/gamelift/internal/network/GameLiftEventHandlers.h>
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
+#include <aws/gamelift/internal/network/WebSocketFrameRecorder.h>
 #include <condition_variable>
+#include <memory>
 #include <thread>
+#include <unordered_map>
 #include <websocketpp/client.hpp>
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic push
@@ -29,20 +33,61 @@ namespace GameLift {
 namespace Internal {
 typedef websocketpp::client<websocketpp::config::asio_tls_client> WebSocketppClientType;
 
+/**
+ * A websocketpp client together with the socket threads that run it, the TLS context its
+ * connections use and the frame recorder they write to. Several WebSocketppClientWrappers may share
+ * one, e.g. the logical server processes of a multi-session server, so they all run on the same two
+ * threads and record into one capture.
+ */
+class WebSocketppClientContext {
+public:
+    // The last reference may be released by a handler running on one of the socket threads, which the
+    // destructor joins. The context is then destroyed on a thread of its own instead.
+    static std::shared_ptr<WebSocketppClientContext> Create(std::shared_ptr<WebSocketppClientType> webSocketClient);
+
+    WebSocketppClientContext(const WebSocketppClientContext &) = delete;
+    WebSocketppClientContext &operator=(const WebSocketppClientContext &) = delete;
+
+    const std::shared_ptr<WebSocketppClientType> &GetClient() const { return m_webSocketClient; }
+
+    // Null unless WebSocketFrameRecorder::ENV_VAR_CAPTURE_FILE is set.
+    WebSocketFrameRecorder *GetFrameRecorder() const { return m_frameRecorder.get(); }
+
+private:
+    explicit WebSocketppClientContext(std::shared_ptr<WebSocketppClientType> webSocketClient);
+    ~WebSocketppClientContext();
+
+    bool IsSocketThread() const;
+
+    websocketpp::lib::shared_ptr<asio::ssl::context> OnTlsInit(websocketpp::connection_hdl hdl);
+
+    std::shared_ptr<WebSocketppClientType> m_webSocketClient;
+    std::unique_ptr<std::thread> m_socket_thread_1;
+    std::unique_ptr<std::thread> m_socket_thread_2;
+    std::mutex m_tlsContextLock;
+    websocketpp::lib::shared_ptr<asio::ssl::context> m_tlsContext;
+    std::unique_ptr<WebSocketFrameRecorder> m_frameRecorder;
+};
+
 /**
  * Implementation of a WebSocketClientWrapper for the Websocketpp Library.
  * https://github.com/zaphoyd/websocketpp
  */
-class WebSocketppClientWrapper : public IWebSocketClientWrapper {
+class WebSocketppClientWrapper : public IWebSocketClientWrapper, public std::enable_shared_from_this<WebSocketppClientWrapper> {
 public:
     WebSocketppClientWrapper(std::shared_ptr<WebSocketppClientType> webSocketClient);
+    // Connects through a client shared with other wrappers. Must be owned by a std::shared_ptr.
+    WebSocketppClientWrapper(std::shared_ptr<WebSocketppClientContext> clientContext);
 
     Aws::GameLift::GenericOutcome Connect(const Uri &uri) override;
-    Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const std::string &message) override;
+    ResponseOutcome SendSocketMessage(uint64_t requestId, const std::string &message) override;
     void Disconnect() override;
-    void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) override;
+    void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<ResponseOutcome(std::string)> &callback) override;
     bool IsConnected() override;
 
+    // The client, threads and TLS context this wrapper connects through, for sharing them.
+    const std::shared_ptr<WebSocketppClientContext> &GetClientContext() const { return m_clientContext; }
+
     ~WebSocketppClientWrapper();
 
 private:
@@ -53,10 +98,9 @@ private:
     const int WAIT_FOR_RECONNECT_MAX_RETRIES = 180 / WAIT_FOR_RECONNECT_RETRY_DELAY_SECONDS; // retry up to 3 minutes
 
     // The WebSocketpp objects this class wraps
+    std::shared_ptr<WebSocketppClientContext> m_clientContext;
     std::shared_ptr<WebSocketppClientType> m_webSocketClient;
     WebSocketppClientType::connection_ptr m_connection;
-    std::unique_ptr<std::thread> m_socket_thread_1;
-    std::unique_ptr<std::thread> m_socket_thread_2;
 
     // synchronization variables
     std::mutex m_lock;
@@ -65,11 +109,16 @@ private:
     websocketpp::lib::error_code m_fail_error_code;
     websocketpp::http::status_code::value m_fail_response_code;
 
-    std::map<std::string, std::function<GenericOutcome(std::string)>> m_eventHandlers;
+    GameLiftEventHandlers m_eventHandlers;
     std::mutex m_requestToPromiseLock;
-    std::map<std::string, std::promise<GenericOutcome>> m_requestIdToPromise;
+    std::unordered_map<uint64_t, std::promise<ResponseOutcome>> m_requestIdToPromise;
     Uri m_uri;
 
+    // Opt-in capture of all frames, see WebSocketFrameRecorder::ENV_VAR_CAPTURE_FILE. Owned by the
+    // context; frames are recorded under the process ID this wrapper connected with.
+    WebSocketFrameRecorder *m_frameRecorder;
+    std::string m_connectionId;
+
     // Helper methods
     WebSocketppClientType::connection_ptr PerformConnect(const Uri &uri, websocketpp::lib::error_code &error);
     Aws::GameLift::GenericOutcome SendSocketMessageAsync(const std::string &message);
@@ -77,7 +126,6 @@ private:
     // CallBacks
     void OnConnected(websocketpp::connection_hdl connection);
     void OnMessage(websocketpp::connection_hdl connection, websocketpp::config::asio_client::message_type::ptr msgPtr);
-    websocketpp::lib::shared_ptr<asio::ssl::context> OnTlsInit(websocketpp::connection_hdl hdl);
     void OnClose(websocketpp::connection_hdl connection);
     void OnError(websocketpp::connection_hdl connection);
     void OnInterrupt(websocketpp::connection_hdl connection);
@@ -12,8 +12,8 @@
 
 #pragma once
 
-#include <aws/gamelift/common/Outcome.h>
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/network/ResponseOutcome.h>
 
 namespace Aws {
 namespace GameLift {
@@ -28,7 +28,7 @@ public:
     ~DescribePlayerSessionsCallback() = default;
 
     // Methods
-    GenericOutcome OnDescribePlayerSessions(const std::string &data);
+    ResponseOutcome OnDescribePlayerSessions(const std::string &data);
 
     static constexpr const char *DESCRIBE_PLAYER_SESSIONS = "DescribePlayerSessions";
 };
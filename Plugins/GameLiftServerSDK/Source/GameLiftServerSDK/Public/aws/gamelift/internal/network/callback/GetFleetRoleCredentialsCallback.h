@@ -12,8 +12,8 @@
 
 #pragma once
 
-#include <aws/gamelift/common/Outcome.h>
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/network/ResponseOutcome.h>
 
 namespace Aws {
 namespace GameLift {
@@ -29,7 +29,7 @@ public:
     ~GetFleetRoleCredentialsCallback() = default;
 
     // Methods
-    GenericOutcome OnGetFleetRoleCredentials(const std::string &data);
+    ResponseOutcome OnGetFleetRoleCredentials(const std::string &data);
 
     static constexpr const char *GET_FLEET_ROLE_CREDENTIALS = "GetFleetRoleCredentials";
 };
@@ -25,9 +25,28 @@ class AwsSigV4Utility {
 public:
     static Aws::GameLift::Outcome<std::map<std::string, std::string>, std::string> GenerateSigV4QueryParameters(const SigV4Parameters &parameters);
 
+    /**
+     * @brief Signs an HTTP request in its Authorization header, as the Amazon GameLift Servers control plane API expects.
+     *
+     * @param parameters Region, credentials and request time. QueryParams holds the request's query string and may be empty.
+     * @param httpMethod The request method, such as "POST".
+     * @param path The absolute request path, such as "/".
+     * @param headers Every header to sign, including "host". Names are case-insensitive.
+     * @param payload The request body.
+     * @return The headers to add to the request: X-Amz-Date, X-Amz-Security-Token if there is a session token, and Authorization.
+     */
+    static Aws::GameLift::Outcome<std::map<std::string, std::string>, std::string> GenerateSigV4Headers(
+            const SigV4Parameters &parameters,
+            const std::string &httpMethod,
+            const std::string &path,
+            const std::map<std::string, std::string> &headers,
+            const std::string &payload);
+
 private:
     static void ValidateParameters(const SigV4Parameters &parameters);
 
+    static void ValidateCredentialParameters(const SigV4Parameters &parameters);
+
     static std::string GenerateSignature(
             const std::string &region,
             const std::string &secretKey,
@@ -75,7 +94,6 @@ private:
 
     static constexpr const char *DateFormat = "%Y%m%d";
     static constexpr const char *DateTimeFormat = "%Y%m%dT%H%M%SZ";
-    static constexpr const char *ServiceName = "gamelift";
     static constexpr const char *TerminationString = "aws4_request";
     static constexpr const char *SignatureSecretKeyPrefix = "AWS4";
     static constexpr const char *Algorithm = "AWS4-HMAC-SHA256";
@@ -24,12 +24,15 @@ struct SigV4Parameters {
     AwsCredentials Credentials;
     std::map <std::string, std::string> QueryParams;
     std::tm RequestTime;
+    // The service in the credential scope. Only tests sign for anything other than Amazon GameLift Servers.
+    std::string ServiceName;
 
     SigV4Parameters(const std::string &awsRegion, const class AwsCredentials &awsCredentials,
-                    const std::map <std::string, std::string> &queryParams, const tm &requestTime)
+                    const std::map <std::string, std::string> &queryParams, const tm &requestTime,
+                    const std::string &serviceName = "gamelift")
             :
             AwsRegion(awsRegion), Credentials(awsCredentials), QueryParams(queryParams),
-            RequestTime(requestTime) {}
+            RequestTime(requestTime), ServiceName(serviceName) {}
 };
 } // namespace Internal
 } // namespace GameLift
@@ -11,6 +11,7 @@
  */
 #pragma once
 
+#include <stddef.h>
 #include <string>
 
 namespace Aws {
@@ -19,7 +20,15 @@ namespace Internal {
 
 class GuidGenerator {
 public:
+    // Length of a GUID such as "123e4567-e89b-42d3-a456-426614174000".
+    static constexpr size_t GUID_LENGTH = 36;
+
     static std::string GenerateGuid();
+
+    /**
+     * Writes a random version 4 GUID in lowercase hex, followed by a null terminator.
+     */
+    static void GenerateGuid(char (&buffer)[GUID_LENGTH + 1]);
 };
 
 } // namespace Internal
@@ -27,6 +27,16 @@ namespace Internal {
 // Simple Utility Class with some methods to help with json parsing
 class JsonHelper {
 public:
+    // Returns the value of the member named key, or nullptr if value has no such member.
+    static const rapidjson::Value *FindMember(const rapidjson::Value &value, const char *key);
+
+    // Converters for a member value that was already looked up; value may be nullptr.
+    static std::string DeserializeString(const rapidjson::Value *value);
+    static int DeserializeInt(const rapidjson::Value *value);
+    static int64_t DeserializeInt64(const rapidjson::Value *value);
+    static bool DeserializeBool(const rapidjson::Value *value);
+    static Aws::GameLift::Server::LogParameters DeserializeLogParameters(const rapidjson::Value *value);
+
     static std::string SafelyDeserializeString(const rapidjson::Value &value, const char *key);
     static void WriteNonEmptyString(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, const std::string &value);
 
@@ -0,0 +1,83 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+// Counters the SDK reports to the host's profiler.
+enum class TraceCounter {
+    // Requests sent to GameLift that have not been answered or timed out yet.
+    REQUESTS_IN_FLIGHT,
+    // Open websockets to GameLift, one per server process registered by this process.
+    CONNECTED,
+    // Connections re-established after an abnormal closure or failed sends.
+    RECONNECTS,
+    // The result of the last health check, 1 for healthy.
+    HEALTHY
+};
+
+/**
+ * Hooks into the profiler of the engine the SDK is built into. The Unreal module defines
+ * GAMELIFT_USE_UE_TRACE and implements these on its "GameLift" trace channel, see
+ * GameLiftServerSDKTrace.h; elsewhere they compile to nothing. Scope names must outlive the
+ * program, e.g. string literals.
+ */
+#ifdef GAMELIFT_USE_UE_TRACE
+class TraceScope {
+public:
+    explicit TraceScope(const char *name);
+    ~TraceScope();
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+
+private:
+    bool m_active;
+};
+
+void TraceCounterAdd(TraceCounter counter, int64_t delta);
+void TraceCounterSet(TraceCounter counter, int64_t value);
+#else
+class TraceScope {
+public:
+    explicit TraceScope(const char *) {}
+};
+
+inline void TraceCounterAdd(TraceCounter, int64_t) {}
+inline void TraceCounterSet(TraceCounter, int64_t) {}
+#endif
+
+// Adds 1 to a counter for as long as it lives.
+class TraceCounterScope {
+public:
+    explicit TraceCounterScope(TraceCounter counter) : m_counter(counter) { TraceCounterAdd(m_counter, 1); }
+    ~TraceCounterScope() { TraceCounterAdd(m_counter, -1); }
+
+    TraceCounterScope(const TraceCounterScope &) = delete;
+    TraceCounterScope &operator=(const TraceCounterScope &) = delete;
+
+private:
+    TraceCounter m_counter;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
+
+#define GAMELIFT_TRACE_CONCAT_INNER(a, b) a##b
+#define GAMELIFT_TRACE_CONCAT(a, b) GAMELIFT_TRACE_CONCAT_INNER(a, b)
+// Times the rest of the enclosing scope as a CPU event.
+#define GAMELIFT_TRACE_SCOPE(name) ::Aws::GameLift::Internal::TraceScope GAMELIFT_TRACE_CONCAT(gameLiftTraceScope, __LINE__)(name)
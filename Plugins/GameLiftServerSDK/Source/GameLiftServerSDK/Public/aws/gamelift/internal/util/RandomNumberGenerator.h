@@ -0,0 +1,35 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Fast per-thread source of random numbers for identifiers.
+ *
+ * Each thread owns a xoshiro256** generator seeded once from std::random_device, which reads the
+ * operating system's cryptographic source. Later draws never touch the random device, so they
+ * cost a few arithmetic instructions and need no locking. The output is unpredictable enough
+ * for request IDs, idempotency tokens and GUIDs but must not be used for secrets.
+ */
+class RandomNumberGenerator {
+public:
+    static uint64_t Next();
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -11,6 +11,7 @@
  */
 #pragma once
 
+#include <stddef.h>
 #include <string>
 
 namespace Aws {
@@ -20,6 +21,12 @@ namespace Internal {
 class RandomStringGenerator {
 public:
     static std::string GenerateRandomAlphaNumericString(const int stringLength);
+
+    /**
+     * Fills buffer with length uniformly distributed characters from [0-9A-Za-z]. No null
+     * terminator is written.
+     */
+    static void GenerateRandomAlphaNumeric(char *buffer, size_t length);
 };
 
 } // namespace Internal
@@ -64,6 +64,9 @@ Game-property-dependent initialization (such as loading a user-requested map) sh
 that time. The onHealthCheck callback is invoked asynchronously. There is no mechanism to to destroy
 the resulting thread. If it does not complete in a given time period the server status will be
 reported as unhealthy.
+To reuse the process once its game session is over, end it with ProcessEnding() first; this SDK then
+accepts ProcessReady() again on the same connection. Whether the fleet takes the process back is up to
+the service, so be prepared to end the process if this fails.
 @param processParameters The parameters required to successfully run the process.
 */
 AWS_GAMELIFT_API GenericOutcome ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters);
@@ -169,6 +172,9 @@ Game-property-dependent initialization (such as loading a user-requested map) sh
 that time. The onHealthCheck callback is invoked asynchronously. There is no mechanism to to destroy
 the resulting thread. If it does not complete in a given time period the server status will be
 reported as unhealthy.
+To reuse the process once its game session is over, end it with ProcessEnding() first; this SDK then
+accepts ProcessReady() again on the same connection. Whether the fleet takes the process back is up to
+the service, so be prepared to end the process if this fails.
 @param processParameters The parameters required to successfully run the process.
 */
 AWS_GAMELIFT_API GenericOutcome ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters);
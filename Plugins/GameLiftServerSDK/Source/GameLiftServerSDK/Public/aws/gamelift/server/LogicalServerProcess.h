@@ -0,0 +1,94 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/common/GameLiftErrors.h>
+#include <aws/gamelift/common/GameLift_EXPORTS.h>
+#include <aws/gamelift/common/Outcome.h>
+
+#include <aws/gamelift/server/ProcessParameters.h>
+#include <aws/gamelift/server/model/PlayerSessionCreationPolicy.h>
+#include <aws/gamelift/server/model/ServerParameters.h>
+
+/* A LogicalServerProcess lets one OS process host several game sessions at once. Amazon GameLift Servers
+ * places one game session per server process, so the OS process registers one extra server process per
+ * additional session it can host. The process-wide API in GameLiftServerAPI.h remains the first of them. */
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+class GameLiftServerState;
+}
+namespace Server {
+
+class LogicalServerProcess;
+
+typedef Aws::GameLift::Outcome<LogicalServerProcess *, GameLiftError> CreateLogicalServerProcessOutcome;
+
+class AWS_GAMELIFT_API LogicalServerProcess {
+public:
+    /**
+    Registers an additional server process for this OS process. Must be called after InitSDK(); the new
+    process shares its websocket threads and TLS context and opens a connection of its own.
+    @param serverParameters the parameters InitSDK() was called with.
+    @param processIdSuffix appended to the resolved process ID; must be unique within the OS process.
+    @return The new process, owned by the caller. Delete it to disconnect, after ProcessEnding().
+    */
+    static CreateLogicalServerProcessOutcome Create(const Aws::GameLift::Server::Model::ServerParameters &serverParameters, const char *processIdSuffix);
+
+    ~LogicalServerProcess();
+
+    LogicalServerProcess(const LogicalServerProcess &) = delete;
+    LogicalServerProcess &operator=(const LogicalServerProcess &) = delete;
+
+    /**
+    Reports this process as ready to host a game session, see Server::ProcessReady(). May be called
+    again after its game session ends.
+    */
+    GenericOutcome ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters);
+
+    /**
+    Reports this process as shutting down, see Server::ProcessEnding().
+    */
+    GenericOutcome ProcessEnding();
+
+    /**
+    Reports that this process's game session is ready for players, see Server::ActivateGameSession().
+    */
+    GenericOutcome ActivateGameSession();
+
+    GenericOutcome UpdatePlayerSessionCreationPolicy(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy);
+
+    /**
+    @return The GameSession Id bound to this process, if it is Active.
+    */
+    AwsStringOutcome GetGameSessionId();
+
+#ifdef GAMELIFT_USE_STD
+    GenericOutcome AcceptPlayerSession(const std::string &playerSessionId);
+
+    GenericOutcome RemovePlayerSession(const std::string &playerSessionId);
+#else
+    GenericOutcome AcceptPlayerSession(const char *playerSessionId);
+
+    GenericOutcome RemovePlayerSession(const char *playerSessionId);
+#endif
+
+private:
+    explicit LogicalServerProcess(Aws::GameLift::Internal::GameLiftServerState *serverState);
+
+    Aws::GameLift::Internal::GameLiftServerState *m_serverState;
+};
+
+} // namespace Server
+} // namespace GameLift
+} // namespace Aws
@@ -21,8 +21,8 @@ namespace Aws {
 namespace GameLift {
 namespace Server {
 #ifndef GAMELIFT_USE_STD
-typedef void (*StartGameSessionFn)(Aws::GameLift::Server::Model::GameSession, void *);
-typedef void (*UpdateGameSessionFn)(Aws::GameLift::Server::Model::UpdateGameSession, void *);
+typedef void (*StartGameSessionFn)(const Aws::GameLift::Server::Model::GameSession &, void *);
+typedef void (*UpdateGameSessionFn)(const Aws::GameLift::Server::Model::UpdateGameSession &, void *);
 typedef void (*ProcessTerminateFn)(void *);
 typedef bool (*HealthCheckFn)(void *);
 #endif
@@ -79,7 +79,7 @@ public:
                       HealthCheckFn onHealthCheck, void *healthCheckState, int port, const Aws::GameLift::Server::LogParameters logParameters)
         :
 
-          m_onStartGameSession(onStartGameSession), m_onUpdateGameSession([](Aws::GameLift::Server::Model::UpdateGameSession, void *) {}),
+          m_onStartGameSession(onStartGameSession), m_onUpdateGameSession([](const Aws::GameLift::Server::Model::UpdateGameSession &, void *) {}),
           m_onProcessTerminate(onProcessTerminate), m_onHealthCheck(onHealthCheck), m_startGameSessionState(startGameSessionState),
           m_updateGameSessionState(nullptr), m_processTerminateState(processTerminateState), m_healthCheckState(healthCheckState), m_port(port),
           m_logParameters(logParameters) {}
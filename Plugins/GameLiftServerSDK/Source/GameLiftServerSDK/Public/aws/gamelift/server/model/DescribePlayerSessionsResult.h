@@ -125,7 +125,7 @@ public:
      * matches the request.</p>
      */
     inline DescribePlayerSessionsResult &AddPlayerSession(PlayerSession &&value) {
-        m_playerSessions.push_back(value);
+        m_playerSessions.push_back(std::move(value));
         return *this;
     }
 
@@ -192,39 +192,48 @@ private:
     std::string m_nextToken;
 #else
 public:
-    DescribePlayerSessionsResult() {
-        memset(m_nextToken, 0, sizeof(m_nextToken));
-        m_playerSessions_count = 0;
-    }
+    DescribePlayerSessionsResult() : m_playerSessions(nullptr), m_playerSessions_count(0), m_playerSessions_capacity(0), m_nextToken(StringPool::EMPTY) {}
 
     /**
      * <p>Destructor.</p>
      */
-    ~DescribePlayerSessionsResult() {}
+    ~DescribePlayerSessionsResult() { delete[] m_playerSessions; }
 
     /**
      * <p>Copy Constructor.</p>
      */
-    DescribePlayerSessionsResult(const DescribePlayerSessionsResult &other) : m_playerSessions_count(other.m_playerSessions_count) {
-        strncpy(m_nextToken, other.m_nextToken, sizeof(other.m_nextToken));
-
-        std::copy(std::begin(other.m_playerSessions), std::end(other.m_playerSessions), std::begin(m_playerSessions));
+    DescribePlayerSessionsResult(const DescribePlayerSessionsResult &other)
+        : m_playerSessions(nullptr), m_playerSessions_count(0), m_playerSessions_capacity(0), m_nextToken(StringPool::EMPTY) {
+        *this = other;
     }
 
     /**
      * <p>Move Constructor.</p>
      */
-    DescribePlayerSessionsResult(DescribePlayerSessionsResult &&other) { *this = std::move(other); }
+    DescribePlayerSessionsResult(DescribePlayerSessionsResult &&other)
+        : m_playerSessions(nullptr), m_playerSessions_count(0), m_playerSessions_capacity(0), m_nextToken(StringPool::EMPTY) {
+        *this = std::move(other);
+    }
 
     /**
      * <p>Copy assignment Constructor.</p>
      */
     DescribePlayerSessionsResult &operator=(const DescribePlayerSessionsResult &other) {
-        m_playerSessions_count = other.m_playerSessions_count;
-
-        strncpy(m_nextToken, other.m_nextToken, sizeof(other.m_nextToken));
+        if (this == &other) {
+            return *this;
+        }
+        m_strings = other.m_strings;
+        m_nextToken = other.m_nextToken;
 
-        std::copy(std::begin(other.m_playerSessions), std::end(other.m_playerSessions), std::begin(m_playerSessions));
+        delete[] m_playerSessions;
+        m_playerSessions = nullptr;
+        m_playerSessions_count = 0;
+        m_playerSessions_capacity = 0;
+        ReservePlayerSessions(other.m_playerSessions_count);
+        for (int i = 0; i < other.m_playerSessions_count; i++) {
+            m_playerSessions[i] = other.m_playerSessions[i];
+        }
+        m_playerSessions_count = other.m_playerSessions_count;
 
         return *this;
     }
@@ -233,16 +242,21 @@ public:
      * <p>Move assignment Constructor.</p>
      */
     DescribePlayerSessionsResult &operator=(DescribePlayerSessionsResult &&other) {
-        m_playerSessions_count = other.m_playerSessions_count;
-
-        strncpy(m_nextToken, other.m_nextToken, sizeof(other.m_nextToken));
+        if (this == &other) {
+            return *this;
+        }
+        m_strings = std::move(other.m_strings);
+        m_nextToken = other.m_nextToken;
 
-        std::copy(std::begin(other.m_playerSessions), std::end(other.m_playerSessions), std::begin(m_playerSessions));
+        delete[] m_playerSessions;
+        m_playerSessions = other.m_playerSessions;
+        m_playerSessions_count = other.m_playerSessions_count;
+        m_playerSessions_capacity = other.m_playerSessions_capacity;
 
+        other.m_playerSessions = nullptr;
         other.m_playerSessions_count = 0;
-
-        memset(other.m_nextToken, 0, sizeof(other.m_nextToken));
-        memset(other.m_playerSessions, 0, sizeof(other.m_playerSessions));
+        other.m_playerSessions_capacity = 0;
+        other.m_nextToken = StringPool::EMPTY;
 
         return *this;
     }
@@ -261,16 +275,38 @@ public:
      */
     inline void AddPlayerSession(PlayerSession playerSession) {
         if (m_playerSessions_count < MAX_PLAYER_SESSIONS) {
-            m_playerSessions[m_playerSessions_count++] = playerSession;
+            if (m_playerSessions_count == m_playerSessions_capacity) {
+                ReservePlayerSessions(m_playerSessions_capacity == 0 ? 4 : m_playerSessions_capacity * 2);
+            }
+            m_playerSessions[m_playerSessions_count++] = std::move(playerSession);
         }
     };
 
+    /**
+     * <p>Preallocates room for count player sessions, up to MAX_PLAYER_SESSIONS.</p>
+     */
+    inline void ReservePlayerSessions(int count) {
+        if (count > MAX_PLAYER_SESSIONS) {
+            count = MAX_PLAYER_SESSIONS;
+        }
+        if (count <= m_playerSessions_capacity) {
+            return;
+        }
+        PlayerSession *playerSessions = new PlayerSession[count];
+        for (int i = 0; i < m_playerSessions_count; i++) {
+            playerSessions[i] = std::move(m_playerSessions[i]);
+        }
+        delete[] m_playerSessions;
+        m_playerSessions = playerSessions;
+        m_playerSessions_capacity = count;
+    }
+
     /**
      * <p>Collection of objects containing properties for each player session that
      * matches the request.</p>
      */
     inline DescribePlayerSessionsResult &WithPlayerSessions(PlayerSession playerSession) {
-        AddPlayerSession(playerSession);
+        AddPlayerSession(std::move(playerSession));
         return *this;
     }
 
@@ -279,17 +315,14 @@ public:
      * action. If no token is returned, these results represent the end of the
      * list.</p>
      */
-    inline const char *GetNextToken() const { return m_nextToken; }
+    inline const char *GetNextToken() const { return m_strings.Get(m_nextToken); }
 
     /**
      * <p>Token indicating where to resume retrieving results on the next call to this
      * action. If no token is returned, these results represent the end of the
      * list.</p>
      */
-    inline void SetNextToken(const char *value) {
-        strncpy(m_nextToken, value, sizeof(m_nextToken));
-        m_nextToken[sizeof(m_nextToken) - 1] = 0;
-    }
+    inline void SetNextToken(const char *value) { m_nextToken = m_strings.Add(value, MAX_NEXT_TOKEN_LENGTH); }
 
     /**
      * <p>Token indicating where to resume retrieving results on the next call to this
@@ -302,9 +335,11 @@ public:
     }
 
 private:
-    PlayerSession m_playerSessions[MAX_PLAYER_SESSIONS];
+    PlayerSession *m_playerSessions;
     int m_playerSessions_count;
-    char m_nextToken[MAX_NEXT_TOKEN_LENGTH];
+    int m_playerSessions_capacity;
+    StringPool m_strings;
+    StringPool::Handle m_nextToken;
 #endif
 };
 
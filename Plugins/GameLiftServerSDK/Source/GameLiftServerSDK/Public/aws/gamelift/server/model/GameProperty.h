@@ -11,6 +11,7 @@
  */
 #pragma once
 #include <aws/gamelift/common/GameLift_EXPORTS.h>
+#include <aws/gamelift/server/model/StringPool.h>
 
 #ifndef GAMELIFT_USE_STD
 #ifndef MAX_KEY_LENGTH
@@ -124,10 +125,7 @@ private:
     std::string m_value;
 #else
 public:
-    GameProperty() {
-        memset(m_key, 0, MAX_KEY_LENGTH);
-        memset(m_value, 0, MAX_VALUE_LENGTH);
-    }
+    GameProperty() : m_key(StringPool::EMPTY), m_value(StringPool::EMPTY) {}
 
     /**
      * <p>Destructor.</p>
@@ -137,22 +135,23 @@ public:
     /**
      * <p>Copy Constructor.</p>
      */
-    GameProperty(const GameProperty &other) {
-        strncpy(m_key, other.m_key, sizeof(other.m_key));
-        strncpy(m_value, other.m_value, sizeof(other.m_value));
-    }
+    GameProperty(const GameProperty &other) : m_strings(other.m_strings), m_key(other.m_key), m_value(other.m_value) {}
 
     /**
      * <p>Move Constructor.</p>
      */
-    GameProperty(GameProperty &&other) { *this = std::move(other); }
+    GameProperty(GameProperty &&other) : m_strings(std::move(other.m_strings)), m_key(other.m_key), m_value(other.m_value) {
+        other.m_key = StringPool::EMPTY;
+        other.m_value = StringPool::EMPTY;
+    }
 
     /**
      * <p>Copy assignment Constructor.</p>
      */
     GameProperty &operator=(const GameProperty &other) {
-        strncpy(m_key, other.m_key, sizeof(other.m_key));
-        strncpy(m_value, other.m_value, sizeof(other.m_value));
+        m_strings = other.m_strings;
+        m_key = other.m_key;
+        m_value = other.m_value;
 
         return *this;
     }
@@ -161,33 +160,28 @@ public:
      * <p>Move assignment Constructor.</p>
      */
     GameProperty &operator=(GameProperty &&other) {
-        strncpy(m_key, other.m_key, sizeof(other.m_key));
-        strncpy(m_value, other.m_value, sizeof(other.m_value));
+        m_strings = std::move(other.m_strings);
+        m_key = other.m_key;
+        m_value = other.m_value;
 
-        memset(other.m_key, 0, MAX_KEY_LENGTH);
-        memset(other.m_value, 0, MAX_VALUE_LENGTH);
+        other.m_key = StringPool::EMPTY;
+        other.m_value = StringPool::EMPTY;
 
         return *this;
     }
 
-    inline const char *GetKey() const { return m_key; }
+    inline const char *GetKey() const { return m_strings.Get(m_key); }
 
-    inline void SetKey(const char *value) {
-        strncpy(m_key, value, sizeof(m_key));
-        m_key[sizeof(m_key) - 1] = 0;
-    }
+    inline void SetKey(const char *value) { m_key = m_strings.Add(value, MAX_KEY_LENGTH); }
 
     inline GameProperty &WithKey(const char *value) {
         SetKey(value);
         return *this;
     }
 
-    inline const char *GetValue() const { return m_value; }
+    inline const char *GetValue() const { return m_strings.Get(m_value); }
 
-    inline void SetValue(const char *value) {
-        strncpy(m_value, value, sizeof(m_value));
-        m_value[sizeof(m_value) - 1] = 0;
-    }
+    inline void SetValue(const char *value) { m_value = m_strings.Add(value, MAX_VALUE_LENGTH); }
 
     inline GameProperty &WithValue(const char *value) {
         SetValue(value);
@@ -195,8 +189,9 @@ public:
     }
 
 private:
-    char m_key[MAX_KEY_LENGTH];
-    char m_value[MAX_VALUE_LENGTH];
+    StringPool m_strings;
+    StringPool::Handle m_key;
+    StringPool::Handle m_value;
 #endif
 };
 
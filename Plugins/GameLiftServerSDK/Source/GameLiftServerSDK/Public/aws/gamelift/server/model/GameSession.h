@@ -19,7 +19,10 @@
 #include <aws/gamelift/common/GameLift_EXPORTS.h>
 #include <aws/gamelift/server/model/GameProperty.h>
 #include <aws/gamelift/server/model/GameSessionStatus.h>
+#include <aws/gamelift/server/model/MatchmakerData.h>
 #include <aws/gamelift/server/model/PlayerSessionCreationPolicy.h>
+#include <aws/gamelift/server/model/StringIndex.h>
+#include <aws/gamelift/server/model/StringPool.h>
 
 #ifndef GAMELIFT_USE_STD
 #ifndef MAX_GAME_PROPERTIES
@@ -73,7 +76,7 @@ public:
         : m_gameSessionId(other.m_gameSessionId), m_name(other.m_name), m_fleetId(other.m_fleetId),
           m_maximumPlayerSessionCount(other.m_maximumPlayerSessionCount), m_status(other.m_status), m_gameProperties(other.m_gameProperties),
           m_ipAddress(other.m_ipAddress), m_port(other.m_port), m_gameSessionData(other.m_gameSessionData), m_matchmakerData(other.m_matchmakerData),
-          m_dnsName(other.m_dnsName) {}
+          m_dnsName(other.m_dnsName), m_gamePropertyIndex(other.m_gamePropertyIndex), m_matchmakerDataModel(other.m_matchmakerDataModel) {}
 
     /**
      * <p>Move Constructor.</p>
@@ -82,7 +85,8 @@ public:
         : m_gameSessionId(std::move(other.m_gameSessionId)), m_name(std::move(other.m_name)), m_fleetId(std::move(other.m_fleetId)),
           m_maximumPlayerSessionCount(other.m_maximumPlayerSessionCount), m_status(std::move(other.m_status)),
           m_gameProperties(std::move(other.m_gameProperties)), m_ipAddress(std::move(other.m_ipAddress)), m_port(other.m_port),
-          m_gameSessionData(std::move(other.m_gameSessionData)), m_matchmakerData(std::move(other.m_matchmakerData)), m_dnsName(other.m_dnsName) {}
+          m_gameSessionData(std::move(other.m_gameSessionData)), m_matchmakerData(std::move(other.m_matchmakerData)), m_dnsName(other.m_dnsName),
+          m_gamePropertyIndex(std::move(other.m_gamePropertyIndex)), m_matchmakerDataModel(std::move(other.m_matchmakerDataModel)) {}
 
     /**
      * <p>Copy assignment Constructor.</p>
@@ -99,6 +103,8 @@ public:
         m_gameSessionData = other.m_gameSessionData;
         m_matchmakerData = other.m_matchmakerData;
         m_dnsName = other.m_dnsName;
+        m_gamePropertyIndex = other.m_gamePropertyIndex;
+        m_matchmakerDataModel = other.m_matchmakerDataModel;
 
         return *this;
     }
@@ -122,6 +128,8 @@ public:
         m_gameSessionData = std::move(other.m_gameSessionData);
         m_matchmakerData = std::move(other.m_matchmakerData);
         m_dnsName = std::move(other.m_dnsName);
+        m_gamePropertyIndex = std::move(other.m_gamePropertyIndex);
+        m_matchmakerDataModel = std::move(other.m_matchmakerDataModel);
         return *this;
     }
 
@@ -326,12 +334,18 @@ public:
     /**
      * <p>Set of custom properties for the game session.</p>
      */
-    inline void SetGameProperties(const std::vector<GameProperty> &value) { m_gameProperties = value; }
+    inline void SetGameProperties(const std::vector<GameProperty> &value) {
+        m_gameProperties = value;
+        ReindexGameProperties();
+    }
 
     /**
      * <p>Set of custom properties for the game session.</p>
      */
-    inline void SetGameProperties(std::vector<GameProperty> &&value) { m_gameProperties = value; }
+    inline void SetGameProperties(std::vector<GameProperty> &&value) {
+        m_gameProperties = std::move(value);
+        ReindexGameProperties();
+    }
 
     /**
      * <p>Set of custom properties for the game session.</p>
@@ -354,6 +368,7 @@ public:
      */
     inline GameSession &AddGameProperty(const GameProperty &value) {
         m_gameProperties.push_back(value);
+        IndexGameProperty(static_cast<int>(m_gameProperties.size()) - 1);
         return *this;
     }
 
@@ -361,10 +376,16 @@ public:
      * <p>Set of custom properties for the game session.</p>
      */
     inline GameSession &AddGameProperty(GameProperty &&value) {
-        m_gameProperties.push_back(value);
+        m_gameProperties.push_back(std::move(value));
+        IndexGameProperty(static_cast<int>(m_gameProperties.size()) - 1);
         return *this;
     }
 
+    /**
+     * <p>Preallocates room for count custom properties.</p>
+     */
+    inline void ReserveGameProperties(int count) { m_gameProperties.reserve(count); }
+
     /**
      * <p>IP address of the game session. To connect to a game server process, an
      * app needs both the IP address and port number.</p>
@@ -489,17 +510,26 @@ public:
     /**
      * <p>Data generated from Amazon GameLift Servers Matchmaking.</p>
      */
-    inline void SetMatchmakerData(const std::string &value) { m_matchmakerData = value; }
+    inline void SetMatchmakerData(const std::string &value) {
+        m_matchmakerData = value;
+        m_matchmakerDataModel = MatchmakerDataPtr();
+    }
 
     /**
      * <p>Data generated from Amazon GameLift Servers Matchmaking.</p>
      */
-    inline void SetMatchmakerData(std::string &&value) { m_matchmakerData = value; }
+    inline void SetMatchmakerData(std::string &&value) {
+        m_matchmakerData = std::move(value);
+        m_matchmakerDataModel = MatchmakerDataPtr();
+    }
 
     /**
      * <p>Data generated from Amazon GameLift Servers Matchmaking.</p>
      */
-    inline void SetMatchmakerData(const char *value) { m_matchmakerData.assign(value); }
+    inline void SetMatchmakerData(const char *value) {
+        m_matchmakerData.assign(value);
+        m_matchmakerDataModel = MatchmakerDataPtr();
+    }
 
     /**
      * <p>Data generated from Amazon GameLift Servers Matchmaking.</p>
@@ -577,6 +607,9 @@ public:
     }
 
 private:
+    inline int GetGamePropertyCount() const { return static_cast<int>(m_gameProperties.size()); }
+    inline const char *GetGamePropertyKey(int index) const { return m_gameProperties[index].GetKey().c_str(); }
+
     std::string m_gameSessionId;
     std::string m_name;
     std::string m_fleetId;
@@ -590,62 +623,47 @@ private:
     std::string m_dnsName;
 #else
 public:
-    GameSession() : m_maximumPlayerSessionCount(0), m_status(), m_gameProperties_count(0), m_port(0) {
-        memset(m_gameSessionId, 0, MAX_SESSION_ID_LENGTH);
-        memset(m_name, 0, MAX_SESSION_NAME_LENGTH);
-        memset(m_fleetId, 0, MAX_FLEET_ID_LENGTH);
-        memset(m_gameProperties, 0, MAX_GAME_PROPERTIES);
-        memset(m_ipAddress, 0, MAX_IP_LENGTH);
-        memset(m_gameSessionData, 0, MAX_GAME_SESSION_DATA_LENGTH);
-        memset(m_matchmakerData, 0, MAX_MATCHMAKER_DATA_LENGTH);
-        memset(m_dnsName, 0, MAX_DNS_NAME_LENGTH);
-    }
+    GameSession()
+        : m_gameSessionId(StringPool::EMPTY), m_name(StringPool::EMPTY), m_fleetId(StringPool::EMPTY), m_maximumPlayerSessionCount(0), m_status(),
+          m_gameProperties(nullptr), m_gameProperties_count(0), m_gameProperties_capacity(0), m_ipAddress(StringPool::EMPTY), m_port(0),
+          m_gameSessionData(StringPool::EMPTY), m_matchmakerData(StringPool::EMPTY), m_dnsName(StringPool::EMPTY) {}
 
     /**
      * <p>Destructor.</p>
      */
-    ~GameSession() {}
+    ~GameSession() { delete[] m_gameProperties; }
 
     /**
      * <p>Copy Constructor.</p>
      */
-    GameSession(const GameSession &other)
-        : m_maximumPlayerSessionCount(other.m_maximumPlayerSessionCount), m_status(other.m_status), m_gameProperties_count(other.m_gameProperties_count),
-          m_port(other.m_port) {
-        strncpy(m_ipAddress, other.m_ipAddress, sizeof(other.m_ipAddress));
-        strncpy(m_gameSessionId, other.m_gameSessionId, sizeof(other.m_gameSessionId));
-        strncpy(m_name, other.m_name, sizeof(other.m_name));
-        strncpy(m_fleetId, other.m_fleetId, sizeof(other.m_fleetId));
-        strncpy(m_gameSessionData, other.m_gameSessionData, sizeof(other.m_gameSessionData));
-        strncpy(m_matchmakerData, other.m_matchmakerData, sizeof(other.m_matchmakerData));
-        strncpy(m_dnsName, other.m_dnsName, sizeof(other.m_dnsName));
-
-        std::copy(std::begin(other.m_gameProperties), std::end(other.m_gameProperties), std::begin(m_gameProperties));
-    }
+    GameSession(const GameSession &other) : m_gameProperties(nullptr), m_gameProperties_count(0), m_gameProperties_capacity(0) { *this = other; }
 
     /**
      * <p>Move Constructor.</p>
      */
-    GameSession(GameSession &&other) { *this = std::move(other); }
+    GameSession(GameSession &&other) : m_gameProperties(nullptr), m_gameProperties_count(0), m_gameProperties_capacity(0) { *this = std::move(other); }
 
     /**
      * <p>Copy assignment Constructor.</p>
      */
     GameSession &operator=(const GameSession &other) {
-        m_maximumPlayerSessionCount = other.m_maximumPlayerSessionCount;
+        if (this == &other) {
+            return *this;
+        }
+        m_strings = other.m_strings;
+        CopyScalarsAndHandles(other);
+        m_gamePropertyIndex = other.m_gamePropertyIndex;
+        m_matchmakerDataModel = other.m_matchmakerDataModel;
+
+        delete[] m_gameProperties;
+        m_gameProperties = nullptr;
+        m_gameProperties_capacity = 0;
+        m_gameProperties_count = 0;
+        ReserveGameProperties(other.m_gameProperties_count);
+        for (int i = 0; i < other.m_gameProperties_count; i++) {
+            m_gameProperties[i] = other.m_gameProperties[i];
+        }
         m_gameProperties_count = other.m_gameProperties_count;
-        m_port = other.m_port;
-        m_status = other.m_status;
-
-        strncpy(m_ipAddress, other.m_ipAddress, sizeof(other.m_ipAddress));
-        strncpy(m_gameSessionId, other.m_gameSessionId, sizeof(other.m_gameSessionId));
-        strncpy(m_name, other.m_name, sizeof(other.m_name));
-        strncpy(m_fleetId, other.m_fleetId, sizeof(other.m_fleetId));
-        strncpy(m_gameSessionData, other.m_gameSessionData, sizeof(other.m_gameSessionData));
-        strncpy(m_matchmakerData, other.m_matchmakerData, sizeof(other.m_matchmakerData));
-        strncpy(m_dnsName, other.m_dnsName, sizeof(other.m_dnsName));
-
-        std::copy(std::begin(other.m_gameProperties), std::end(other.m_gameProperties), std::begin(m_gameProperties));
 
         return *this;
     }
@@ -654,33 +672,23 @@ public:
      * <p>Move assignment Constructor.</p>
      */
     GameSession &operator=(GameSession &&other) {
-        m_maximumPlayerSessionCount = other.m_maximumPlayerSessionCount;
-        m_gameProperties_count = other.m_gameProperties_count;
-        m_port = other.m_port;
-        m_status = other.m_status;
-
-        strncpy(m_gameSessionId, other.m_gameSessionId, sizeof(other.m_gameSessionId));
-        strncpy(m_ipAddress, other.m_ipAddress, sizeof(other.m_ipAddress));
-        strncpy(m_name, other.m_name, sizeof(other.m_name));
-        strncpy(m_fleetId, other.m_fleetId, sizeof(other.m_fleetId));
-        strncpy(m_gameSessionData, other.m_gameSessionData, sizeof(other.m_gameSessionData));
-        strncpy(m_matchmakerData, other.m_matchmakerData, sizeof(other.m_matchmakerData));
-        strncpy(m_dnsName, other.m_dnsName, sizeof(other.m_dnsName));
+        if (this == &other) {
+            return *this;
+        }
+        m_strings = std::move(other.m_strings);
+        CopyScalarsAndHandles(other);
+        m_gamePropertyIndex = std::move(other.m_gamePropertyIndex);
+        m_matchmakerDataModel = std::move(other.m_matchmakerDataModel);
 
-        std::copy(std::begin(other.m_gameProperties), std::end(other.m_gameProperties), std::begin(m_gameProperties));
+        delete[] m_gameProperties;
+        m_gameProperties = other.m_gameProperties;
+        m_gameProperties_count = other.m_gameProperties_count;
+        m_gameProperties_capacity = other.m_gameProperties_capacity;
 
-        other.m_maximumPlayerSessionCount = 0;
+        other.m_gameProperties = nullptr;
         other.m_gameProperties_count = 0;
-        other.m_port = 0;
-
-        memset(other.m_gameSessionId, 0, MAX_SESSION_ID_LENGTH);
-        memset(other.m_ipAddress, 0, MAX_IP_LENGTH);
-        memset(other.m_name, 0, MAX_SESSION_NAME_LENGTH);
-        memset(other.m_fleetId, 0, MAX_FLEET_ID_LENGTH);
-        memset(other.m_gameProperties, 0, MAX_GAME_PROPERTIES);
-        memset(other.m_gameSessionData, 0, MAX_GAME_SESSION_DATA_LENGTH);
-        memset(other.m_matchmakerData, 0, MAX_MATCHMAKER_DATA_LENGTH);
-        memset(other.m_dnsName, 0, MAX_DNS_NAME_LENGTH);
+        other.m_gameProperties_capacity = 0;
+        other.CopyScalarsAndHandles(GameSession());
 
         return *this;
     }
@@ -688,15 +696,12 @@ public:
     /**
      * <p>Unique identifier for a game session.</p>
      */
-    inline const char *GetGameSessionId() const { return m_gameSessionId; }
+    inline const char *GetGameSessionId() const { return m_strings.Get(m_gameSessionId); }
 
     /**
      * <p>Unique identifier for a game session.</p>
      */
-    inline void SetGameSessionId(const char *value) {
-        strncpy(m_gameSessionId, value, sizeof(m_gameSessionId));
-        m_gameSessionId[sizeof(m_gameSessionId) - 1] = 0;
-    }
+    inline void SetGameSessionId(const char *value) { m_gameSessionId = m_strings.Add(value, MAX_SESSION_ID_LENGTH); }
 
     /**
      * <p>Unique identifier for a game session.</p>
@@ -710,16 +715,13 @@ public:
      * <p>Descriptive label associated with a game session. Session names do not need
      * to be unique.</p>
      */
-    inline const char *GetName() const { return m_name; }
+    inline const char *GetName() const { return m_strings.Get(m_name); }
 
     /**
      * <p>Descriptive label associated with a game session. Session names do not need
      * to be unique.</p>
      */
-    inline void SetName(const char *value) {
-        strncpy(m_name, value, sizeof(m_name));
-        m_name[sizeof(m_name) - 1] = 0;
-    }
+    inline void SetName(const char *value) { m_name = m_strings.Add(value, MAX_SESSION_NAME_LENGTH); }
 
     /**
      * <p>Descriptive label associated with a game session. Session names do not need
@@ -733,15 +735,12 @@ public:
     /**
      * <p>Unique identifier for a fleet.</p>
      */
-    inline const char *GetFleetId() const { return m_fleetId; }
+    inline const char *GetFleetId() const { return m_strings.Get(m_fleetId); }
 
     /**
      * <p>Unique identifier for a fleet.</p>
      */
-    inline void SetFleetId(const char *value) {
-        strncpy(m_fleetId, value, sizeof(m_fleetId));
-        m_fleetId[sizeof(m_fleetId) - 1] = 0;
-    }
+    inline void SetFleetId(const char *value) { m_fleetId = m_strings.Add(value, MAX_FLEET_ID_LENGTH); }
 
     /**
      * <p>Unique identifier for a fleet.</p>
@@ -818,15 +817,38 @@ public:
      */
     inline void AddGameProperty(GameProperty gameProperty) {
         if (m_gameProperties_count < MAX_GAME_PROPERTIES) {
-            m_gameProperties[m_gameProperties_count++] = gameProperty;
+            if (m_gameProperties_count == m_gameProperties_capacity) {
+                ReserveGameProperties(m_gameProperties_capacity == 0 ? 4 : m_gameProperties_capacity * 2);
+            }
+            m_gameProperties[m_gameProperties_count] = std::move(gameProperty);
+            IndexGameProperty(m_gameProperties_count++);
         }
     };
 
+    /**
+     * <p>Preallocates room for count custom properties, up to MAX_GAME_PROPERTIES.</p>
+     */
+    inline void ReserveGameProperties(int count) {
+        if (count > MAX_GAME_PROPERTIES) {
+            count = MAX_GAME_PROPERTIES;
+        }
+        if (count <= m_gameProperties_capacity) {
+            return;
+        }
+        GameProperty *gameProperties = new GameProperty[count];
+        for (int i = 0; i < m_gameProperties_count; i++) {
+            gameProperties[i] = std::move(m_gameProperties[i]);
+        }
+        delete[] m_gameProperties;
+        m_gameProperties = gameProperties;
+        m_gameProperties_capacity = count;
+    }
+
     /**
      * <p>Set of custom properties for the game session.</p>
      */
     inline GameSession &WithGameProperty(GameProperty gameProperty) {
-        AddGameProperty(gameProperty);
+        AddGameProperty(std::move(gameProperty));
         return *this;
     }
 
@@ -834,16 +856,13 @@ public:
      * <p>IP address of the game session. To connect to a game server process, an
      * app needs both the IP address and port number.</p>
      */
-    inline const char *GetIpAddress() const { return m_ipAddress; }
+    inline const char *GetIpAddress() const { return m_strings.Get(m_ipAddress); }
 
     /**
      * <p>IP address of the game session. To connect to a game server process, an
      * app needs both the IP address and port number.</p>
      */
-    inline void SetIpAddress(const char *value) {
-        strncpy(m_ipAddress, value, sizeof(m_ipAddress));
-        m_ipAddress[sizeof(m_ipAddress) - 1] = 0;
-    }
+    inline void SetIpAddress(const char *value) { m_ipAddress = m_strings.Add(value, MAX_IP_LENGTH); }
 
     /**
      * <p>IP address of the game session. To connect to a game server process, an
@@ -878,15 +897,12 @@ public:
     /**
      * <p>Custom data for the game session.</p>
      */
-    inline const char *GetGameSessionData() const { return m_gameSessionData; }
+    inline const char *GetGameSessionData() const { return m_strings.Get(m_gameSessionData); }
 
     /**
      * <p>Custom data for the game session.</p>
      */
-    inline void SetGameSessionData(const char *value) {
-        strncpy(m_gameSessionData, value, sizeof(m_gameSessionData));
-        m_gameSessionData[sizeof(m_gameSessionData) - 1] = 0;
-    }
+    inline void SetGameSessionData(const char *value) { m_gameSessionData = m_strings.Add(value, MAX_GAME_SESSION_DATA_LENGTH); }
 
     /**
      * <p>Custom data for the game session.</p>
@@ -899,14 +915,14 @@ public:
     /**
      * <p>Data generated from Amazon GameLift Servers Matchmaking.</p>
      */
-    inline const char *GetMatchmakerData() const { return m_matchmakerData; }
+    inline const char *GetMatchmakerData() const { return m_strings.Get(m_matchmakerData); }
 
     /**
      * <p>Data generated from Amazon GameLift Servers Matchmaking.</p>
      */
     inline void SetMatchmakerData(const char *value) {
-        strncpy(m_matchmakerData, value, sizeof(m_matchmakerData));
-        m_matchmakerData[sizeof(m_matchmakerData) - 1] = 0;
+        m_matchmakerData = m_strings.Add(value, MAX_MATCHMAKER_DATA_LENGTH);
+        m_matchmakerDataModel = MatchmakerDataPtr();
     }
 
     /**
@@ -921,16 +937,13 @@ public:
      * The DNS name of the host running a game server process, used for establishing a TLS
      * connection for a game session.
      */
-    inline const char *GetDnsName() const { return m_dnsName; }
+    inline const char *GetDnsName() const { return m_strings.Get(m_dnsName); }
 
     /**
      * The DNS name of the host running a game server process, used for establishing a TLS
      * connection for a game session.
      */
-    inline void SetDnsName(const char *value) {
-        strncpy(m_dnsName, value, sizeof(m_dnsName));
-        m_dnsName[sizeof(m_dnsName) - 1] = 0;
-    }
+    inline void SetDnsName(const char *value) { m_dnsName = m_strings.Add(value, MAX_DNS_NAME_LENGTH); }
 
     /**
      * The DNS name of the host running a game server process, used for establishing a TLS
@@ -942,19 +955,78 @@ public:
     }
 
 private:
-    char m_gameSessionId[MAX_SESSION_ID_LENGTH];
-    char m_name[MAX_SESSION_NAME_LENGTH];
-    char m_fleetId[MAX_FLEET_ID_LENGTH];
+    inline int GetGamePropertyCount() const { return m_gameProperties_count; }
+    inline const char *GetGamePropertyKey(int index) const { return m_gameProperties[index].GetKey(); }
+
+    inline void CopyScalarsAndHandles(const GameSession &other) {
+        m_gameSessionId = other.m_gameSessionId;
+        m_name = other.m_name;
+        m_fleetId = other.m_fleetId;
+        m_maximumPlayerSessionCount = other.m_maximumPlayerSessionCount;
+        m_status = other.m_status;
+        m_ipAddress = other.m_ipAddress;
+        m_port = other.m_port;
+        m_gameSessionData = other.m_gameSessionData;
+        m_matchmakerData = other.m_matchmakerData;
+        m_dnsName = other.m_dnsName;
+    }
+
+    // All string fields live in m_strings; the members below are handles into it.
+    StringPool m_strings;
+    StringPool::Handle m_gameSessionId;
+    StringPool::Handle m_name;
+    StringPool::Handle m_fleetId;
     int m_maximumPlayerSessionCount;
     GameSessionStatus m_status;
-    GameProperty m_gameProperties[MAX_GAME_PROPERTIES];
+    GameProperty *m_gameProperties;
     int m_gameProperties_count;
-    char m_ipAddress[MAX_IP_LENGTH];
+    int m_gameProperties_capacity;
+    StringPool::Handle m_ipAddress;
     int m_port;
-    char m_gameSessionData[MAX_GAME_SESSION_DATA_LENGTH];
-    char m_matchmakerData[MAX_MATCHMAKER_DATA_LENGTH];
-    char m_dnsName[MAX_DNS_NAME_LENGTH];
+    StringPool::Handle m_gameSessionData;
+    StringPool::Handle m_matchmakerData;
+    StringPool::Handle m_dnsName;
 #endif
+public:
+    /**
+     * <p>Custom property of the game session with the given key, or nullptr. Properties are
+     * hash-indexed as they are added, so the lookup takes constant time.</p>
+     */
+    inline const GameProperty *FindGameProperty(const char *key) const {
+        int index = m_gamePropertyIndex.Find(StringIndex::Hash(key), [this, key](int property) { return strcmp(GetGamePropertyKey(property), key) == 0; });
+        return index == StringIndex::NOT_FOUND ? nullptr : &m_gameProperties[index];
+    }
+
+    /**
+     * <p>Matchmaker data parsed into teams, players and attributes, or nullptr when the game session
+     * has no matchmaker data. The SDK parses it once when the game session arrives; setting the
+     * matchmaker data by hand clears it.</p>
+     */
+    inline const MatchmakerData *GetMatchmakerDataModel() const { return m_matchmakerDataModel.Get(); }
+
+    /**
+     * <p>Attaches parsed matchmaker data. Set by the SDK.</p>
+     */
+    inline void SetMatchmakerDataModel(MatchmakerDataPtr value) { m_matchmakerDataModel = std::move(value); }
+
+private:
+    inline void IndexGameProperty(int index) {
+        // First property wins on duplicate keys, like a linear scan of GetGameProperties().
+        const char *key = GetGamePropertyKey(index);
+        if (FindGameProperty(key) == nullptr) {
+            m_gamePropertyIndex.Insert(StringIndex::Hash(key), index);
+        }
+    }
+
+    inline void ReindexGameProperties() {
+        m_gamePropertyIndex.Clear();
+        for (int i = 0; i < GetGamePropertyCount(); i++) {
+            IndexGameProperty(i);
+        }
+    }
+
+    StringIndex m_gamePropertyIndex;
+    MatchmakerDataPtr m_matchmakerDataModel;
 };
 
 } // namespace Model
@@ -0,0 +1,362 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <string.h>
+#include <aws/gamelift/common/GameLift_EXPORTS.h>
+#include <aws/gamelift/server/model/AttributeValue.h>
+#include <aws/gamelift/server/model/StringIndex.h>
+#include <aws/gamelift/server/model/StringPool.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Server {
+namespace Model {
+
+/**
+ * <p>Parsed form of the matchmaker data JSON attached to a game session created by FlexMatch:
+ * the match, its teams, their players and each player's attributes.</p>
+ * <p>Teams, players and attributes are addressed by index. Players are stored team by team, and
+ * FindTeam(), FindPlayer() and FindPlayerAttribute() are hash lookups.</p>
+ * <p>The SDK builds one instance per CreateGameSession or UpdateGameSession message; afterwards it
+ * is immutable and shared by every copy of the GameSession through MatchmakerDataPtr.</p>
+ * <p>For more information, see the <a
+ * href="https://docs.aws.amazon.com/gamelift/latest/flexmatchguide/match-server.html">Amazon GameLift
+ * Servers FlexMatch Developer Guide</a>.</p>
+ */
+class AWS_GAMELIFT_API MatchmakerData {
+public:
+    static const int NOT_FOUND = StringIndex::NOT_FOUND;
+
+    MatchmakerData()
+        : m_referenceCount(0), m_matchId(StringPool::EMPTY), m_matchmakingConfigurationArn(StringPool::EMPTY), m_autoBackfillMode(StringPool::EMPTY),
+          m_autoBackfillTicketId(StringPool::EMPTY) {}
+
+    MatchmakerData(const MatchmakerData &) = delete;
+    MatchmakerData &operator=(const MatchmakerData &) = delete;
+
+    /**
+     * <p>Unique identifier of the match.</p>
+     */
+    inline const char *GetMatchId() const { return m_strings.Get(m_matchId); }
+
+    /**
+     * <p>ARN of the matchmaking configuration that created the match.</p>
+     */
+    inline const char *GetMatchmakingConfigurationArn() const { return m_strings.Get(m_matchmakingConfigurationArn); }
+
+    /**
+     * <p>AUTOMATIC or MANUAL; empty when the configuration does not backfill.</p>
+     */
+    inline const char *GetAutoBackfillMode() const { return m_strings.Get(m_autoBackfillMode); }
+
+    /**
+     * <p>Ticket of the automatic backfill request running for this match, if any.</p>
+     */
+    inline const char *GetAutoBackfillTicketId() const { return m_strings.Get(m_autoBackfillTicketId); }
+
+    inline int GetTeamCount() const { return m_teams.GetCount(); }
+
+    inline const char *GetTeamName(int team) const { return m_strings.Get(m_teams[team].name); }
+
+    inline int GetTeamPlayerCount(int team) const { return m_teams[team].playerCount; }
+
+    /**
+     * <p>Player index of the index-th player of team.</p>
+     */
+    inline int GetTeamPlayer(int team, int index) const { return m_teams[team].firstPlayer + index; }
+
+    inline int FindTeam(const char *name) const {
+        return m_teamIndex.Find(StringIndex::Hash(name), [this, name](int team) { return strcmp(GetTeamName(team), name) == 0; });
+    }
+
+    inline int GetPlayerCount() const { return m_players.GetCount(); }
+
+    inline const char *GetPlayerId(int player) const { return m_strings.Get(m_players[player].playerId); }
+
+    /**
+     * <p>Team index of player.</p>
+     */
+    inline int GetPlayerTeam(int player) const { return m_players[player].team; }
+
+    inline int FindPlayer(const char *playerId) const {
+        return m_playerIndex.Find(StringIndex::Hash(playerId), [this, playerId](int player) { return strcmp(GetPlayerId(player), playerId) == 0; });
+    }
+
+    inline int GetPlayerAttributeCount(int player) const { return m_players[player].attributeCount; }
+
+    /**
+     * <p>Attribute index of the index-th attribute of player.</p>
+     */
+    inline int GetPlayerAttribute(int player, int index) const { return m_players[player].firstAttribute + index; }
+
+    inline int FindPlayerAttribute(int player, const char *name) const {
+        return m_attributeIndex.Find(AttributeHash(player, name), [this, player, name](int attribute) {
+            return m_attributes[attribute].player == player && strcmp(GetAttributeName(attribute), name) == 0;
+        });
+    }
+
+    inline const char *GetAttributeName(int attribute) const { return m_strings.Get(m_attributes[attribute].name); }
+
+    inline AttributeValue::AttrType GetAttributeType(int attribute) const { return m_attributes[attribute].type; }
+
+    /**
+     * <p>Value of a STRING attribute.</p>
+     */
+    inline const char *GetAttributeString(int attribute) const { return m_strings.Get(m_attributes[attribute].stringValue); }
+
+    /**
+     * <p>Value of a DOUBLE attribute.</p>
+     */
+    inline double GetAttributeDouble(int attribute) const { return m_attributes[attribute].doubleValue; }
+
+    /**
+     * <p>Number of strings of a STRING_LIST attribute or of entries of a STRING_DOUBLE_MAP attribute.</p>
+     */
+    inline int GetAttributeEntryCount(int attribute) const { return m_attributes[attribute].entryCount; }
+
+    /**
+     * <p>List string or map key of the index-th entry of attribute.</p>
+     */
+    inline const char *GetAttributeEntryKey(int attribute, int index) const { return m_strings.Get(m_entries[m_attributes[attribute].firstEntry + index].key); }
+
+    /**
+     * <p>Map value of the index-th entry of a STRING_DOUBLE_MAP attribute.</p>
+     */
+    inline double GetAttributeEntryValue(int attribute, int index) const { return m_entries[m_attributes[attribute].firstEntry + index].value; }
+
+    /**
+     * <p>Builder methods, used by the SDK while parsing. Players are added to the last added team,
+     * attributes to the last added player and entries to the last added attribute.</p>
+     */
+    inline void SetMatchId(const char *value) { m_matchId = m_strings.Add(value); }
+
+    inline void SetMatchmakingConfigurationArn(const char *value) { m_matchmakingConfigurationArn = m_strings.Add(value); }
+
+    inline void SetAutoBackfillMode(const char *value) { m_autoBackfillMode = m_strings.Add(value); }
+
+    inline void SetAutoBackfillTicketId(const char *value) { m_autoBackfillTicketId = m_strings.Add(value); }
+
+    inline int AddTeam(const char *name) {
+        Team team;
+        team.name = m_strings.Add(name);
+        team.firstPlayer = m_players.GetCount();
+        team.playerCount = 0;
+        int index = m_teams.Add(team);
+        if (FindTeam(name) == NOT_FOUND) {
+            m_teamIndex.Insert(StringIndex::Hash(name), index);
+        }
+        return index;
+    }
+
+    inline int AddPlayer(const char *playerId) {
+        if (m_teams.GetCount() == 0) {
+            return NOT_FOUND;
+        }
+        Player player;
+        player.playerId = m_strings.Add(playerId);
+        player.team = m_teams.GetCount() - 1;
+        player.firstAttribute = m_attributes.GetCount();
+        player.attributeCount = 0;
+        int index = m_players.Add(player);
+        m_teams.Last().playerCount++;
+        if (FindPlayer(playerId) == NOT_FOUND) {
+            m_playerIndex.Insert(StringIndex::Hash(playerId), index);
+        }
+        return index;
+    }
+
+    inline int AddAttribute(const char *name, AttributeValue::AttrType type) {
+        if (m_players.GetCount() == 0) {
+            return NOT_FOUND;
+        }
+        Attribute attribute;
+        attribute.name = m_strings.Add(name);
+        attribute.player = m_players.GetCount() - 1;
+        attribute.type = type;
+        attribute.stringValue = StringPool::EMPTY;
+        attribute.doubleValue = 0;
+        attribute.firstEntry = m_entries.GetCount();
+        attribute.entryCount = 0;
+        int index = m_attributes.Add(attribute);
+        m_players.Last().attributeCount++;
+        if (FindPlayerAttribute(attribute.player, name) == NOT_FOUND) {
+            m_attributeIndex.Insert(AttributeHash(attribute.player, name), index);
+        }
+        return index;
+    }
+
+    inline void SetAttributeString(const char *value) {
+        if (m_attributes.GetCount() > 0) {
+            m_attributes.Last().stringValue = m_strings.Add(value);
+        }
+    }
+
+    inline void SetAttributeDouble(double value) {
+        if (m_attributes.GetCount() > 0) {
+            m_attributes.Last().doubleValue = value;
+        }
+    }
+
+    inline void AddAttributeEntry(const char *key, double value) {
+        if (m_attributes.GetCount() > 0) {
+            Entry entry;
+            entry.key = m_strings.Add(key);
+            entry.value = value;
+            m_entries.Add(entry);
+            m_attributes.Last().entryCount++;
+        }
+    }
+
+private:
+    friend class MatchmakerDataPtr;
+
+    struct Team {
+        StringPool::Handle name;
+        int firstPlayer;
+        int playerCount;
+    };
+
+    struct Player {
+        StringPool::Handle playerId;
+        int team;
+        int firstAttribute;
+        int attributeCount;
+    };
+
+    struct Attribute {
+        StringPool::Handle name;
+        int player;
+        AttributeValue::AttrType type;
+        StringPool::Handle stringValue;
+        double doubleValue;
+        int firstEntry;
+        int entryCount;
+    };
+
+    struct Entry {
+        StringPool::Handle key;
+        double value;
+    };
+
+    // Growable array of trivially copyable records.
+    template <typename T> class Records {
+    public:
+        Records() : m_data(nullptr), m_count(0), m_capacity(0) {}
+        ~Records() { delete[] m_data; }
+        Records(const Records &) = delete;
+        Records &operator=(const Records &) = delete;
+
+        inline int Add(const T &value) {
+            if (m_count == m_capacity) {
+                int capacity = m_capacity == 0 ? 4 : m_capacity * 2;
+                T *data = new T[capacity];
+                if (m_count > 0) {
+                    memcpy(data, m_data, sizeof(T) * m_count);
+                }
+                delete[] m_data;
+                m_data = data;
+                m_capacity = capacity;
+            }
+            m_data[m_count] = value;
+            return m_count++;
+        }
+
+        inline const T &operator[](int index) const { return m_data[index]; }
+        inline T &Last() { return m_data[m_count - 1]; }
+        inline int GetCount() const { return m_count; }
+
+    private:
+        T *m_data;
+        int m_count;
+        int m_capacity;
+    };
+
+    static inline uint32_t AttributeHash(int player, const char *name) { return StringIndex::Hash(name) ^ (static_cast<uint32_t>(player) * 2654435761u); }
+
+    mutable std::atomic<int> m_referenceCount;
+
+    StringPool m_strings;
+    StringPool::Handle m_matchId;
+    StringPool::Handle m_matchmakingConfigurationArn;
+    StringPool::Handle m_autoBackfillMode;
+    StringPool::Handle m_autoBackfillTicketId;
+    Records<Team> m_teams;
+    Records<Player> m_players;
+    Records<Attribute> m_attributes;
+    Records<Entry> m_entries;
+    StringIndex m_teamIndex;
+    StringIndex m_playerIndex;
+    StringIndex m_attributeIndex;
+};
+
+/**
+ * <p>Reference-counted handle to an immutable MatchmakerData, so copying a GameSession never copies
+ * the parsed model.</p>
+ */
+class MatchmakerDataPtr {
+public:
+    MatchmakerDataPtr() : m_data(nullptr) {}
+
+    /**
+     * <p>Takes ownership of a newly built model.</p>
+     */
+    explicit MatchmakerDataPtr(MatchmakerData *data) : m_data(data) { Retain(); }
+
+    MatchmakerDataPtr(const MatchmakerDataPtr &other) : m_data(other.m_data) { Retain(); }
+
+    MatchmakerDataPtr(MatchmakerDataPtr &&other) : m_data(other.m_data) { other.m_data = nullptr; }
+
+    ~MatchmakerDataPtr() { Release(); }
+
+    MatchmakerDataPtr &operator=(const MatchmakerDataPtr &other) {
+        if (m_data != other.m_data) {
+            Release();
+            m_data = other.m_data;
+            Retain();
+        }
+        return *this;
+    }
+
+    MatchmakerDataPtr &operator=(MatchmakerDataPtr &&other) {
+        if (this != &other) {
+            Release();
+            m_data = other.m_data;
+            other.m_data = nullptr;
+        }
+        return *this;
+    }
+
+    inline const MatchmakerData *Get() const { return m_data; }
+
+private:
+    inline void Retain() {
+        if (m_data != nullptr) {
+            m_data->m_referenceCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    inline void Release() {
+        if (m_data != nullptr && m_data->m_referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete m_data;
+        }
+        m_data = nullptr;
+    }
+
+    const MatchmakerData *m_data;
+};
+
+} // namespace Model
+} // namespace Server
+} // namespace GameLift
+} // namespace Aws
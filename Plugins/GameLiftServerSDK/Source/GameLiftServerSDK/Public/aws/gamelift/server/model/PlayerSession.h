@@ -18,6 +18,7 @@
 
 #include <aws/gamelift/common/GameLift_EXPORTS.h>
 #include <aws/gamelift/server/model/PlayerSessionStatus.h>
+#include <aws/gamelift/server/model/StringPool.h>
 #include <string.h>
 
 #ifndef GAMELIFT_USE_STD
@@ -590,15 +591,10 @@ private:
     std::string m_dnsName;
 #else
 public:
-    PlayerSession() : m_creationTime(0), m_terminationTime(0), m_status(), m_port(0) {
-        memset(m_playerSessionId, 0, sizeof(m_playerSessionId));
-        memset(m_playerId, 0, sizeof(m_playerId));
-        memset(m_gameSessionId, 0, sizeof(m_gameSessionId));
-        memset(m_fleetId, 0, sizeof(m_fleetId));
-        memset(m_ipAddress, 0, sizeof(m_ipAddress));
-        memset(m_playerData, 0, sizeof(m_playerData));
-        memset(m_dnsName, 0, sizeof(m_dnsName));
-    }
+    PlayerSession()
+        : m_playerSessionId(StringPool::EMPTY), m_playerId(StringPool::EMPTY), m_gameSessionId(StringPool::EMPTY), m_fleetId(StringPool::EMPTY),
+          m_creationTime(0), m_terminationTime(0), m_status(), m_ipAddress(StringPool::EMPTY), m_port(0), m_playerData(StringPool::EMPTY),
+          m_dnsName(StringPool::EMPTY) {}
 
     /**
      * <p>Destructor.</p>
@@ -608,38 +604,22 @@ public:
     /**
      * <p>Copy Constructor.</p>
      */
-    PlayerSession(const PlayerSession &other)
-        : m_creationTime(other.m_creationTime), m_terminationTime(other.m_terminationTime), m_status(other.m_status), m_port(other.m_port) {
-        strncpy(m_playerSessionId, other.m_playerSessionId, sizeof(other.m_playerSessionId));
-        strncpy(m_playerId, other.m_playerId, sizeof(other.m_playerId));
-        strncpy(m_gameSessionId, other.m_gameSessionId, sizeof(other.m_gameSessionId));
-        strncpy(m_fleetId, other.m_fleetId, sizeof(other.m_fleetId));
-        strncpy(m_ipAddress, other.m_ipAddress, sizeof(other.m_ipAddress));
-        strncpy(m_playerData, other.m_playerData, sizeof(other.m_playerData));
-        strncpy(m_dnsName, other.m_dnsName, sizeof(other.m_dnsName));
-    }
+    PlayerSession(const PlayerSession &other) : m_strings(other.m_strings) { CopyScalarsAndHandles(other); }
 
     /**
      * <p>Move Constructor.</p>
      */
-    PlayerSession(PlayerSession &&other) { *this = std::move(other); }
+    PlayerSession(PlayerSession &&other) : m_strings(std::move(other.m_strings)) {
+        CopyScalarsAndHandles(other);
+        other.CopyScalarsAndHandles(PlayerSession());
+    }
 
     /**
      * <p>Copy assignment Constructor.</p>
      */
     PlayerSession &operator=(const PlayerSession &other) {
-        m_creationTime = other.m_creationTime;
-        m_terminationTime = other.m_terminationTime;
-        m_status = other.m_status;
-        m_port = other.m_port;
-
-        strncpy(m_playerSessionId, other.m_playerSessionId, sizeof(other.m_playerSessionId));
-        strncpy(m_playerId, other.m_playerId, sizeof(other.m_playerId));
-        strncpy(m_gameSessionId, other.m_gameSessionId, sizeof(other.m_gameSessionId));
-        strncpy(m_fleetId, other.m_fleetId, sizeof(other.m_fleetId));
-        strncpy(m_ipAddress, other.m_ipAddress, sizeof(other.m_ipAddress));
-        strncpy(m_playerData, other.m_playerData, sizeof(other.m_playerData));
-        strncpy(m_dnsName, other.m_dnsName, sizeof(other.m_dnsName));
+        m_strings = other.m_strings;
+        CopyScalarsAndHandles(other);
 
         return *this;
     }
@@ -648,30 +628,9 @@ public:
      * <p>Move assignment Constructor.</p>
      */
     PlayerSession &operator=(PlayerSession &&other) {
-        m_creationTime = other.m_creationTime;
-        m_terminationTime = other.m_terminationTime;
-        m_status = other.m_status;
-        m_port = other.m_port;
-
-        strncpy(m_playerSessionId, other.m_playerSessionId, sizeof(other.m_playerSessionId));
-        strncpy(m_playerId, other.m_playerId, sizeof(other.m_playerId));
-        strncpy(m_gameSessionId, other.m_gameSessionId, sizeof(other.m_gameSessionId));
-        strncpy(m_fleetId, other.m_fleetId, sizeof(other.m_fleetId));
-        strncpy(m_ipAddress, other.m_ipAddress, sizeof(other.m_ipAddress));
-        strncpy(m_playerData, other.m_playerData, sizeof(other.m_playerData));
-        strncpy(m_dnsName, other.m_dnsName, sizeof(other.m_dnsName));
-
-        other.m_creationTime = 0;
-        other.m_terminationTime = 0;
-        other.m_port = 0;
-
-        memset(other.m_playerSessionId, 0, sizeof(other.m_playerSessionId));
-        memset(other.m_playerId, 0, sizeof(other.m_playerId));
-        memset(other.m_gameSessionId, 0, sizeof(other.m_gameSessionId));
-        memset(other.m_fleetId, 0, sizeof(other.m_fleetId));
-        memset(other.m_ipAddress, 0, sizeof(other.m_ipAddress));
-        memset(other.m_playerData, 0, sizeof(other.m_playerData));
-        memset(other.m_dnsName, 0, sizeof(other.m_dnsName));
+        m_strings = std::move(other.m_strings);
+        CopyScalarsAndHandles(other);
+        other.CopyScalarsAndHandles(PlayerSession());
 
         return *this;
     }
@@ -679,15 +638,12 @@ public:
     /**
      * <p>Unique identifier for a player session.</p>
      */
-    inline const char *GetPlayerSessionId() const { return m_playerSessionId; }
+    inline const char *GetPlayerSessionId() const { return m_strings.Get(m_playerSessionId); }
 
     /**
      * <p>Unique identifier for a player session.</p>
      */
-    inline void SetPlayerSessionId(const char *value) {
-        strncpy(m_playerSessionId, value, sizeof(m_playerSessionId));
-        m_playerSessionId[sizeof(m_playerSessionId) - 1] = 0;
-    }
+    inline void SetPlayerSessionId(const char *value) { m_playerSessionId = m_strings.Add(value, MAX_PLAYER_SESSION_ID_LENGTH); }
 
     /**
      * <p>Unique identifier for a player session.</p>
@@ -700,15 +656,12 @@ public:
     /**
      * <p>Unique identifier for a player.</p>
      */
-    inline const char *GetPlayerId() const { return m_playerId; }
+    inline const char *GetPlayerId() const { return m_strings.Get(m_playerId); }
 
     /**
      * <p>Unique identifier for a player.</p>
      */
-    inline void SetPlayerId(const char *value) {
-        strncpy(m_playerId, value, sizeof(m_playerId));
-        m_playerId[sizeof(m_playerId) - 1] = 0;
-    }
+    inline void SetPlayerId(const char *value) { m_playerId = m_strings.Add(value, MAX_PLAYER_ID_LENGTH); }
 
     /**
      * <p>Unique identifier for a player.</p>
@@ -722,16 +675,13 @@ public:
      * <p>Unique identifier for the game session that the player session is connected
      * to.</p>
      */
-    inline const char *GetGameSessionId() const { return m_gameSessionId; }
+    inline const char *GetGameSessionId() const { return m_strings.Get(m_gameSessionId); }
 
     /**
      * <p>Unique identifier for the game session that the player session is connected
      * to.</p>
      */
-    inline void SetGameSessionId(const char *value) {
-        strncpy(m_gameSessionId, value, sizeof(m_gameSessionId));
-        m_gameSessionId[sizeof(m_gameSessionId) - 1] = 0;
-    }
+    inline void SetGameSessionId(const char *value) { m_gameSessionId = m_strings.Add(value, MAX_GAME_SESSION_ID_LENGTH); }
 
     /**
      * <p>Unique identifier for the game session that the player session is connected
@@ -745,15 +695,12 @@ public:
     /**
      * <p>Unique identifier for a fleet.</p>
      */
-    inline const char *GetFleetId() const { return m_fleetId; }
+    inline const char *GetFleetId() const { return m_strings.Get(m_fleetId); }
 
     /**
      * <p>Unique identifier for a fleet.</p>
      */
-    inline void SetFleetId(const char *value) {
-        strncpy(m_fleetId, value, sizeof(m_fleetId));
-        m_fleetId[sizeof(m_fleetId) - 1] = 0;
-    }
+    inline void SetFleetId(const char *value) { m_fleetId = m_strings.Add(value, MAX_FLEET_ID_LENGTH); }
 
     /**
      * <p>Unique identifier for a fleet.</p>
@@ -880,16 +827,13 @@ public:
      * <p>Game session IP address. All player sessions reference the game session
      * location.</p>
      */
-    inline const char *GetIpAddress() const { return m_ipAddress; }
+    inline const char *GetIpAddress() const { return m_strings.Get(m_ipAddress); }
 
     /**
      * <p>Game session IP address. All player sessions reference the game session
      * location.</p>
      */
-    inline void SetIpAddress(const char *value) {
-        strncpy(m_ipAddress, value, sizeof(m_ipAddress));
-        m_ipAddress[sizeof(m_ipAddress) - 1] = 0;
-    }
+    inline void SetIpAddress(const char *value) { m_ipAddress = m_strings.Add(value, MAX_IP_ADDRESS_LENGTH); }
 
     /**
      * <p>Game session IP address. All player sessions reference the game session
@@ -924,15 +868,12 @@ public:
     /**
      * <p>Custom player data.</p>
      */
-    inline const char *GetPlayerData() const { return m_playerData; }
+    inline const char *GetPlayerData() const { return m_strings.Get(m_playerData); }
 
     /**
      * <p>Custom player data.</p>
      */
-    inline void SetPlayerData(const char *value) {
-        strncpy(m_playerData, value, sizeof(m_playerData));
-        m_playerData[sizeof(m_playerData) - 1] = 0;
-    }
+    inline void SetPlayerData(const char *value) { m_playerData = m_strings.Add(value, MAX_PLAYER_DATA_LENGTH); }
 
     /**
      * <p>Custom player data.</p>
@@ -946,16 +887,13 @@ public:
      * <p>Game session DNS name. All player sessions reference the game session
      * location.</p>
      */
-    inline const char *GetDnsName() const { return m_dnsName; }
+    inline const char *GetDnsName() const { return m_strings.Get(m_dnsName); }
 
     /**
      * <p>Game session DNS name. All player sessions reference the game session
      * location.</p>
      */
-    inline void SetDnsName(const char *value) {
-        strncpy(m_dnsName, value, sizeof(m_dnsName));
-        m_dnsName[sizeof(m_dnsName) - 1] = 0;
-    }
+    inline void SetDnsName(const char *value) { m_dnsName = m_strings.Add(value, MAX_DNS_NAME_LENGTH); }
 
     /**
      * <p>Game session DNS name. All player sessions reference the game session
@@ -967,17 +905,33 @@ public:
     }
 
 private:
-    char m_playerSessionId[MAX_PLAYER_SESSION_ID_LENGTH];
-    char m_playerId[MAX_PLAYER_ID_LENGTH];
-    char m_gameSessionId[MAX_GAME_SESSION_ID_LENGTH];
-    char m_fleetId[MAX_FLEET_ID_LENGTH];
+    inline void CopyScalarsAndHandles(const PlayerSession &other) {
+        m_playerSessionId = other.m_playerSessionId;
+        m_playerId = other.m_playerId;
+        m_gameSessionId = other.m_gameSessionId;
+        m_fleetId = other.m_fleetId;
+        m_creationTime = other.m_creationTime;
+        m_terminationTime = other.m_terminationTime;
+        m_status = other.m_status;
+        m_ipAddress = other.m_ipAddress;
+        m_port = other.m_port;
+        m_playerData = other.m_playerData;
+        m_dnsName = other.m_dnsName;
+    }
+
+    // All string fields live in m_strings; the members below are handles into it.
+    StringPool m_strings;
+    StringPool::Handle m_playerSessionId;
+    StringPool::Handle m_playerId;
+    StringPool::Handle m_gameSessionId;
+    StringPool::Handle m_fleetId;
     long m_creationTime;
     long m_terminationTime;
     PlayerSessionStatus m_status;
-    char m_ipAddress[MAX_IP_ADDRESS_LENGTH];
+    StringPool::Handle m_ipAddress;
     int m_port;
-    char m_playerData[MAX_PLAYER_DATA_LENGTH];
-    char m_dnsName[MAX_DNS_NAME_LENGTH];
+    StringPool::Handle m_playerData;
+    StringPool::Handle m_dnsName;
 #endif
 };
 
@@ -0,0 +1,163 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Server {
+namespace Model {
+
+/**
+ * <p>Open-addressing hash index from a string key to the position of an entry in its owner's
+ * array. The index only stores hashes and positions; the owner resolves keys when a hash matches,
+ * so no key is stored twice.</p>
+ */
+class StringIndex {
+public:
+    static const int NOT_FOUND = -1;
+
+    StringIndex() : m_slots(nullptr), m_capacity(0), m_count(0) {}
+
+    ~StringIndex() { delete[] m_slots; }
+
+    StringIndex(const StringIndex &other) : m_slots(nullptr), m_capacity(0), m_count(0) { *this = other; }
+
+    StringIndex(StringIndex &&other) : m_slots(other.m_slots), m_capacity(other.m_capacity), m_count(other.m_count) {
+        other.m_slots = nullptr;
+        other.m_capacity = 0;
+        other.m_count = 0;
+    }
+
+    StringIndex &operator=(const StringIndex &other) {
+        if (this != &other) {
+            delete[] m_slots;
+            m_slots = other.m_capacity == 0 ? nullptr : new Slot[other.m_capacity];
+            if (other.m_capacity > 0) {
+                memcpy(m_slots, other.m_slots, sizeof(Slot) * other.m_capacity);
+            }
+            m_capacity = other.m_capacity;
+            m_count = other.m_count;
+        }
+        return *this;
+    }
+
+    StringIndex &operator=(StringIndex &&other) {
+        if (this != &other) {
+            delete[] m_slots;
+            m_slots = other.m_slots;
+            m_capacity = other.m_capacity;
+            m_count = other.m_count;
+            other.m_slots = nullptr;
+            other.m_capacity = 0;
+            other.m_count = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * <p>FNV-1a hash of a null-terminated string.</p>
+     */
+    static inline uint32_t Hash(const char *value) {
+        uint32_t hash = 2166136261u;
+        for (const unsigned char *c = reinterpret_cast<const unsigned char *>(value); *c != 0; c++) {
+            hash = (hash ^ *c) * 16777619u;
+        }
+        return hash;
+    }
+
+    /**
+     * <p>Adds entry under hash. Duplicates are not detected; callers that need first-wins semantics
+     * call Find() first.</p>
+     */
+    inline void Insert(uint32_t hash, int entry) {
+        // Keep the load factor at or below 3/4 so probe sequences stay short.
+        if ((m_count + 1) * 4 > m_capacity * 3) {
+            Rehash(m_capacity == 0 ? MIN_CAPACITY : m_capacity * 2);
+        }
+        Place(hash, entry);
+        m_count++;
+    }
+
+    /**
+     * <p>Returns the first entry stored under hash for which matches(entry) is true, or NOT_FOUND.</p>
+     */
+    template <typename Matches> inline int Find(uint32_t hash, const Matches &matches) const {
+        if (m_count == 0) {
+            return NOT_FOUND;
+        }
+        for (uint32_t i = hash & (m_capacity - 1);; i = (i + 1) & (m_capacity - 1)) {
+            const Slot &slot = m_slots[i];
+            if (slot.entry == NOT_FOUND) {
+                return NOT_FOUND;
+            }
+            if (slot.hash == hash && matches(slot.entry)) {
+                return slot.entry;
+            }
+        }
+    }
+
+    inline void Clear() {
+        delete[] m_slots;
+        m_slots = nullptr;
+        m_capacity = 0;
+        m_count = 0;
+    }
+
+    inline int GetCount() const { return static_cast<int>(m_count); }
+
+private:
+    static const uint32_t MIN_CAPACITY = 8;
+
+    struct Slot {
+        uint32_t hash;
+        int32_t entry;
+    };
+
+    inline void Place(uint32_t hash, int entry) {
+        uint32_t i = hash & (m_capacity - 1);
+        while (m_slots[i].entry != NOT_FOUND) {
+            i = (i + 1) & (m_capacity - 1);
+        }
+        m_slots[i].hash = hash;
+        m_slots[i].entry = entry;
+    }
+
+    inline void Rehash(uint32_t capacity) {
+        Slot *oldSlots = m_slots;
+        uint32_t oldCapacity = m_capacity;
+        m_slots = new Slot[capacity];
+        m_capacity = capacity;
+        for (uint32_t i = 0; i < capacity; i++) {
+            m_slots[i].entry = NOT_FOUND;
+        }
+        // Re-placing in slot order can reorder colliding entries, which is why duplicates are
+        // left to the caller.
+        for (uint32_t i = 0; i < oldCapacity; i++) {
+            if (oldSlots[i].entry != NOT_FOUND) {
+                Place(oldSlots[i].hash, oldSlots[i].entry);
+            }
+        }
+        delete[] oldSlots;
+    }
+
+    Slot *m_slots;
+    uint32_t m_capacity;
+    uint32_t m_count;
+};
+
+} // namespace Model
+} // namespace Server
+} // namespace GameLift
+} // namespace Aws
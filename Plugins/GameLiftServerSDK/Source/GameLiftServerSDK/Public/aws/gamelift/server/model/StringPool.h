@@ -0,0 +1,157 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Server {
+namespace Model {
+
+/**
+ * <p>Backing storage for the string fields of the non-STD model types and of MatchmakerData.</p>
+ * <p>All strings of one model object are appended to a single, exactly sized buffer and referenced
+ * by offset, so an object costs a few hundred bytes instead of reserving the maximum length of
+ * every field inline. Only plain C types are exposed, keeping the layout stable across compilers.</p>
+ * <p>Pointers returned by Get() stay valid until the owning object is modified or destroyed.</p>
+ */
+class StringPool {
+public:
+    /**
+     * <p>Offset of a string in the pool. EMPTY always resolves to "".</p>
+     */
+    typedef uint32_t Handle;
+    static const Handle EMPTY = 0;
+
+    StringPool() : m_data(nullptr), m_size(0), m_capacity(0) {}
+
+    ~StringPool() { delete[] m_data; }
+
+    StringPool(const StringPool &other) : m_data(nullptr), m_size(0), m_capacity(0) { CopyFrom(other); }
+
+    StringPool(StringPool &&other) : m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity) {
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+    }
+
+    StringPool &operator=(const StringPool &other) {
+        if (this != &other) {
+            m_size = 0;
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    StringPool &operator=(StringPool &&other) {
+        if (this != &other) {
+            delete[] m_data;
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_data = nullptr;
+            other.m_size = 0;
+            other.m_capacity = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * <p>Appends value, truncated to maxLength - 1 characters like the fixed-size fields it
+     * replaces, and returns its handle.</p>
+     */
+    inline Handle Add(const char *value, size_t maxLength) {
+        size_t length = value == nullptr || maxLength == 0 ? 0 : strnlen(value, maxLength - 1);
+        if (length == 0) {
+            return EMPTY;
+        }
+        // value may point into this pool, e.g. when one field is set from another; growing frees the
+        // old buffer, so re-base it onto the new one.
+        const bool isPooled = m_data != nullptr && value >= m_data && value < m_data + m_size;
+        const size_t pooledOffset = isPooled ? static_cast<size_t>(value - m_data) : 0;
+        // Offset 0 is reserved so that EMPTY never aliases a real string.
+        Reserve(m_size + (m_size == 0 ? 1 : 0) + length + 1);
+        if (isPooled) {
+            value = m_data + pooledOffset;
+        }
+        if (m_size == 0) {
+            m_data[m_size++] = 0;
+        }
+        Handle handle = m_size;
+        memcpy(m_data + m_size, value, length);
+        m_data[m_size + length] = 0;
+        m_size += static_cast<uint32_t>(length + 1);
+        return handle;
+    }
+
+    /**
+     * <p>Appends value without truncation and returns its handle.</p>
+     */
+    inline Handle Add(const char *value) { return value == nullptr ? EMPTY : Add(value, strlen(value) + 1); }
+
+    /**
+     * <p>Returns the string stored at handle.</p>
+     */
+    inline const char *Get(Handle handle) const { return handle == EMPTY || m_data == nullptr ? "" : m_data + handle; }
+
+    /**
+     * <p>Grows the pool so that totalBytes fit without further allocations.</p>
+     */
+    inline void Reserve(size_t totalBytes) {
+        if (totalBytes <= m_capacity) {
+            return;
+        }
+        size_t newCapacity = m_capacity == 0 ? MIN_CAPACITY : m_capacity;
+        while (newCapacity < totalBytes) {
+            newCapacity *= 2;
+        }
+        char *newData = new char[newCapacity];
+        if (m_size > 0) {
+            memcpy(newData, m_data, m_size);
+        }
+        delete[] m_data;
+        m_data = newData;
+        m_capacity = static_cast<uint32_t>(newCapacity);
+    }
+
+    /**
+     * <p>Number of bytes in use, including strings replaced by later assignments.</p>
+     */
+    inline uint32_t GetSize() const { return m_size; }
+
+private:
+    static const uint32_t MIN_CAPACITY = 64;
+
+    inline void CopyFrom(const StringPool &other) {
+        if (other.m_size > 0) {
+            // Copies are sized exactly; handles stay valid because offsets are preserved.
+            if (other.m_size > m_capacity) {
+                delete[] m_data;
+                m_data = new char[other.m_size];
+                m_capacity = other.m_size;
+            }
+            memcpy(m_data, other.m_data, other.m_size);
+        }
+        m_size = other.m_size;
+    }
+
+    char *m_data;
+    uint32_t m_size;
+    uint32_t m_capacity;
+};
+
+} // namespace Model
+} // namespace Server
+} // namespace GameLift
+} // namespace Aws
@@ -43,6 +43,9 @@ public:
     UpdateGameSession(const GameSession &gameSession, UpdateReason updateReason, std::string backfillTicketId)
         : m_backfillTicketId(backfillTicketId), m_gameSession(gameSession), m_updateReason(updateReason) {}
 
+    UpdateGameSession(GameSession &&gameSession, UpdateReason updateReason, std::string backfillTicketId)
+        : m_backfillTicketId(backfillTicketId), m_gameSession(std::move(gameSession)), m_updateReason(updateReason) {}
+
     /**
      * <p>Destructor.</p>
      */
@@ -97,6 +100,12 @@ public:
         m_backfillTicketId[MAX_BACKFILL_TICKET_ID_LENGTH - 1] = '\0';
     }
 
+    UpdateGameSession(GameSession &&gameSession, UpdateReason updateReason, const char *backfillTicketId)
+        : m_gameSession(std::move(gameSession)), m_updateReason(updateReason) {
+        strncpy(m_backfillTicketId, backfillTicketId, MAX_BACKFILL_TICKET_ID_LENGTH - 1);
+        m_backfillTicketId[MAX_BACKFILL_TICKET_ID_LENGTH - 1] = '\0';
+    }
+
     /**
      * <p>Destructor.</p>
      */
@@ -149,7 +158,7 @@ public:
     /**
      * <p>The current state of the GameSession.</p>
      */
-    inline GameSession GetGameSession() const { return m_gameSession; }
+    inline const GameSession &GetGameSession() const { return m_gameSession; }
 
     /**
      * <p>The reason that this update is being posted to the game server.</p>
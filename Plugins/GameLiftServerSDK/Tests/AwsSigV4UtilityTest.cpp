@@ -0,0 +1,92 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/security/AwsSigV4Utility.h>
+#include <ctime>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+
+using Aws::GameLift::Internal::AwsCredentials;
+using Aws::GameLift::Internal::AwsSigV4Utility;
+using Aws::GameLift::Internal::SigV4Parameters;
+
+namespace {
+
+// Credentials, time, region and service of the AWS Signature Version 4 test suite
+// (https://docs.aws.amazon.com/general/latest/gr/signature-v4-test-suite.html).
+const char *const TEST_SUITE_ACCESS_KEY = "AKIDEXAMPLE";
+const char *const TEST_SUITE_SECRET_KEY = "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY";
+const char *const TEST_SUITE_REGION = "us-east-1";
+const char *const TEST_SUITE_SERVICE = "service";
+const char *const TEST_SUITE_DATE_TIME = "20150830T123600Z";
+
+std::tm TestSuiteRequestTime() {
+    std::tm requestTime = {};
+    requestTime.tm_year = 2015 - 1900;
+    requestTime.tm_mon = 7;
+    requestTime.tm_mday = 30;
+    requestTime.tm_hour = 12;
+    requestTime.tm_min = 36;
+    return requestTime;
+}
+
+SigV4Parameters TestSuiteParameters(const std::string &sessionToken = "", const std::string &serviceName = TEST_SUITE_SERVICE) {
+    return SigV4Parameters(TEST_SUITE_REGION, AwsCredentials(TEST_SUITE_ACCESS_KEY, TEST_SUITE_SECRET_KEY, sessionToken), {}, TestSuiteRequestTime(),
+                           serviceName);
+}
+
+const std::map<std::string, std::string> TEST_SUITE_HEADERS = {{"Host", "example.amazonaws.com"}};
+
+} // namespace
+
+TEST(AwsSigV4UtilityTest, GIVEN_GetVanillaTestVector_WHEN_GenerateSigV4Headers_THEN_MatchesPublishedAuthorization) {
+    auto outcome = AwsSigV4Utility::GenerateSigV4Headers(TestSuiteParameters(), "GET", "/", TEST_SUITE_HEADERS, "");
+
+    ASSERT_TRUE(outcome.IsSuccess()) << outcome.GetError();
+    const std::map<std::string, std::string> &headers = outcome.GetResult();
+    EXPECT_EQ(2u, headers.size());
+    EXPECT_EQ(TEST_SUITE_DATE_TIME, headers.at("X-Amz-Date"));
+    EXPECT_EQ("AWS4-HMAC-SHA256 Credential=AKIDEXAMPLE/20150830/us-east-1/service/aws4_request, SignedHeaders=host;x-amz-date, "
+              "Signature=5fa00fa31553b73ebf1942676e86291e8372ff2a2260956d9b8aae1d763fbf31",
+              headers.at("Authorization"));
+}
+
+TEST(AwsSigV4UtilityTest, GIVEN_PostVanillaTestVector_WHEN_GenerateSigV4Headers_THEN_MatchesPublishedAuthorization) {
+    auto outcome = AwsSigV4Utility::GenerateSigV4Headers(TestSuiteParameters(), "POST", "/", TEST_SUITE_HEADERS, "");
+
+    ASSERT_TRUE(outcome.IsSuccess()) << outcome.GetError();
+    EXPECT_EQ("AWS4-HMAC-SHA256 Credential=AKIDEXAMPLE/20150830/us-east-1/service/aws4_request, SignedHeaders=host;x-amz-date, "
+              "Signature=5da7c1a2acd57cee7505fc6676e4e544621c30862966e37dddb68e92efbe5d6b",
+              outcome.GetResult().at("Authorization"));
+}
+
+TEST(AwsSigV4UtilityTest, GIVEN_SessionTokenAndDefaultService_WHEN_GenerateSigV4Headers_THEN_SignsTokenForGameLift) {
+    const SigV4Parameters parameters(TEST_SUITE_REGION, AwsCredentials(TEST_SUITE_ACCESS_KEY, TEST_SUITE_SECRET_KEY, "token"), {}, TestSuiteRequestTime());
+    auto outcome = AwsSigV4Utility::GenerateSigV4Headers(parameters, "POST", "/", TEST_SUITE_HEADERS, "{}");
+
+    ASSERT_TRUE(outcome.IsSuccess()) << outcome.GetError();
+    const std::map<std::string, std::string> &headers = outcome.GetResult();
+    EXPECT_EQ("token", headers.at("X-Amz-Security-Token"));
+    const std::string &authorization = headers.at("Authorization");
+    EXPECT_EQ(0u, authorization.find("AWS4-HMAC-SHA256 Credential=AKIDEXAMPLE/20150830/us-east-1/gamelift/aws4_request, "
+                                     "SignedHeaders=host;x-amz-date;x-amz-security-token, Signature="))
+        << authorization;
+}
+
+TEST(AwsSigV4UtilityTest, GIVEN_MissingSecretKey_WHEN_GenerateSigV4Headers_THEN_ReturnsError) {
+    const SigV4Parameters parameters(TEST_SUITE_REGION, AwsCredentials(TEST_SUITE_ACCESS_KEY, "", ""), {}, TestSuiteRequestTime());
+    auto outcome = AwsSigV4Utility::GenerateSigV4Headers(parameters, "GET", "/", TEST_SUITE_HEADERS, "");
+
+    EXPECT_FALSE(outcome.IsSuccess());
+    EXPECT_EQ("SecretKey is required", outcome.GetError());
+}
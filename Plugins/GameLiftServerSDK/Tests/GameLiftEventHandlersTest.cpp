@@ -0,0 +1,124 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/network/GameLiftEventHandlers.h>
+#include <aws/gamelift/internal/network/callback/CreateGameSessionCallback.h>
+#include <aws/gamelift/internal/network/callback/DescribePlayerSessionsCallback.h>
+#include <aws/gamelift/internal/network/callback/GetComputeCertificateCallback.h>
+#include <aws/gamelift/internal/network/callback/GetFleetRoleCredentialsCallback.h>
+#include <aws/gamelift/internal/network/callback/RefreshConnectionCallback.h>
+#include <aws/gamelift/internal/network/callback/StartMatchBackfillCallback.h>
+#include <aws/gamelift/internal/network/callback/TerminateProcessCallback.h>
+#include <aws/gamelift/internal/network/callback/UpdateGameSessionCallback.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace Aws::GameLift::Internal;
+
+namespace {
+
+struct EventCase {
+    std::string action;
+    GameLiftEvent event;
+};
+
+const EventCase EVENT_CASES[] = {
+    {CreateGameSessionCallback::CREATE_GAME_SESSION, GameLiftEvent::CREATE_GAME_SESSION},
+    {DescribePlayerSessionsCallback::DESCRIBE_PLAYER_SESSIONS, GameLiftEvent::DESCRIBE_PLAYER_SESSIONS},
+    {GetComputeCertificateCallback::GET_COMPUTE_CERTIFICATE, GameLiftEvent::GET_COMPUTE_CERTIFICATE},
+    {GetFleetRoleCredentialsCallback::GET_FLEET_ROLE_CREDENTIALS, GameLiftEvent::GET_FLEET_ROLE_CREDENTIALS},
+    {RefreshConnectionCallback::REFRESH_CONNECTION, GameLiftEvent::REFRESH_CONNECTION},
+    {StartMatchBackfillCallback::START_MATCH_BACKFILL, GameLiftEvent::START_MATCH_BACKFILL},
+    {TerminateProcessCallback::TERMINATE_PROCESS, GameLiftEvent::TERMINATE_PROCESS},
+    {UpdateGameSessionCallback::UPDATE_GAME_SESSION, GameLiftEvent::UPDATE_GAME_SESSION},
+};
+
+// A handler that stores its ID in calledId, to tell which registration a lookup found.
+GameLiftEventHandlers::Handler MakeHandler(int id, int &calledId) {
+    return [id, &calledId](std::string) {
+        calledId = id;
+        return ResponseOutcome(ResponsePayload());
+    };
+}
+
+// The ID of the handler that ran, or 0 if there is none.
+int CallFound(const GameLiftEventHandlers &handlers, const std::string &action, int &calledId) {
+    calledId = 0;
+    const GameLiftEventHandlers::Handler *handler = handlers.Find(action);
+    if (handler != nullptr) {
+        (*handler)("{}");
+    }
+    return calledId;
+}
+
+} // namespace
+
+TEST(GameLiftEventHandlersTest, GIVEN_EveryEventAction_WHEN_ParseEvent_THEN_ReturnsItsEvent) {
+    for (const EventCase &eventCase : EVENT_CASES) {
+        GameLiftEvent event = GameLiftEvent::COUNT;
+        EXPECT_TRUE(GameLiftEventHandlers::ParseEvent(eventCase.action.c_str(), eventCase.action.size(), event)) << eventCase.action;
+        EXPECT_EQ(eventCase.event, event) << eventCase.action;
+    }
+}
+
+TEST(GameLiftEventHandlersTest, GIVEN_UnknownAction_WHEN_ParseEvent_THEN_Rejects) {
+    std::vector<std::string> unknownActions = {"", "HeartbeatServerProcess", "ActivateServerProcess", "createGameSession"};
+    for (const EventCase &eventCase : EVENT_CASES) {
+        // Same length and first character land in the same slot, so only the compare can reject these.
+        std::string lastChanged = eventCase.action;
+        lastChanged.back() = lastChanged.back() == 'x' ? 'y' : 'x';
+        std::string middleChanged = eventCase.action;
+        middleChanged[middleChanged.size() / 2] = '_';
+        unknownActions.push_back(lastChanged);
+        unknownActions.push_back(middleChanged);
+        unknownActions.push_back(eventCase.action.substr(0, eventCase.action.size() - 1));
+        unknownActions.push_back(eventCase.action + "s");
+    }
+
+    for (const std::string &action : unknownActions) {
+        GameLiftEvent event = GameLiftEvent::COUNT;
+        EXPECT_FALSE(GameLiftEventHandlers::ParseEvent(action.c_str(), action.size(), event)) << action;
+        EXPECT_EQ(GameLiftEvent::COUNT, event) << action;
+    }
+
+    // The length bounds the compare; a prefix of a longer buffer is matched on its own.
+    const std::string padded = std::string(CreateGameSessionCallback::CREATE_GAME_SESSION) + "Extra";
+    GameLiftEvent event = GameLiftEvent::COUNT;
+    EXPECT_TRUE(GameLiftEventHandlers::ParseEvent(padded.c_str(), padded.size() - 5, event));
+    EXPECT_EQ(GameLiftEvent::CREATE_GAME_SESSION, event);
+}
+
+TEST(GameLiftEventHandlersTest, GIVEN_RepeatedRegister_WHEN_Find_THEN_KeepsEarlierHandlersAndReplacesTheSameAction) {
+    GameLiftEventHandlers handlers;
+    int calledId = 0;
+    EXPECT_EQ(nullptr, handlers.Find(CreateGameSessionCallback::CREATE_GAME_SESSION));
+
+    for (size_t i = 0; i < sizeof(EVENT_CASES) / sizeof(EVENT_CASES[0]); i++) {
+        EXPECT_TRUE(handlers.Register(EVENT_CASES[i].action, MakeHandler(static_cast<int>(i) + 1, calledId)));
+    }
+    EXPECT_FALSE(handlers.Register("HeartbeatServerProcess", MakeHandler(100, calledId)));
+    EXPECT_EQ(nullptr, handlers.Find("HeartbeatServerProcess"));
+
+    const GameLiftEventHandlers::Handler *firstTerminate = handlers.Find(TerminateProcessCallback::TERMINATE_PROCESS);
+    ASSERT_NE(nullptr, firstTerminate);
+    EXPECT_TRUE(handlers.Register(TerminateProcessCallback::TERMINATE_PROCESS, MakeHandler(200, calledId)));
+
+    for (size_t i = 0; i < sizeof(EVENT_CASES) / sizeof(EVENT_CASES[0]); i++) {
+        const int expectedId = EVENT_CASES[i].event == GameLiftEvent::TERMINATE_PROCESS ? 200 : static_cast<int>(i) + 1;
+        EXPECT_EQ(expectedId, CallFound(handlers, EVENT_CASES[i].action, calledId)) << EVENT_CASES[i].action;
+    }
+
+    // A dispatch that looked the handler up before the re-registration can still run it.
+    (*firstTerminate)("{}");
+    EXPECT_EQ(static_cast<int>(GameLiftEvent::TERMINATE_PROCESS) + 1, calledId);
+}
@@ -0,0 +1,82 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/GameLiftServerStateStore.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+using Aws::GameLift::Internal::GameLiftServerStateSnapshot;
+using Aws::GameLift::Internal::GameLiftServerStateStore;
+
+namespace {
+
+void SetGameSessionId(GameLiftServerStateStore &store, const std::string &gameSessionId) {
+    store.Update([&gameSessionId](GameLiftServerStateSnapshot &state) {
+        state.gameSessionId = gameSessionId;
+        return true;
+    });
+}
+
+} // namespace
+
+TEST(GameLiftServerStateStoreTest, GIVEN_OpenReader_WHEN_Update_THEN_ReaderKeepsItsSnapshot) {
+    GameLiftServerStateStore store;
+    SetGameSessionId(store, "gsess-1");
+
+    const GameLiftServerStateStore::Reader reader = store.Get();
+    for (int i = 2; i < 10; i++) {
+        SetGameSessionId(store, "gsess-" + std::to_string(i));
+    }
+
+    EXPECT_EQ("gsess-1", reader->gameSessionId);
+    EXPECT_EQ("gsess-9", store.Get()->gameSessionId);
+    EXPECT_EQ(9u, store.Get()->version);
+}
+
+TEST(GameLiftServerStateStoreTest, GIVEN_GameSessionIdCStr_WHEN_SnapshotReplaced_THEN_StaysValid) {
+    GameLiftServerStateStore store;
+    EXPECT_STREQ("", store.Get()->gameSessionIdCStr);
+
+    SetGameSessionId(store, "gsess-1");
+    const char *gameSessionId = store.Get()->gameSessionIdCStr;
+    for (int i = 2; i < 10; i++) {
+        SetGameSessionId(store, "gsess-" + std::to_string(i));
+    }
+    SetGameSessionId(store, "gsess-1");
+
+    EXPECT_STREQ("gsess-1", gameSessionId);
+    EXPECT_EQ(gameSessionId, store.Get()->gameSessionIdCStr);
+}
+
+TEST(GameLiftServerStateStoreTest, GIVEN_ConcurrentReaders_WHEN_Update_THEN_EverySnapshotIsConsistent) {
+    GameLiftServerStateStore store;
+    std::thread writer([&store]() {
+        for (int i = 1; i <= 20000; i++) {
+            store.Update([i](GameLiftServerStateSnapshot &state) {
+                state.gameSessionId = std::to_string(i);
+                state.terminationTime = i;
+                return true;
+            });
+        }
+    });
+
+    bool consistent = true;
+    for (int read = 0; read < 100000 && consistent; read++) {
+        const GameLiftServerStateStore::Reader state = store.Get();
+        consistent = state->version == 0 || (std::to_string(state->version) == state->gameSessionId && static_cast<long>(state->version) == state->terminationTime);
+    }
+    writer.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(20000u, store.Get()->version);
+}
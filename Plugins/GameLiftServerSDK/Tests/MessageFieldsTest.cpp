@@ -0,0 +1,220 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/model/ResponseMessage.h>
+#include <aws/gamelift/internal/model/message/CreateGameSessionMessage.h>
+#include <aws/gamelift/internal/model/message/RefreshConnectionMessage.h>
+#include <aws/gamelift/internal/model/message/TerminateProcessMessage.h>
+#include <aws/gamelift/internal/model/message/UpdateGameSessionMessage.h>
+#include <aws/gamelift/internal/model/request/AcceptPlayerSessionRequest.h>
+#include <aws/gamelift/internal/model/request/ActivateGameSessionRequest.h>
+#include <aws/gamelift/internal/model/request/ActivateServerProcessRequest.h>
+#include <aws/gamelift/internal/model/request/HeartbeatServerProcessRequest.h>
+#include <aws/gamelift/internal/model/request/RemovePlayerSessionRequest.h>
+#include <aws/gamelift/internal/model/request/TerminateServerProcessRequest.h>
+#include <aws/gamelift/internal/model/request/UpdatePlayerSessionCreationPolicyRequest.h>
+#include <aws/gamelift/internal/model/request/WebSocketDescribePlayerSessionsRequest.h>
+#include <aws/gamelift/internal/model/request/WebSocketGetComputeCertificateRequest.h>
+#include <aws/gamelift/internal/model/request/WebSocketGetFleetRoleCredentialsRequest.h>
+#include <aws/gamelift/internal/model/request/WebSocketStopMatchBackfillRequest.h>
+#include <aws/gamelift/internal/model/response/WebSocketDescribePlayerSessionsResponse.h>
+#include <aws/gamelift/internal/model/response/WebSocketGetComputeCertificateResponse.h>
+#include <aws/gamelift/internal/model/response/WebSocketGetFleetRoleCredentialsResponse.h>
+#include <aws/gamelift/internal/model/response/WebSocketStartMatchBackfillResponse.h>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace Aws::GameLift::Internal;
+
+namespace {
+
+// Deserializes the JSON into a new message of type T and serializes it back. The request ID is
+// set beforehand, so the output shows whether a failed parse left the message untouched.
+template <typename T> std::string RoundTrip(const char *json) {
+    T typed;
+    Message &message = typed;
+    message.SetRequestId("unset");
+    message.Deserialize(std::string(json));
+    return message.Serialize();
+}
+
+struct MessageCase {
+    const char *type;
+    const char *name;
+    std::string (*roundTrip)(const char *);
+    const char *input;
+    // What the hand-written serializers that preceded the field tables wrote for the input.
+    const char *expected;
+};
+
+const MessageCase MESSAGE_CASES[] = {
+    {"ResponseMessage", "Full", &RoundTrip<ResponseMessage>, R"({"Action":"AcceptPlayerSession","RequestId":"req-1","StatusCode":400,"ErrorMessage":"Invalid player session"})",
+     R"({"Action":"AcceptPlayerSession","RequestId":"req-1","StatusCode":400,"ErrorMessage":"Invalid player session"})"},
+    {"ResponseMessage", "Empty", &RoundTrip<ResponseMessage>, R"({})",
+     R"({})"},
+    {"ResponseMessage", "WrongTypes", &RoundTrip<ResponseMessage>, R"({"Action":7,"RequestId":["a"],"StatusCode":"400","ErrorMessage":{"x":1}})",
+     R"({})"},
+    {"ResponseMessage", "NegativeStatus", &RoundTrip<ResponseMessage>, R"({"Action":"A","RequestId":"r","StatusCode":-5,"ErrorMessage":""})",
+     R"({"Action":"A","RequestId":"r"})"},
+    {"ResponseMessage", "Duplicates", &RoundTrip<ResponseMessage>, R"({"Action":"A","Action":"B","RequestId":"r1","RequestId":"r2","StatusCode":200,"StatusCode":500,"ErrorMessage":"first","ErrorMessage":"second"})",
+     R"({"Action":"A","RequestId":"r1","StatusCode":200,"ErrorMessage":"first"})"},
+    {"ResponseMessage", "UnknownAndNested", &RoundTrip<ResponseMessage>, R"({"Extra":{"Action":"Nested","RequestId":"n"},"Action":"Top","List":[1,{"StatusCode":9}],"RequestId":"t","StatusCode":201})",
+     R"({"Action":"Top","RequestId":"t","StatusCode":201})"},
+    {"ResponseMessage", "EscapedStrings", &RoundTrip<ResponseMessage>, R"({"Action":"Tab\tQuote\"Slash\\","RequestId":"é中","ErrorMessage":"line\nbreak \/ 😀"})",
+     R"({"Action":"Tab\tQuote\"Slash\\","RequestId":"é中","ErrorMessage":"line\nbreak / 😀"})"},
+    {"ResponseMessage", "LargeNumbers", &RoundTrip<ResponseMessage>, R"({"Action":"A","RequestId":"r","StatusCode":4294967296})",
+     R"({"Action":"A","RequestId":"r"})"},
+    {"ResponseMessage", "Float", &RoundTrip<ResponseMessage>, R"({"Action":"A","RequestId":"r","StatusCode":12.5})",
+     R"({"Action":"A","RequestId":"r"})"},
+    {"ResponseMessage", "Truncated", &RoundTrip<ResponseMessage>, R"({"Action":"A","RequestId":"r","StatusCode":)",
+     R"({"RequestId":"unset"})"},
+    {"ResponseMessage", "TrailingGarbage", &RoundTrip<ResponseMessage>, R"({"Action":"A","RequestId":"r"} junk)",
+     R"({"RequestId":"unset"})"},
+    {"CreateGameSessionMessage", "Full", &RoundTrip<CreateGameSessionMessage>, R"({"Action":"CreateGameSession","RequestId":"req-2","GameSessionId":"arn:aws:gamelift:us-west-2::gamesession/fleet-1/gsess-1","GameSessionName":"Odin match","GameSessionData":"map=Lvl_Shooter","MatchmakerData":"{\"matchId\":\"m-1\"}","DnsName":"ec2-1-2-3-4.compute.amazonaws.com","IpAddress":"1.2.3.4","MaximumPlayerSessionCount":16,"Port":7777,"GameProperties":{"mode":"Shooter","difficulty":"hard","empty":""}})",
+     R"({"Action":"CreateGameSession","RequestId":"req-2","GameSessionId":"arn:aws:gamelift:us-west-2::gamesession/fleet-1/gsess-1","GameSessionName":"Odin match","GameSessionData":"map=Lvl_Shooter","MatchmakerData":"{\"matchId\":\"m-1\"}","DnsName":"ec2-1-2-3-4.compute.amazonaws.com","IpAddress":"1.2.3.4","MaximumPlayerSessionCount":16,"Port":7777,"GameProperties":{"difficulty":"hard","empty":"","mode":"Shooter"}})"},
+    {"CreateGameSessionMessage", "Empty", &RoundTrip<CreateGameSessionMessage>, R"({"Action":"CreateGameSession","RequestId":"req-3"})",
+     R"({"Action":"CreateGameSession","RequestId":"req-3","GameProperties":{}})"},
+    {"CreateGameSessionMessage", "WrongTypes", &RoundTrip<CreateGameSessionMessage>, R"({"Action":"CreateGameSession","RequestId":"req-4","GameSessionId":1,"GameSessionName":null,"MaximumPlayerSessionCount":"16","Port":true})",
+     R"({"Action":"CreateGameSession","RequestId":"req-4","GameProperties":{}})"},
+    {"CreateGameSessionMessage", "PropertiesWithNonStrings", &RoundTrip<CreateGameSessionMessage>, R"({"Action":"CreateGameSession","RequestId":"req-5","GameProperties":{"a":"1","b":2,"c":null,"d":{"x":"y"},"e":"5"}})",
+     R"({"Action":"CreateGameSession","RequestId":"req-5","GameProperties":{"a":"1","e":"5"}})"},
+    {"CreateGameSessionMessage", "Duplicates", &RoundTrip<CreateGameSessionMessage>, R"({"Action":"CreateGameSession","RequestId":"req-6","GameSessionId":"first","GameSessionId":"second","Port":1,"Port":2,"GameProperties":{"k":"v1","k":"v2"},"GameProperties":{"other":"x"}})",
+     R"({"Action":"CreateGameSession","RequestId":"req-6","GameSessionId":"first","Port":1,"GameProperties":{"k":"v2"}})"},
+    {"CreateGameSessionMessage", "NegativeCounts", &RoundTrip<CreateGameSessionMessage>, R"({"Action":"CreateGameSession","RequestId":"req-7","MaximumPlayerSessionCount":-1,"Port":0})",
+     R"({"Action":"CreateGameSession","RequestId":"req-7","GameProperties":{}})"},
+    {"RefreshConnectionMessage", "Full", &RoundTrip<RefreshConnectionMessage>, R"({"Action":"RefreshConnection","RequestId":"req-8","RefreshConnectionEndpoint":"wss://us-west-2.api.amazongamelift.com","AuthToken":"token-123"})",
+     R"({"Action":"RefreshConnection","RequestId":"req-8","RefreshConnectionEndpoint":"wss://us-west-2.api.amazongamelift.com","AuthToken":"token-123"})"},
+    {"RefreshConnectionMessage", "WrongTypes", &RoundTrip<RefreshConnectionMessage>, R"({"Action":"RefreshConnection","RequestId":"req-9","RefreshConnectionEndpoint":false,"AuthToken":123})",
+     R"({"Action":"RefreshConnection","RequestId":"req-9"})"},
+    {"RefreshConnectionMessage", "Duplicates", &RoundTrip<RefreshConnectionMessage>, R"({"AuthToken":"a","RefreshConnectionEndpoint":"e1","AuthToken":"b","RefreshConnectionEndpoint":"e2","Action":"RefreshConnection"})",
+     R"({"Action":"RefreshConnection","RefreshConnectionEndpoint":"e1","AuthToken":"a"})"},
+    {"TerminateProcessMessage", "Full", &RoundTrip<TerminateProcessMessage>, R"({"Action":"TerminateProcess","RequestId":"req-10","TerminationTime":1760000000123})",
+     R"({"Action":"TerminateProcess","RequestId":"req-10","TerminationTime":1760000000123})"},
+    {"TerminateProcessMessage", "WrongTypes", &RoundTrip<TerminateProcessMessage>, R"({"Action":"TerminateProcess","RequestId":"req-11","TerminationTime":"1760000000123"})",
+     R"({"Action":"TerminateProcess","RequestId":"req-11"})"},
+    {"TerminateProcessMessage", "Negative", &RoundTrip<TerminateProcessMessage>, R"({"Action":"TerminateProcess","RequestId":"req-12","TerminationTime":-1760000000123})",
+     R"({"Action":"TerminateProcess","RequestId":"req-12"})"},
+    {"TerminateProcessMessage", "Small", &RoundTrip<TerminateProcessMessage>, R"({"Action":"TerminateProcess","RequestId":"req-13","TerminationTime":42})",
+     R"({"Action":"TerminateProcess","RequestId":"req-13","TerminationTime":42})"},
+    {"UpdateGameSessionMessage", "Full", &RoundTrip<UpdateGameSessionMessage>, R"({"Action":"UpdateGameSession","RequestId":"req-14","UpdateReason":"MATCHMAKING_DATA_UPDATED","BackfillTicketId":"ticket-1","GameSession":{"GameSessionId":"gsess-1","Name":"Odin match","FleetId":"fleet-1","MaximumPlayerSessionCount":16,"Port":7777,"IpAddress":"1.2.3.4","GameSessionData":"data","MatchmakerData":"{}","GameProperties":{"mode":"Horror"},"DnsName":"dns"}})",
+     R"({"Action":"UpdateGameSession","RequestId":"req-14","GameSession":{"GameSessionId":"gsess-1","Name":"Odin match","FleetId":"fleet-1","GameSessionData":"data","MatchmakerData":"{}","DnsName":"dns","IpAddress":"1.2.3.4","MaximumPlayerSessionCount":16,"Port":7777,"GameProperties":{"mode":"Horror"}},"UpdateReason":"MATCHMAKING_DATA_UPDATED","BackfillTicketId":"ticket-1"})"},
+    {"UpdateGameSessionMessage", "EmptySession", &RoundTrip<UpdateGameSessionMessage>, R"({"Action":"UpdateGameSession","RequestId":"req-15","GameSession":{}})",
+     R"({"Action":"UpdateGameSession","RequestId":"req-15","GameSession":{"GameProperties":{}}})"},
+    {"UpdateGameSessionMessage", "MissingSession", &RoundTrip<UpdateGameSessionMessage>, R"({"Action":"UpdateGameSession","RequestId":"req-16","UpdateReason":"BACKFILL_FAILED"})",
+     R"({"Action":"UpdateGameSession","RequestId":"req-16","GameSession":{"GameProperties":{}},"UpdateReason":"BACKFILL_FAILED"})"},
+    {"UpdateGameSessionMessage", "WrongTypes", &RoundTrip<UpdateGameSessionMessage>, R"({"Action":"UpdateGameSession","RequestId":"req-17","UpdateReason":5,"BackfillTicketId":[],"GameSession":{"GameSessionId":7,"Port":"7777"}})",
+     R"({"Action":"UpdateGameSession","RequestId":"req-17","GameSession":{"GameProperties":{}}})"},
+    {"UpdateGameSessionMessage", "Duplicates", &RoundTrip<UpdateGameSessionMessage>, R"({"Action":"UpdateGameSession","RequestId":"req-18","GameSession":{"Name":"a","Name":"b"},"GameSession":{"Name":"c"},"UpdateReason":"x","UpdateReason":"y"})",
+     R"({"Action":"UpdateGameSession","RequestId":"req-18","GameSession":{"Name":"a","GameProperties":{}},"UpdateReason":"x"})"},
+    {"AcceptPlayerSessionRequest", "Full", &RoundTrip<AcceptPlayerSessionRequest>, R"({"Action":"AcceptPlayerSession","RequestId":"req-19","GameSessionId":"gsess-1","PlayerSessionId":"psess-1"})",
+     R"({"Action":"AcceptPlayerSession","RequestId":"req-19","GameSessionId":"gsess-1","PlayerSessionId":"psess-1"})"},
+    {"AcceptPlayerSessionRequest", "Empty", &RoundTrip<AcceptPlayerSessionRequest>, R"({})",
+     R"({})"},
+    {"AcceptPlayerSessionRequest", "WrongTypes", &RoundTrip<AcceptPlayerSessionRequest>, R"({"Action":"AcceptPlayerSession","RequestId":"req-20","GameSessionId":{},"PlayerSessionId":0})",
+     R"({"Action":"AcceptPlayerSession","RequestId":"req-20"})"},
+    {"ActivateGameSessionRequest", "Full", &RoundTrip<ActivateGameSessionRequest>, R"({"Action":"ActivateGameSession","RequestId":"req-21","GameSessionId":"gsess-1"})",
+     R"({"Action":"ActivateGameSession","RequestId":"req-21","GameSessionId":"gsess-1"})"},
+    {"ActivateGameSessionRequest", "Empty", &RoundTrip<ActivateGameSessionRequest>, R"({})",
+     R"({})"},
+    {"ActivateServerProcessRequest", "Full", &RoundTrip<ActivateServerProcessRequest>, R"({"Action":"ActivateServerProcess","RequestId":"req-22","SdkVersion":"5.4.0","SdkLanguage":"Cpp","SdkToolName":"UnrealEngine","SdkToolVersion":"5.6","Port":7777,"LogPaths":["/local/game/logs","/local/game/Saved/Logs"]})",
+     R"({"Action":"ActivateServerProcess","RequestId":"req-22","SdkVersion":"5.4.0","SdkLanguage":"Cpp","SdkToolName":"UnrealEngine","SdkToolVersion":"5.6","Port":7777,"LogPaths":["/local/game/logs","/local/game/Saved/Logs"]})"},
+    {"ActivateServerProcessRequest", "EmptyLogPaths", &RoundTrip<ActivateServerProcessRequest>, R"({"Action":"ActivateServerProcess","RequestId":"req-23","Port":0,"LogPaths":[]})",
+     R"({"Action":"ActivateServerProcess","RequestId":"req-23"})"},
+    {"ActivateServerProcessRequest", "MissingLogPaths", &RoundTrip<ActivateServerProcessRequest>, R"({"Action":"ActivateServerProcess","RequestId":"req-24","SdkVersion":"5.4.0"})",
+     R"({"Action":"ActivateServerProcess","RequestId":"req-24","SdkVersion":"5.4.0"})"},
+    {"ActivateServerProcessRequest", "WrongTypes", &RoundTrip<ActivateServerProcessRequest>, R"({"Action":"ActivateServerProcess","RequestId":"req-25","SdkVersion":5,"Port":"7777","LogPaths":"/logs"})",
+     R"({"Action":"ActivateServerProcess","RequestId":"req-25"})"},
+    {"ActivateServerProcessRequest", "Duplicates", &RoundTrip<ActivateServerProcessRequest>, R"({"Action":"ActivateServerProcess","RequestId":"req-26","LogPaths":["a"],"LogPaths":["b","c"],"Port":1,"Port":2})",
+     R"({"Action":"ActivateServerProcess","RequestId":"req-26","Port":1,"LogPaths":["a"]})"},
+    {"HeartbeatServerProcessRequest", "Healthy", &RoundTrip<HeartbeatServerProcessRequest>, R"({"Action":"HeartbeatServerProcess","RequestId":"req-27","HealthStatus":true})",
+     R"({"Action":"HeartbeatServerProcess","RequestId":"req-27","HealthStatus":true})"},
+    {"HeartbeatServerProcessRequest", "Unhealthy", &RoundTrip<HeartbeatServerProcessRequest>, R"({"Action":"HeartbeatServerProcess","RequestId":"req-28","HealthStatus":false})",
+     R"({"Action":"HeartbeatServerProcess","RequestId":"req-28","HealthStatus":false})"},
+    {"HeartbeatServerProcessRequest", "WrongTypes", &RoundTrip<HeartbeatServerProcessRequest>, R"({"Action":"HeartbeatServerProcess","RequestId":"req-29","HealthStatus":"true"})",
+     R"({"Action":"HeartbeatServerProcess","RequestId":"req-29","HealthStatus":false})"},
+    {"HeartbeatServerProcessRequest", "Duplicates", &RoundTrip<HeartbeatServerProcessRequest>, R"({"Action":"HeartbeatServerProcess","RequestId":"req-30","HealthStatus":true,"HealthStatus":false})",
+     R"({"Action":"HeartbeatServerProcess","RequestId":"req-30","HealthStatus":true})"},
+    {"RemovePlayerSessionRequest", "Full", &RoundTrip<RemovePlayerSessionRequest>, R"({"Action":"RemovePlayerSession","RequestId":"req-31","GameSessionId":"gsess-1","PlayerSessionId":"psess-1"})",
+     R"({"Action":"RemovePlayerSession","RequestId":"req-31","GameSessionId":"gsess-1","PlayerSessionId":"psess-1"})"},
+    {"TerminateServerProcessRequest", "Full", &RoundTrip<TerminateServerProcessRequest>, R"({"Action":"TerminateServerProcess","RequestId":"req-32"})",
+     R"({"Action":"TerminateServerProcess","RequestId":"req-32"})"},
+    {"TerminateServerProcessRequest", "Extra", &RoundTrip<TerminateServerProcessRequest>, R"({"Action":"TerminateServerProcess","RequestId":"req-33","GameSessionId":"ignored"})",
+     R"({"Action":"TerminateServerProcess","RequestId":"req-33"})"},
+    {"UpdatePlayerSessionCreationPolicyRequest", "AcceptAll", &RoundTrip<UpdatePlayerSessionCreationPolicyRequest>, R"({"Action":"UpdatePlayerSessionCreationPolicy","RequestId":"req-34","GameSessionId":"gsess-1","PlayerSessionPolicy":"ACCEPT_ALL"})",
+     R"({"Action":"UpdatePlayerSessionCreationPolicy","RequestId":"req-34","GameSessionId":"gsess-1","PlayerSessionPolicy":"ACCEPT_ALL"})"},
+    {"UpdatePlayerSessionCreationPolicyRequest", "DenyAll", &RoundTrip<UpdatePlayerSessionCreationPolicyRequest>, R"({"Action":"UpdatePlayerSessionCreationPolicy","RequestId":"req-35","GameSessionId":"gsess-1","PlayerSessionPolicy":"DENY_ALL"})",
+     R"({"Action":"UpdatePlayerSessionCreationPolicy","RequestId":"req-35","GameSessionId":"gsess-1","PlayerSessionPolicy":"DENY_ALL"})"},
+    {"UpdatePlayerSessionCreationPolicyRequest", "Unknown", &RoundTrip<UpdatePlayerSessionCreationPolicyRequest>, R"({"Action":"UpdatePlayerSessionCreationPolicy","RequestId":"req-36","PlayerSessionPolicy":"SOMETIMES"})",
+     R"({"Action":"UpdatePlayerSessionCreationPolicy","RequestId":"req-36","PlayerSessionPolicy":"NOT_SET"})"},
+    {"UpdatePlayerSessionCreationPolicyRequest", "WrongTypes", &RoundTrip<UpdatePlayerSessionCreationPolicyRequest>, R"({"Action":"UpdatePlayerSessionCreationPolicy","RequestId":"req-37","PlayerSessionPolicy":1})",
+     R"({"Action":"UpdatePlayerSessionCreationPolicy","RequestId":"req-37","PlayerSessionPolicy":"NOT_SET"})"},
+    {"UpdatePlayerSessionCreationPolicyRequest", "Missing", &RoundTrip<UpdatePlayerSessionCreationPolicyRequest>, R"({"Action":"UpdatePlayerSessionCreationPolicy","RequestId":"req-38"})",
+     R"({"Action":"UpdatePlayerSessionCreationPolicy","RequestId":"req-38","PlayerSessionPolicy":"NOT_SET"})"},
+    {"WebSocketDescribePlayerSessionsRequest", "Full", &RoundTrip<WebSocketDescribePlayerSessionsRequest>, R"({"Action":"DescribePlayerSessions","RequestId":"req-39","GameSessionId":"gsess-1","PlayerId":"player-1","PlayerSessionId":"psess-1","PlayerSessionStatusFilter":"ACTIVE","NextToken":"next","Limit":50})",
+     R"({"Action":"DescribePlayerSessions","RequestId":"req-39","GameSessionId":"gsess-1","PlayerId":"player-1","PlayerSessionId":"psess-1","PlayerSessionStatusFilter":"ACTIVE","NextToken":"next","Limit":50})"},
+    {"WebSocketDescribePlayerSessionsRequest", "Empty", &RoundTrip<WebSocketDescribePlayerSessionsRequest>, R"({"Action":"DescribePlayerSessions","RequestId":"req-40"})",
+     R"({"Action":"DescribePlayerSessions","RequestId":"req-40"})"},
+    {"WebSocketDescribePlayerSessionsRequest", "ZeroLimit", &RoundTrip<WebSocketDescribePlayerSessionsRequest>, R"({"Action":"DescribePlayerSessions","RequestId":"req-41","Limit":0,"NextToken":""})",
+     R"({"Action":"DescribePlayerSessions","RequestId":"req-41"})"},
+    {"WebSocketDescribePlayerSessionsRequest", "WrongTypes", &RoundTrip<WebSocketDescribePlayerSessionsRequest>, R"({"Action":"DescribePlayerSessions","RequestId":"req-42","Limit":"50","PlayerId":1.5})",
+     R"({"Action":"DescribePlayerSessions","RequestId":"req-42"})"},
+    {"WebSocketGetComputeCertificateRequest", "Full", &RoundTrip<WebSocketGetComputeCertificateRequest>, R"({"Action":"GetComputeCertificate","RequestId":"req-43"})",
+     R"({"Action":"GetComputeCertificate","RequestId":"req-43"})"},
+    {"WebSocketGetFleetRoleCredentialsRequest", "Full", &RoundTrip<WebSocketGetFleetRoleCredentialsRequest>, R"({"Action":"GetFleetRoleCredentials","RequestId":"req-44","RoleArn":"arn:aws:iam::123456789012:role/Odin","RoleSessionName":"odin-session"})",
+     R"({"Action":"GetFleetRoleCredentials","RequestId":"req-44","RoleArn":"arn:aws:iam::123456789012:role/Odin","RoleSessionName":"odin-session"})"},
+    {"WebSocketGetFleetRoleCredentialsRequest", "Empty", &RoundTrip<WebSocketGetFleetRoleCredentialsRequest>, R"({"Action":"GetFleetRoleCredentials","RequestId":"req-45","RoleArn":"","RoleSessionName":""})",
+     R"({"Action":"GetFleetRoleCredentials","RequestId":"req-45"})"},
+    {"WebSocketStopMatchBackfillRequest", "Full", &RoundTrip<WebSocketStopMatchBackfillRequest>, R"({"Action":"StopMatchBackfill","RequestId":"req-46","GameSessionArn":"arn:gsess","MatchmakingConfigurationArn":"arn:config","TicketId":"ticket-1"})",
+     R"({"Action":"StopMatchBackfill","RequestId":"req-46","GameSessionArn":"arn:gsess","MatchmakingConfigurationArn":"arn:config","TicketId":"ticket-1"})"},
+    {"WebSocketStopMatchBackfillRequest", "Empty", &RoundTrip<WebSocketStopMatchBackfillRequest>, R"({"Action":"StopMatchBackfill","RequestId":"req-47"})",
+     R"({"Action":"StopMatchBackfill","RequestId":"req-47"})"},
+    {"WebSocketDescribePlayerSessionsResponse", "Full", &RoundTrip<WebSocketDescribePlayerSessionsResponse>, R"({"Action":"DescribePlayerSessions","RequestId":"req-48","StatusCode":200,"NextToken":"next","PlayerSessions":[{"PlayerSessionId":"psess-1","PlayerId":"player-1","GameSessionId":"gsess-1","FleetId":"fleet-1","CreationTime":1760000000000,"TerminationTime":1760000100000,"Status":"ACTIVE","IpAddress":"1.2.3.4","Port":7777,"PlayerData":"data","DnsName":"dns"},{"PlayerSessionId":"psess-2","Status":"TIMEDOUT"}]})",
+     R"({"Action":"DescribePlayerSessions","RequestId":"req-48","NextToken":"next","PlayerSessions":[{"PlayerSessionId":"psess-1","PlayerId":"player-1","GameSessionId":"gsess-1","FleetId":"fleet-1","CreationTime":1760000000000,"TerminationTime":1760000100000,"Status":"ACTIVE","IpAddress":"1.2.3.4","Port":7777,"PlayerData":"data","DnsName":"dns"},{"PlayerSessionId":"psess-2","Status":"TIMEDOUT"}]})"},
+    {"WebSocketDescribePlayerSessionsResponse", "EmptyList", &RoundTrip<WebSocketDescribePlayerSessionsResponse>, R"({"Action":"DescribePlayerSessions","RequestId":"req-49","PlayerSessions":[]})",
+     R"({"Action":"DescribePlayerSessions","RequestId":"req-49","PlayerSessions":[]})"},
+    {"WebSocketDescribePlayerSessionsResponse", "MissingList", &RoundTrip<WebSocketDescribePlayerSessionsResponse>, R"({"Action":"DescribePlayerSessions","RequestId":"req-50","NextToken":"n"})",
+     R"({"Action":"DescribePlayerSessions","RequestId":"req-50","NextToken":"n","PlayerSessions":[]})"},
+    {"WebSocketDescribePlayerSessionsResponse", "Statuses", &RoundTrip<WebSocketDescribePlayerSessionsResponse>, R"({"Action":"DescribePlayerSessions","RequestId":"req-51","PlayerSessions":[{"Status":"RESERVED"},{"Status":"COMPLETED"},{"Status":"UNKNOWN"},{"Status":3},{}]})",
+     R"({"Action":"DescribePlayerSessions","RequestId":"req-51","PlayerSessions":[{"Status":"RESERVED"},{"Status":"COMPLETED"},{"Status":"NOT_SET"},{"Status":"NOT_SET"},{"Status":"NOT_SET"}]})"},
+    {"WebSocketGetComputeCertificateResponse", "Full", &RoundTrip<WebSocketGetComputeCertificateResponse>, R"({"Action":"GetComputeCertificate","RequestId":"req-52","StatusCode":200,"ComputeName":"compute-1","CertificatePath":"/local/certs/cert.pem"})",
+     R"({"Action":"GetComputeCertificate","RequestId":"req-52","ComputeName":"compute-1","CertificatePath":"/local/certs/cert.pem"})"},
+    {"WebSocketGetComputeCertificateResponse", "Error", &RoundTrip<WebSocketGetComputeCertificateResponse>, R"({"Action":"GetComputeCertificate","RequestId":"req-53","StatusCode":500,"ErrorMessage":"failure"})",
+     R"({"Action":"GetComputeCertificate","RequestId":"req-53"})"},
+    {"WebSocketGetFleetRoleCredentialsResponse", "Full", &RoundTrip<WebSocketGetFleetRoleCredentialsResponse>, R"({"Action":"GetFleetRoleCredentials","RequestId":"req-54","StatusCode":200,"AssumedRoleUserArn":"arn:user","AssumedRoleId":"role-id","AccessKeyId":"AKIA","SecretAccessKey":"secret","SessionToken":"session","Expiration":1760003600000})",
+     R"({"Action":"GetFleetRoleCredentials","RequestId":"req-54","AssumedRoleUserArn":"arn:user","AssumedRoleId":"role-id","AccessKeyId":"AKIA","SecretAccessKey":"secret","SessionToken":"session","Expiration":1760003600000})"},
+    {"WebSocketGetFleetRoleCredentialsResponse", "WrongTypes", &RoundTrip<WebSocketGetFleetRoleCredentialsResponse>, R"({"Action":"GetFleetRoleCredentials","RequestId":"req-55","AccessKeyId":1,"Expiration":"soon"})",
+     R"({"Action":"GetFleetRoleCredentials","RequestId":"req-55"})"},
+    {"WebSocketGetFleetRoleCredentialsResponse", "NegativeExpiration", &RoundTrip<WebSocketGetFleetRoleCredentialsResponse>, R"({"Action":"GetFleetRoleCredentials","RequestId":"req-56","Expiration":-1})",
+     R"({"Action":"GetFleetRoleCredentials","RequestId":"req-56"})"},
+    {"WebSocketStartMatchBackfillResponse", "Full", &RoundTrip<WebSocketStartMatchBackfillResponse>, R"({"Action":"StartMatchBackfill","RequestId":"req-57","StatusCode":200,"TicketId":"ticket-1"})",
+     R"({"Action":"StartMatchBackfill","RequestId":"req-57","TicketId":"ticket-1"})"},
+    {"WebSocketStartMatchBackfillResponse", "Empty", &RoundTrip<WebSocketStartMatchBackfillResponse>, R"({"Action":"StartMatchBackfill","RequestId":"req-58"})",
+     R"({"Action":"StartMatchBackfill","RequestId":"req-58"})"}
+};
+
+class MessageFieldsTest : public ::testing::TestWithParam<MessageCase> {};
+
+std::string CaseName(const ::testing::TestParamInfo<MessageCase> &info) { return std::string(info.param.type) + "_" + info.param.name; }
+
+} // namespace
+
+TEST_P(MessageFieldsTest, GIVEN_Json_WHEN_DeserializeAndSerialize_THEN_MatchesHandWrittenSerializer) {
+    const MessageCase &messageCase = GetParam();
+    EXPECT_EQ(messageCase.expected, messageCase.roundTrip(messageCase.input));
+}
+
+TEST_P(MessageFieldsTest, GIVEN_SerializedMessage_WHEN_DeserializeAndSerialize_THEN_Unchanged) {
+    const MessageCase &messageCase = GetParam();
+    EXPECT_EQ(messageCase.expected, messageCase.roundTrip(messageCase.expected));
+}
+
+INSTANTIATE_TEST_SUITE_P(Messages, MessageFieldsTest, ::testing::ValuesIn(MESSAGE_CASES), CaseName);
@@ -0,0 +1,148 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/model/RequestId.h>
+#include <aws/gamelift/internal/util/GuidGenerator.h>
+#include <algorithm>
+#include <cctype>
+#include <gtest/gtest.h>
+#include <set>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Aws::GameLift::Internal::GuidGenerator;
+using Aws::GameLift::Internal::RequestId;
+
+namespace {
+
+const size_t PREFIX_LENGTH = 21;
+const int THREAD_COUNT = 8;
+const int IDS_PER_THREAD = 10000;
+
+RequestId Parse(const std::string &requestId) { return RequestId::FromString(requestId.c_str(), requestId.size()); }
+
+bool IsAlphaNumeric(const std::string &value) {
+    return std::all_of(value.begin(), value.end(), [](char c) { return std::isalnum(static_cast<unsigned char>(c)) != 0; });
+}
+
+// Runs generate on THREAD_COUNT threads at once and returns everything they produced.
+template <typename T, typename Generate> std::vector<T> GenerateConcurrently(Generate generate) {
+    std::vector<std::vector<T>> results(THREAD_COUNT);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < THREAD_COUNT; thread++) {
+        threads.emplace_back([&results, &generate, thread]() {
+            for (int i = 0; i < IDS_PER_THREAD; i++) {
+                results[thread].push_back(generate());
+            }
+        });
+    }
+    std::vector<T> all;
+    for (int thread = 0; thread < THREAD_COUNT; thread++) {
+        threads[thread].join();
+        all.insert(all.end(), results[thread].begin(), results[thread].end());
+    }
+    return all;
+}
+
+} // namespace
+
+TEST(RequestIdTest, GIVEN_NewId_WHEN_FormatAndFromString_THEN_RoundTrips) {
+    const RequestId first = RequestId::Next();
+    const RequestId second = RequestId::Next();
+    EXPECT_NE(0u, first.GetValue());
+    EXPECT_LT(first.GetValue(), second.GetValue());
+
+    char buffer[RequestId::WIRE_LENGTH + 1];
+    ASSERT_TRUE(first.Format(buffer));
+    const std::string wire = first.ToString();
+    EXPECT_EQ(std::string(buffer), wire);
+    EXPECT_EQ(RequestId::WIRE_LENGTH, wire.size());
+    EXPECT_TRUE(IsAlphaNumeric(wire)) << wire;
+    // The prefix is drawn once per process; only the sequence number differs.
+    EXPECT_EQ(wire.substr(0, PREFIX_LENGTH), second.ToString().substr(0, PREFIX_LENGTH));
+
+    const RequestId parsed = Parse(wire);
+    EXPECT_EQ(first.GetValue(), parsed.GetValue());
+    EXPECT_FALSE(parsed.IsEmpty());
+    EXPECT_EQ(wire, parsed.ToString());
+}
+
+TEST(RequestIdTest, GIVEN_BoundaryValues_WHEN_ToString_THEN_RoundTripsInBase62) {
+    const std::string one = RequestId::ToString(1);
+    EXPECT_EQ("00000000001", one.substr(PREFIX_LENGTH));
+    EXPECT_EQ("0000000000z", RequestId::ToString(61).substr(PREFIX_LENGTH));
+    EXPECT_EQ("00000000010", RequestId::ToString(62).substr(PREFIX_LENGTH));
+    EXPECT_EQ("", RequestId::ToString(0));
+
+    for (uint64_t value : {uint64_t(1), uint64_t(61), uint64_t(62), uint64_t(1) << 32, UINT64_MAX - 1, UINT64_MAX}) {
+        const std::string wire = RequestId::ToString(value);
+        EXPECT_EQ(RequestId::WIRE_LENGTH, wire.size());
+        EXPECT_EQ(value, Parse(wire).GetValue()) << wire;
+    }
+}
+
+TEST(RequestIdTest, GIVEN_ConcurrentThreads_WHEN_Next_THEN_EveryIdIsUnique) {
+    const std::vector<std::string> ids = GenerateConcurrently<std::string>([]() { return RequestId::Next().ToString(); });
+
+    const std::set<std::string> unique(ids.begin(), ids.end());
+    EXPECT_EQ(ids.size(), unique.size());
+    for (const std::string &id : unique) {
+        EXPECT_NE(0u, Parse(id).GetValue()) << id;
+    }
+}
+
+TEST(RequestIdTest, GIVEN_ForeignId_WHEN_FromString_THEN_KeptVerbatimWithoutValue) {
+    const std::string ownWire = RequestId::Next().ToString();
+    std::string otherPrefix = ownWire;
+    otherPrefix[0] = otherPrefix[0] == 'a' ? 'b' : 'a';
+    std::string invalidDigit = ownWire;
+    invalidDigit.back() = '-';
+    // "zzzzzzzzzzz" in base 62 is larger than UINT64_MAX.
+    const std::string overflow = ownWire.substr(0, PREFIX_LENGTH) + "zzzzzzzzzzz";
+
+    for (const std::string &foreign : {std::string("req-1"), std::string("123e4567-e89b-42d3-a456-426614174000"), otherPrefix, invalidDigit, overflow,
+                                       ownWire.substr(0, RequestId::WIRE_LENGTH - 1), ownWire + "0"}) {
+        const RequestId requestId = Parse(foreign);
+        EXPECT_EQ(0u, requestId.GetValue()) << foreign;
+        EXPECT_FALSE(requestId.IsEmpty()) << foreign;
+        EXPECT_EQ(foreign, requestId.ToString());
+
+        char buffer[RequestId::WIRE_LENGTH + 1];
+        memset(buffer, 'x', sizeof(buffer));
+        EXPECT_FALSE(requestId.Format(buffer)) << foreign;
+        EXPECT_EQ('x', buffer[0]);
+    }
+
+    const RequestId empty = RequestId::FromString("", 0);
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_EQ("", empty.ToString());
+}
+
+TEST(RequestIdTest, GIVEN_ConcurrentThreads_WHEN_GenerateGuid_THEN_EveryGuidIsUniqueVersion4) {
+    const std::vector<std::string> guids = GenerateConcurrently<std::string>([]() { return GuidGenerator::GenerateGuid(); });
+
+    const std::set<std::string> unique(guids.begin(), guids.end());
+    EXPECT_EQ(guids.size(), unique.size());
+    for (const std::string &guid : unique) {
+        ASSERT_EQ(GuidGenerator::GUID_LENGTH, guid.size());
+        EXPECT_EQ('-', guid[8]);
+        EXPECT_EQ('-', guid[13]);
+        EXPECT_EQ('-', guid[18]);
+        EXPECT_EQ('-', guid[23]);
+        EXPECT_EQ('4', guid[14]) << guid;
+        EXPECT_NE(std::string::npos, std::string("89ab").find(guid[19])) << guid;
+        EXPECT_EQ(std::string::npos, guid.find_first_not_of("0123456789abcdef-")) << guid;
+    }
+}
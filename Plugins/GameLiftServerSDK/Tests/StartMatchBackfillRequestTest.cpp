@@ -0,0 +1,242 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/model/WebSocketAttributeValue.h>
+#include <aws/gamelift/internal/model/WebSocketPlayer.h>
+#include <aws/gamelift/internal/model/request/WebSocketStartMatchBackfillStreamingRequest.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace Aws::GameLift;
+using Aws::GameLift::Server::Model::AttributeValue;
+using Aws::GameLift::Server::Model::Player;
+using Aws::GameLift::Server::Model::StartMatchBackfillRequest;
+
+namespace {
+
+const int PLAYER_COUNT = 120;
+
+#ifdef GAMELIFT_USE_STD
+inline std::string ToString(const std::string &value) { return value; }
+#else
+inline std::string ToString(const char *value) { return value; }
+#endif
+
+// Converts a player the way the removed map-based request did: every key through a std::map, so
+// keys come out in ascending order and a repeated key keeps its last value.
+Internal::WebSocketPlayer ToWebSocketPlayer(const Player &player) {
+    std::map<std::string, AttributeValue> attributes;
+    std::map<std::string, int> latencies;
+#ifdef GAMELIFT_USE_STD
+    attributes = player.GetPlayerAttributes();
+    latencies = player.GetLatencyInMs();
+#else
+    int attributeCount;
+    const Player::NamedAttribute *namedAttributes = player.GetPlayerAttributes(attributeCount);
+    for (int i = 0; i < attributeCount; i++) {
+        attributes[namedAttributes[i].GetName()] = namedAttributes[i].GetValue();
+    }
+    int latencyCount;
+    const Player::RegionAndLatency *regionLatencies = player.GetLatencyMs(latencyCount);
+    for (int i = 0; i < latencyCount; i++) {
+        latencies[regionLatencies[i].GetRegion()] = regionLatencies[i].GetLatencyMs();
+    }
+#endif
+
+    std::map<std::string, Internal::WebSocketAttributeValue> webSocketAttributes;
+    for (const auto &attribute : attributes) {
+        const AttributeValue &value = attribute.second;
+        Internal::WebSocketAttributeValue webSocketValue;
+        switch (value.GetType()) {
+        case AttributeValue::AttrType::STRING:
+            webSocketValue.SetAttributeType(Internal::WebSocketAttrType::STRING);
+            webSocketValue.SetS(ToString(value.GetS()));
+            break;
+        case AttributeValue::AttrType::DOUBLE:
+            webSocketValue.SetAttributeType(Internal::WebSocketAttrType::DOUBLE);
+            webSocketValue.SetN(value.GetN());
+            break;
+        case AttributeValue::AttrType::STRING_LIST: {
+            webSocketValue.SetAttributeType(Internal::WebSocketAttrType::STRING_LIST);
+#ifdef GAMELIFT_USE_STD
+            webSocketValue.SetSL(value.GetSL());
+#else
+            std::vector<std::string> items;
+            int itemCount;
+            const AttributeValue::AttributeStringType *list = value.GetSL(itemCount);
+            for (int i = 0; i < itemCount; i++) {
+                items.push_back(list[i]);
+            }
+            webSocketValue.SetSL(items);
+#endif
+            break;
+        }
+        case AttributeValue::AttrType::STRING_DOUBLE_MAP: {
+            webSocketValue.SetAttributeType(Internal::WebSocketAttrType::STRING_DOUBLE_MAP);
+#ifdef GAMELIFT_USE_STD
+            webSocketValue.SetSDM(value.GetSDM());
+#else
+            std::map<std::string, double> entries;
+            int entryCount;
+            const AttributeValue::KeyAndValue *keyAndValues = value.GetSDM(entryCount);
+            for (int i = 0; i < entryCount; i++) {
+                entries[keyAndValues[i].GetKey()] = keyAndValues[i].GetValue();
+            }
+            webSocketValue.SetSDM(entries);
+#endif
+            break;
+        }
+        default:
+            webSocketValue.SetAttributeType(Internal::WebSocketAttrType::NONE);
+            break;
+        }
+        webSocketAttributes[attribute.first] = webSocketValue;
+    }
+
+    return Internal::WebSocketPlayer()
+        .WithPlayerId(ToString(player.GetPlayerId()))
+        .WithTeam(ToString(player.GetTeam()))
+        .WithPlayerAttributes(webSocketAttributes)
+        .WithLatencyInMs(latencies);
+}
+
+// The JSON the removed WebSocketStartMatchBackfillRequest wrote for the request.
+std::string SerializeThroughWebSocketPlayers(const StartMatchBackfillRequest &request, const std::string &requestId) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.String("Action");
+    writer.String("StartMatchBackfill");
+    writer.String("RequestId");
+    writer.String(requestId.c_str());
+    const std::string ticketId = ToString(request.GetTicketId());
+    const std::string gameSessionArn = ToString(request.GetGameSessionArn());
+    const std::string matchmakingConfigurationArn = ToString(request.GetMatchmakingConfigurationArn());
+    if (!ticketId.empty()) {
+        writer.String("TicketId");
+        writer.String(ticketId.c_str());
+    }
+    if (!gameSessionArn.empty()) {
+        writer.String("GameSessionArn");
+        writer.String(gameSessionArn.c_str());
+    }
+    if (!matchmakingConfigurationArn.empty()) {
+        writer.String("MatchmakingConfigurationArn");
+        writer.String(matchmakingConfigurationArn.c_str());
+    }
+    writer.String("Players");
+    writer.StartArray();
+#ifdef GAMELIFT_USE_STD
+    for (const Player &player : request.GetPlayers()) {
+#else
+    int playerCount;
+    const Player *players = request.GetPlayers(playerCount);
+    for (const Player *playerIt = players; playerIt != players + playerCount; ++playerIt) {
+        const Player &player = *playerIt;
+#endif
+        writer.StartObject();
+        ToWebSocketPlayer(player).Serialize(&writer);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+// A player with every attribute type, keys added out of order. The non-STD arrays also repeat a
+// key, which the map-based conversion resolved to the last value.
+Player MakePlayer(int index) {
+    const std::string id = std::to_string(index);
+
+    AttributeValue skills = AttributeValue::ConstructStringDoubleMap();
+    skills.AddStringAndDouble("sniper", index * 0.25);
+    skills.AddStringAndDouble("assault", 100.0 - index);
+    skills.AddStringAndDouble("medic", 1.0 / (index + 1));
+#ifndef GAMELIFT_USE_STD
+    skills.AddStringAndDouble("assault", 3.5);
+#endif
+
+    AttributeValue maps = AttributeValue::ConstructStringList();
+    maps.AddString("Lvl_Shooter");
+    maps.AddString("Lvl_Horror");
+    maps.AddString(("Lvl_Custom_" + id).c_str());
+
+    Player player;
+    player.SetPlayerId(("player-" + id).c_str());
+    if (index % 3 != 0) {
+        player.SetTeam(index % 2 == 0 ? "red" : "blue");
+    }
+#ifdef GAMELIFT_USE_STD
+    player.AddPlayerAttribute("skill", AttributeValue(index * 12.5));
+    player.AddPlayerAttribute("mode", AttributeValue(std::string("deathmatch")));
+    player.AddPlayerAttribute("skills", skills);
+    player.AddPlayerAttribute("maps", maps);
+    player.AddPlayerAttribute("empty", AttributeValue());
+    player.AddLatencyInMs("us-west-2", 40 + index);
+    player.AddLatencyInMs("eu-central-1", 120 - index % 50);
+    player.AddLatencyInMs("ap-northeast-1", 200);
+#else
+    player.AddPlayerAttribute("skill", AttributeValue(index * 12.5));
+    player.AddPlayerAttribute("mode", AttributeValue("deathmatch"));
+    player.AddPlayerAttribute("skills", skills);
+    player.AddPlayerAttribute("maps", maps);
+    player.AddPlayerAttribute("empty", AttributeValue());
+    player.AddPlayerAttribute("mode", AttributeValue("capture"));
+    player.AddLatencyMs("us-west-2", 40 + index);
+    player.AddLatencyMs("eu-central-1", 120 - index % 50);
+    player.AddLatencyMs("ap-northeast-1", 200);
+    player.AddLatencyMs("us-west-2", 35);
+#endif
+    return player;
+}
+
+StartMatchBackfillRequest MakeRequest(int playerCount) {
+    StartMatchBackfillRequest request;
+    request.SetTicketId("ticket-1234");
+    request.SetGameSessionArn("arn:aws:gamelift:us-west-2::gamesession/fleet-1234/gsess-5678");
+    request.SetMatchmakingConfigurationArn("arn:aws:gamelift:us-west-2:123456789012:matchmakingconfiguration/Odin");
+    for (int i = 0; i < playerCount; i++) {
+        request.AddPlayer(MakePlayer(i));
+    }
+    return request;
+}
+
+} // namespace
+
+TEST(StartMatchBackfillRequestTest, GIVEN_120Players_WHEN_Serialize_THEN_MatchesWebSocketPlayerSerialization) {
+    const StartMatchBackfillRequest request = MakeRequest(PLAYER_COUNT);
+    Internal::WebSocketStartMatchBackfillStreamingRequest streamingRequest(request);
+
+    const std::string expected = SerializeThroughWebSocketPlayers(request, streamingRequest.GetRequestId());
+
+    EXPECT_EQ(expected, streamingRequest.Serialize());
+}
+
+TEST(StartMatchBackfillRequestTest, GIVEN_120Players_WHEN_Serialize_THEN_WritesEveryPlayer) {
+    const StartMatchBackfillRequest request = MakeRequest(PLAYER_COUNT);
+    Internal::WebSocketStartMatchBackfillStreamingRequest streamingRequest(request);
+
+    rapidjson::Document document;
+    ASSERT_FALSE(document.Parse(streamingRequest.Serialize().c_str()).HasParseError());
+    ASSERT_TRUE(document["Players"].IsArray());
+    EXPECT_EQ(PLAYER_COUNT, static_cast<int>(document["Players"].Size()));
+}
+
+TEST(StartMatchBackfillRequestTest, GIVEN_NoTicketAndNoPlayers_WHEN_Serialize_THEN_MatchesWebSocketPlayerSerialization) {
+    StartMatchBackfillRequest request;
+    request.SetMatchmakingConfigurationArn("arn:aws:gamelift:us-west-2:123456789012:matchmakingconfiguration/Odin");
+    Internal::WebSocketStartMatchBackfillStreamingRequest streamingRequest(request);
+
+    EXPECT_EQ(SerializeThroughWebSocketPlayers(request, streamingRequest.GetRequestId()), streamingRequest.Serialize());
+}
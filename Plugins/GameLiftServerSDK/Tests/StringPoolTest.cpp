@@ -0,0 +1,46 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/server/model/StringPool.h>
+#include <gtest/gtest.h>
+#include <string>
+
+using Aws::GameLift::Server::Model::StringPool;
+
+TEST(StringPoolTest, GIVEN_Strings_WHEN_Add_THEN_GetReturnsThem) {
+    const StringPool::Handle empty = StringPool::EMPTY;
+    StringPool pool;
+    const StringPool::Handle first = pool.Add("gsess-1");
+    const StringPool::Handle second = pool.Add("fleet-1");
+
+    EXPECT_STREQ("gsess-1", pool.Get(first));
+    EXPECT_STREQ("fleet-1", pool.Get(second));
+    EXPECT_STREQ("", pool.Get(empty));
+    EXPECT_EQ(empty, pool.Add(""));
+    EXPECT_EQ(empty, pool.Add(nullptr));
+}
+
+TEST(StringPoolTest, GIVEN_MaxLength_WHEN_Add_THEN_TruncatesLikeFixedSizeField) {
+    StringPool pool;
+    EXPECT_STREQ("abcd", pool.Get(pool.Add("abcdefgh", 5)));
+}
+
+// Growing the pool frees the buffer the value points into; Add must copy from the new one.
+TEST(StringPoolTest, GIVEN_ValueFromSamePool_WHEN_AddGrowsPool_THEN_CopiesValue) {
+    const std::string arn = "arn:aws:gamelift:us-west-2::gamesession/fleet-123/gsess-456";
+    StringPool pool;
+    StringPool::Handle handle = pool.Add(arn.c_str());
+    for (int i = 0; i < 10; i++) {
+        handle = pool.Add(pool.Get(handle), 256);
+        ASSERT_EQ(arn, pool.Get(handle));
+    }
+}
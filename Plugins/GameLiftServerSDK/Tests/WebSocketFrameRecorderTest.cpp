@@ -0,0 +1,146 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/model/Uri.h>
+#include <aws/gamelift/internal/network/ReplayWebSocketClientWrapper.h>
+#include <aws/gamelift/internal/network/WebSocketFrameRecorder.h>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Aws::GameLift::Internal;
+
+namespace {
+
+// A capture file in the working directory, removed again when the test ends.
+class CaptureFile {
+public:
+    explicit CaptureFile(const std::string &name) : m_path(name + ".glwc") { std::remove(m_path.c_str()); }
+    ~CaptureFile() { std::remove(m_path.c_str()); }
+    const std::string &GetPath() const { return m_path; }
+
+private:
+    std::string m_path;
+};
+
+void Record(const std::string &capturePath, WebSocketFrameDirection direction, const std::string &connectionId, const std::string &payload) {
+    WebSocketFrameRecorder recorder;
+    ASSERT_TRUE(recorder.Open(capturePath));
+    recorder.Record(direction, connectionId, payload);
+}
+
+} // namespace
+
+TEST(WebSocketFrameRecorderTest, GIVEN_FramesOfTwoConnections_WHEN_ReadCapture_THEN_ReturnsEveryFrameWithItsConnection) {
+    CaptureFile capture("GIVEN_FramesOfTwoConnections");
+    const std::string binaryPayload("\0\x01\xff{\"Action\":\"Heartbeat\"}", 25);
+    {
+        WebSocketFrameRecorder recorder;
+        ASSERT_TRUE(recorder.Open(capture.GetPath()));
+        recorder.Record(WebSocketFrameDirection::OUTBOUND, "process-1", R"({"Action":"ActivateServerProcess","RequestId":"1"})");
+        recorder.Record(WebSocketFrameDirection::INBOUND, "process-1-slot1", R"({"Action":"CreateGameSession","GameSessionId":"gsess-1"})");
+        recorder.Record(WebSocketFrameDirection::INBOUND, "process-1", binaryPayload);
+        recorder.Record(WebSocketFrameDirection::OUTBOUND, "", "");
+    }
+
+    std::vector<CapturedWebSocketFrame> frames;
+    ASSERT_TRUE(WebSocketFrameRecorder::ReadCapture(capture.GetPath(), frames));
+    ASSERT_EQ(4u, frames.size());
+    EXPECT_EQ(WebSocketFrameDirection::OUTBOUND, frames[0].direction);
+    EXPECT_EQ("process-1", frames[0].connectionId);
+    EXPECT_EQ(R"({"Action":"ActivateServerProcess","RequestId":"1"})", frames[0].payload);
+    EXPECT_EQ(WebSocketFrameDirection::INBOUND, frames[1].direction);
+    EXPECT_EQ("process-1-slot1", frames[1].connectionId);
+    EXPECT_EQ(R"({"Action":"CreateGameSession","GameSessionId":"gsess-1"})", frames[1].payload);
+    EXPECT_EQ("process-1", frames[2].connectionId);
+    EXPECT_EQ(binaryPayload, frames[2].payload);
+    EXPECT_EQ("", frames[3].connectionId);
+    EXPECT_EQ("", frames[3].payload);
+    for (size_t i = 1; i < frames.size(); i++) {
+        EXPECT_LE(frames[i - 1].timestampMicros, frames[i].timestampMicros);
+    }
+}
+
+TEST(WebSocketFrameRecorderTest, GIVEN_ReopenedCapture_WHEN_ReadCapture_THEN_AppendsWithoutSecondHeader) {
+    CaptureFile capture("GIVEN_ReopenedCapture");
+    Record(capture.GetPath(), WebSocketFrameDirection::OUTBOUND, "process-1", "first");
+    Record(capture.GetPath(), WebSocketFrameDirection::INBOUND, "process-1", "second");
+
+    std::vector<CapturedWebSocketFrame> frames;
+    ASSERT_TRUE(WebSocketFrameRecorder::ReadCapture(capture.GetPath(), frames));
+    ASSERT_EQ(2u, frames.size());
+    EXPECT_EQ("first", frames[0].payload);
+    EXPECT_EQ("second", frames[1].payload);
+}
+
+TEST(WebSocketFrameRecorderTest, GIVEN_TruncatedOrForeignFile_WHEN_ReadCapture_THEN_Fails) {
+    CaptureFile capture("GIVEN_TruncatedOrForeignFile");
+    Record(capture.GetPath(), WebSocketFrameDirection::OUTBOUND, "process-1", "a payload that gets cut off");
+    std::string bytes;
+    {
+        std::ifstream in(capture.GetPath(), std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    std::vector<CapturedWebSocketFrame> frames;
+    for (size_t length : {bytes.size() - 1, size_t(6 + 8 + 1 + 1)}) {
+        std::ofstream(capture.GetPath(), std::ios::binary | std::ios::trunc).write(bytes.data(), length);
+        frames.clear();
+        EXPECT_FALSE(WebSocketFrameRecorder::ReadCapture(capture.GetPath(), frames)) << length;
+    }
+
+    std::ofstream(capture.GetPath(), std::ios::binary | std::ios::trunc) << "GLWC\x09\x00";
+    EXPECT_FALSE(WebSocketFrameRecorder::ReadCapture(capture.GetPath(), frames));
+}
+
+TEST(WebSocketFrameRecorderTest, GIVEN_MultiConnectionCapture_WHEN_Replay_THEN_DispatchesOnlyTheFirstConnectionsPushes) {
+    CaptureFile capture("GIVEN_MultiConnectionCapture");
+    {
+        WebSocketFrameRecorder recorder;
+        ASSERT_TRUE(recorder.Open(capture.GetPath()));
+        recorder.Record(WebSocketFrameDirection::INBOUND, "process-1", R"({"Action":"CreateGameSession","GameSessionId":"gsess-main"})");
+        recorder.Record(WebSocketFrameDirection::INBOUND, "process-1-slot1", R"({"Action":"CreateGameSession","GameSessionId":"gsess-slot1"})");
+        recorder.Record(WebSocketFrameDirection::INBOUND, "process-1-slot1", R"({"Action":"UpdateGameSession","GameSessionId":"gsess-slot1"})");
+        recorder.Record(WebSocketFrameDirection::INBOUND, "process-1", R"({"Action":"TerminateProcess","TerminationTime":1})");
+    }
+
+    std::mutex lock;
+    std::vector<std::string> dispatched;
+    ReplayWebSocketClientWrapper replay(capture.GetPath(), 1000.0);
+    for (const char *action : {"CreateGameSession", "UpdateGameSession", "TerminateProcess"}) {
+        replay.RegisterGameLiftCallback(action, [&lock, &dispatched](std::string message) {
+            std::lock_guard<std::mutex> guard(lock);
+            dispatched.push_back(message);
+            return ResponseOutcome(ResponsePayload());
+        });
+    }
+    ASSERT_TRUE(replay.Connect(Uri::UriBuilder().WithBaseUri("wss://localhost").Build()).IsSuccess());
+    for (int wait = 0; wait < 500; wait++) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (dispatched.size() >= 2) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    replay.Disconnect();
+
+    ASSERT_EQ(2u, dispatched.size());
+    EXPECT_NE(std::string::npos, dispatched[0].find("gsess-main"));
+    EXPECT_NE(std::string::npos, dispatched[1].find("TerminateProcess"));
+}
@@ -0,0 +1,64 @@
+#!/usr/bin/env bash
+# Copyright Epic Games, Inc. All Rights Reserved.
+#
+# Measures how many players a dedicated server can host: starts a local server, ramps headless bot
+# clients against it in steps and records the server's tick time, memory and bandwidth per player count.
+#
+#   SERVER=Packaged/LinuxServer/OdinFleetServer.sh CLIENT=Packaged/Linux/OdinFleetClient.sh Scripts/RunDensityBenchmark.sh
+#
+# The server appends a row per 10 s window to $OUT (see UOdinFleetServerHealthSubsystem); this script
+# averages them per player count into ${OUT%.csv}-summary.csv.
+set -euo pipefail
+
+: "${SERVER:?Set SERVER to the packaged server start script}"
+: "${CLIENT:?Set CLIENT to the packaged client start script}"
+MAP="${MAP:-/Game/Variant_Shooter/Lvl_Shooter}"
+PORT="${PORT:-7777}"
+# Bots added per step, the most bots to add, and how long each player count is measured.
+STEP_BOTS="${STEP_BOTS:-8}"
+MAX_BOTS="${MAX_BOTS:-64}"
+STEP_SECONDS="${STEP_SECONDS:-60}"
+OUT="$(realpath -m "${OUT:-density-benchmark.csv}")"
+SUMMARY="${OUT%.csv}-summary.csv"
+
+PIDS=()
+cleanup() {
+  # Each bot client stops the bot processes it started when it exits.
+  for pid in "${PIDS[@]}"; do
+    kill "$pid" 2>/dev/null || true
+  done
+  wait 2>/dev/null || true
+}
+trap cleanup EXIT
+
+"$SERVER" "$MAP" -server -log -unattended -port="$PORT" -benchmarkcsv="$OUT" -allowbots > "${OUT%.csv}-server.log" 2>&1 &
+PIDS+=($!)
+# The server writes the CSV header once it is up.
+for _ in $(seq 60); do
+  [[ -s "$OUT" ]] && break
+  sleep 1
+done
+[[ -s "$OUT" ]] || { echo "Server did not start, see ${OUT%.csv}-server.log" >&2; exit 1; }
+
+# Measure the empty server first.
+sleep "$STEP_SECONDS"
+for ((bots = STEP_BOTS; bots <= MAX_BOTS; bots += STEP_BOTS)); do
+  echo "Ramping to $bots bots"
+  # ?Bot lets the server accept the bots' fire and weapon switch RPCs.
+  "$CLIENT" "127.0.0.1:$PORT?Bot" -bots="$STEP_BOTS" -nullrhi -nosound -unattended > /dev/null 2>&1 &
+  PIDS+=($!)
+  sleep "$STEP_SECONDS"
+done
+
+awk -F, 'NR > 1 {
+    n[$1]++; mean[$1] += $2; p95[$1] += $3; memory[$1] += $5; bandwidth[$1] += $6
+  }
+  END {
+    print "Players,Windows,TickMsMean,TickMsP95,UsedMemoryMB,BandwidthKBps,BandwidthKBpsPerPlayer"
+    for (players in n) {
+      printf "%d,%d,%.2f,%.2f,%.0f,%.1f,%.2f\n", players, n[players], mean[players] / n[players], p95[players] / n[players],
+        memory[players] / n[players], bandwidth[players] / n[players], (players > 0 ? bandwidth[players] / n[players] / players : 0)
+    }
+  }' "$OUT" | { read -r header; echo "$header"; sort -t, -n -k1; } > "$SUMMARY"
+column -s, -t "$SUMMARY"
+echo "Per-window rows in $OUT, averages per player count in $SUMMARY"
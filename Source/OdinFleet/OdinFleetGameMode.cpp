@@ -1,13 +1,196 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "OdinFleetGameMode.h"
+#include "OdinFleetServerHealthSubsystem.h"
+#include "Async/Async.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LevelStreamingDynamic.h"
+#include "Engine/StreamableManager.h"
+#include "Containers/Ticker.h"
+#include "GLBSServiceConnector.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameSession.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/UObjectGlobals.h"
 
 #if WITH_GAMELIFT
+#include "GameLiftLogicalServerProcess.h"
 #include "GameLiftServerSDK.h"
 #endif
 
+#if PLATFORM_UNIX
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
 DEFINE_LOG_CATEGORY(GameServerLog);
 
+#if WITH_GAMELIFT
+namespace
+{
+	// A game session hosted next to others in this process, see AOdinFleetGameMode::SessionSlotCount.
+	struct FSessionSlot
+	{
+		// Null for slot 0, which is the process-wide SDK instance and uses its ProcessParameters.
+		TSharedPtr<FGameLiftLogicalServerProcess, ESPMode::ThreadSafe> Process;
+		FProcessParameters ProcessParameters;
+		FString GameSessionId;
+		TWeakObjectPtr<ULevelStreamingDynamic> Level;
+		// FPlatformTime::Seconds() when OnStartGameSession arrived, 0 when no activation is pending.
+		double ActivationStartTime = 0.0;
+		bool bSessionActive = false;
+		bool bRetired = false;
+	};
+
+	// The game mode is recreated by every travel; the GameLift process state outlives it.
+	struct FGameLiftProcessState
+	{
+		bool bInitialized = false;
+		TWeakObjectPtr<AOdinFleetGameMode> ActiveGameMode;
+		TSharedPtr<FProcessParameters> ProcessParameters;
+		// Keep the prewarmed maps and assets resident for the lifetime of the process.
+		TArray<TSharedPtr<FStreamableHandle>> PrewarmHandles;
+		// FPlatformTime::Seconds() when OnStartGameSession arrived, 0 when no activation is pending.
+		double ActivationStartTime = 0.0;
+		bool bActivationTravelled = false;
+		// The map a pending activation travels to, empty once it has loaded.
+		FString ActivationMapPackageName;
+		bool bSessionActive = false;
+		// FPlatformTime::Seconds() when EndGameSession started a recycle, 0 when none is in progress.
+		double RecycleStartTime = 0.0;
+		// Time from engine start to the first successful ProcessReady, the cost a restart would pay.
+		double ColdStartSeconds = 0.0;
+		// Empty unless hosting several game sessions; those never travel, so the fields above stay unused.
+		TArray<FSessionSlot> SessionSlots;
+		// Keeps the package names of successive level instances unique while old ones are still unloading.
+		int32 LevelInstanceCount = 0;
+		// The launcher's control socket while this process waits in its warm pool, -1 otherwise.
+		int32 WarmPoolFd = -1;
+		// From the command line; a warm pool process gets the rest from the launcher when promoted.
+		FServerParameters ServerParameters;
+		// Time from engine start until the warm pool process was warm.
+		double WarmSeconds = 0.0;
+		// FPlatformTime::Seconds() when the launcher promoted this process, 0 once it is ready.
+		double PromotionStartTime = 0.0;
+		// The cpulist the launcher dedicated to the game thread, empty when it does not pin processes.
+		FString GameThreadCpus;
+		// Mirrors UOdinFleetServerHealthSubsystem::IsOverloaded for sessions activated while it holds.
+		bool bDenyingPlayers = false;
+		// The session of the process-wide instance; session slots keep their own.
+		FString GameSessionId;
+		// Set once session slot 0 has ended the process-wide registration, so it is not ended twice.
+		bool bProcessEnded = false;
+	};
+
+	// Set by the launcher for the processes of its warm pool, see Docker/launcher/ProcessSupervisor.h.
+	const TCHAR* WarmPoolFdVariable = TEXT("ODIN_WARM_POOL_FD");
+	const TCHAR* GameThreadCpusVariable = TEXT("ODIN_GAME_THREAD_CPUS");
+
+	FGameLiftProcessState GameLiftProcess;
+
+	// Lives on the game instance, so it keeps its history across travel.
+	UOdinFleetServerHealthSubsystem* GetServerHealth()
+	{
+		AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get();
+		UGameInstance* GameInstance = GameMode ? GameMode->GetGameInstance() : nullptr;
+		return GameInstance ? GameInstance->GetSubsystem<UOdinFleetServerHealthSubsystem>() : nullptr;
+	}
+
+	// Answers OnHealthCheck for the process and every session slot, on the game thread.
+	bool CheckServerHealth()
+	{
+		UOdinFleetServerHealthSubsystem* Health = GetServerHealth();
+		if (Health && !Health->IsHealthy())
+		{
+			UE_LOG(GameServerLog, Warning, TEXT("Reporting unhealthy: %s"), *Health->Describe());
+			return false;
+		}
+		return true;
+	}
+
+	// Sends the server's load for each active game session to the backend, which ranks search results by it.
+	void ReportSessionLoad()
+	{
+		UOdinFleetServerHealthSubsystem* Health = GetServerHealth();
+		const FGameSessionLoad Load = Health ? Health->GetLoad() : FGameSessionLoad();
+		if (!Load.bValid)
+		{
+			return;
+		}
+		if (GameLiftProcess.SessionSlots.Num() == 0)
+		{
+			if (GameLiftProcess.bSessionActive)
+			{
+				UGLBSServiceConnector::ReportSessionLoad(GameLiftProcess.GameSessionId, Load);
+			}
+			return;
+		}
+		for (const FSessionSlot& Slot : GameLiftProcess.SessionSlots)
+		{
+			if (Slot.bSessionActive)
+			{
+				UGLBSServiceConnector::ReportSessionLoad(Slot.GameSessionId, Load);
+			}
+		}
+	}
+
+	FString GetRecentMapsFile()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("GameLift") / TEXT("RecentSessionMaps.txt");
+	}
+
+	// Successive game sessions may update the recent maps file from different pool threads.
+	FCriticalSection RecentMapsFileLock;
+
+	// Game properties may name a map by its short name, which is looked up under /Game/Maps.
+	FString ResolveMapPackageName(const FString& Map)
+	{
+		return Map.StartsWith(TEXT("/")) ? Map : FString::Printf(TEXT("/Game/Maps/%s"), *Map);
+	}
+
+	FSoftObjectPath GetMapAssetPath(const FString& MapPackageName)
+	{
+		return FSoftObjectPath(FString::Printf(TEXT("%s.%s"), *MapPackageName, *FPackageName::GetShortName(MapPackageName)));
+	}
+
+	const char* FindGamePropertyValue(const Aws::GameLift::Server::Model::GameSession& GameSession, const char* Key)
+	{
+		const Aws::GameLift::Server::Model::GameProperty* Property = GameSession.FindGameProperty(Key);
+		return Property ? Property->GetValue() : nullptr;
+	}
+
+	// The active session slot a client joins: the one named by ?GameSessionId=, which may be the
+	// trailing ID of the ARN, or the only active one. INDEX_NONE if neither applies.
+	int32 FindSessionSlot(const FString& Options)
+	{
+		const FString GameSessionId = UGameplayStatics::ParseOption(Options, TEXT("GameSessionId"));
+		int32 FoundSlot = INDEX_NONE;
+		int32 ActiveSlotCount = 0;
+		for (int32 SlotIndex = 0; SlotIndex < GameLiftProcess.SessionSlots.Num(); ++SlotIndex)
+		{
+			const FSessionSlot& Slot = GameLiftProcess.SessionSlots[SlotIndex];
+			if (!Slot.bSessionActive)
+			{
+				continue;
+			}
+			++ActiveSlotCount;
+			if (GameSessionId.IsEmpty() || Slot.GameSessionId.EndsWith(GameSessionId))
+			{
+				FoundSlot = SlotIndex;
+			}
+		}
+		return (GameSessionId.IsEmpty() && ActiveSlotCount != 1) ? INDEX_NONE : FoundSlot;
+	}
+}
+#endif
+
 AOdinFleetGameMode::AOdinFleetGameMode() :ProcessParameters(nullptr)
 {
 	// stub
@@ -18,216 +201,1361 @@ void AOdinFleetGameMode::BeginPlay()
 	Super::BeginPlay();
 
 #if WITH_GAMELIFT
-	InitGameLift();
+	GameLiftProcess.ActiveGameMode = this;
+	if (!GameLiftProcess.bInitialized)
+	{
+		GameLiftProcess.bInitialized = true;
+		FCoreUObjectDelegates::PostLoadMapWithWorld.AddStatic(&AOdinFleetGameMode::OnPostLoadMap);
+		InitGameLift();
+	}
+	else if (GameLiftProcess.RecycleStartTime > 0.0)
+	{
+		CompleteRecycle();
+	}
 	#endif
 }
 
-void AOdinFleetGameMode::InitGameLift()
+void AOdinFleetGameMode::PostSeamlessTravel()
 {
+	Super::PostSeamlessTravel();
+
 #if WITH_GAMELIFT
-	UE_LOG(GameServerLog, Log, TEXT("Game Lift initialized"));
-	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+	GameLiftProcess.ActiveGameMode = this;
+#endif
+}
 
-	FServerParameters ServerParameters;
-	bool bIsAnywhereActive = false;
-	if (FParse::Param(FCommandLine::Get(), TEXT("glAnywhere")))
+void AOdinFleetGameMode::OnPostLoadMap(UWorld* World)
+{
+#if WITH_GAMELIFT
+	if (!World || World->GetNetMode() != NM_DedicatedServer)
 	{
-		bIsAnywhereActive = true;
+		return;
 	}
-	if (bIsAnywhereActive)
+	GameLiftProcess.ActiveGameMode = Cast<AOdinFleetGameMode>(World->GetAuthGameMode());
+	// Seamless travel also loads the transition map; only the destination picks up the pending session.
+	if (GameLiftProcess.ActivationMapPackageName.IsEmpty() || World->GetOutermost()->GetName() != GameLiftProcess.ActivationMapPackageName)
 	{
-		FString glAnywhereWebSocketUrl = "";
-		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereWebSocketUrl="),glAnywhereWebSocketUrl))
-		{
-			ServerParameters.m_webSocketUrl = TCHAR_TO_UTF8(*glAnywhereWebSocketUrl);
-		}
+		return;
+	}
+	GameLiftProcess.ActivationMapPackageName.Reset();
+	ActivatePendingGameSession();
+#endif
+}
 
-		FString glAnywhereFleetId = "";
-		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereFleetId="),glAnywhereFleetId))
-		{
-			ServerParameters.m_fleetId = TCHAR_TO_UTF8(*glAnywhereFleetId);
-		}
+void AOdinFleetGameMode::Prewarm()
+{
+#if WITH_GAMELIFT
+	const double PrewarmStartTime = FPlatformTime::Seconds();
 
-		FString glAnywhereProcessId = "";
-		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereProcessId="),glAnywhereProcessId))
-		{
-			ServerParameters.m_processId = TCHAR_TO_UTF8(*glAnywhereProcessId);
-		}else
+	TArray<FSoftObjectPath> AssetsToLoad = PrewarmAssets;
+	for (const FString& Map : PrewarmMaps)
+	{
+		AssetsToLoad.AddUnique(GetMapAssetPath(ResolveMapPackageName(Map)));
+	}
+
+	TArray<FString> RecentMaps;
+	FFileHelper::LoadFileToStringArray(RecentMaps, *GetRecentMapsFile());
+	for (int32 Index = 0; Index < RecentMaps.Num() && Index < PrewarmRecentMapCount; ++Index)
+	{
+		const FString MapPackageName = ResolveMapPackageName(RecentMaps[Index]);
+		if (FPackageName::DoesPackageExist(MapPackageName))
 		{
-			FString TimeString = FString::FromInt(std::time(nullptr));
-			FString ProcessId = "ProcessId_" +TimeString;
-			ServerParameters.m_processId = TCHAR_TO_UTF8(*ProcessId);
+			AssetsToLoad.AddUnique(GetMapAssetPath(MapPackageName));
 		}
+	}
 
-		FString glAnywhereHostId = "";
-		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereHostId="), glAnywhereHostId))
+	// Both loads report to the same counter; the process is ready once the last one completes.
+	TSharedRef<int32> RemainingLoads = MakeShared<int32>(1);
+	auto OnLoadComplete = [RemainingLoads, PrewarmStartTime, AssetCount = AssetsToLoad.Num(), PrimaryAssetCount = PrewarmPrimaryAssets.Num()]()
+	{
+		if (--RemainingLoads.Get() > 0)
 		{
-			ServerParameters.m_hostId = TCHAR_TO_UTF8(*glAnywhereHostId);
+			return;
 		}
-		
-		FString glAnywhereAuthToken = "";
-		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereAuthToken="),glAnywhereAuthToken))
+		UE_LOG(GameServerLog, Log, TEXT("Prewarmed %d assets and %d primary assets in %.1f ms"),
+			AssetCount, PrimaryAssetCount, (FPlatformTime::Seconds() - PrewarmStartTime) * 1000.0);
+		if (AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get())
 		{
-			ServerParameters.m_authToken = TCHAR_TO_UTF8(*glAnywhereAuthToken);
+			if (GameLiftProcess.WarmPoolFd >= 0)
+			{
+				GameMode->WaitForPromotion();
+			}
+			else
+			{
+				GameMode->ReportProcessReady();
+			}
 		}
+	};
 
-		FString glAnywhereAwsRegion = "";
-		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereAwsRegion="),glAnywhereAwsRegion))
+	// The completion delegate may run inside the request when everything is already loaded, or not at
+	// all when there is nothing to load, so each load completes exactly once through its own flag.
+	auto TrackLoad = [&RemainingLoads, &OnLoadComplete](TFunctionRef<TSharedPtr<FStreamableHandle>(FStreamableDelegate)> StartLoad)
+	{
+		++RemainingLoads.Get();
+		TSharedRef<bool> bCompleted = MakeShared<bool>(false);
+		auto Complete = [bCompleted, OnLoadComplete]()
 		{
-			ServerParameters.m_awsRegion = TCHAR_TO_UTF8(*glAnywhereAwsRegion);
-		}
-
-		FString glAnywhereAccessKey = "";
-		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereAccessKey="),glAnywhereAccessKey))
+			if (!bCompleted.Get())
+			{
+				bCompleted.Get() = true;
+				OnLoadComplete();
+			}
+		};
+		TSharedPtr<FStreamableHandle> Handle = StartLoad(FStreamableDelegate::CreateLambda(Complete));
+		if (Handle.IsValid())
 		{
-			ServerParameters.m_accessKey = TCHAR_TO_UTF8(*glAnywhereAccessKey);
+			GameLiftProcess.PrewarmHandles.Add(Handle);
 		}
-
-		FString glAnywhereSecretKey = "";
-		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereSecretKey="),glAnywhereSecretKey))
+		else
 		{
-			ServerParameters.m_secretKey = TCHAR_TO_UTF8(*glAnywhereSecretKey);
+			Complete();
 		}
+	};
 
-		FString glAnywhereSessionToken  = "";
-		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereSessionToken="),glAnywhereSessionToken))
+	if (PrewarmPrimaryAssets.Num() > 0)
+	{
+		TrackLoad([this](FStreamableDelegate Delegate) { return UAssetManager::Get().LoadPrimaryAssets(PrewarmPrimaryAssets, PrewarmBundles, Delegate); });
+	}
+	if (AssetsToLoad.Num() > 0)
+	{
+		TrackLoad([&AssetsToLoad](FStreamableDelegate Delegate) { return UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetsToLoad, Delegate); });
+	}
+
+	// Drops the initial count; completes now if nothing was loaded.
+	OnLoadComplete();
+#endif
+}
+
+void AOdinFleetGameMode::StartGameSession(const Aws::GameLift::Server::Model::GameSession& InGameSession)
+{
+#if WITH_GAMELIFT
+	if (GameLiftProcess.SessionSlots.Num() > 1)
+	{
+		StartSessionSlot(0, InGameSession);
+		return;
+	}
+
+	GameLiftProcess.ActivationStartTime = FPlatformTime::Seconds();
+	GameLiftProcess.bActivationTravelled = false;
+	GameLiftProcess.ActivationMapPackageName.Reset();
+
+	const char* Map = FindGamePropertyValue(InGameSession, "map");
+	const char* Mode = FindGamePropertyValue(InGameSession, "mode");
+	const FString CurrentMapPackageName = GetWorld()->GetOutermost()->GetName();
+	const FString MapPackageName = (Map && *Map) ? ResolveMapPackageName(UTF8_TO_TCHAR(Map)) : CurrentMapPackageName;
+	bool bChangeMode = Mode && *Mode;
+	if (bChangeMode)
+	{
+		// The process state follows the game mode through travel, so only modes built on this one can host a session.
+		UClass* GameModeClass = StaticLoadClass(AGameModeBase::StaticClass(), nullptr, *AGameModeBase::StaticGetFullGameClassName(UTF8_TO_TCHAR(Mode)));
+		if (!GameModeClass || !GameModeClass->IsChildOf(AOdinFleetGameMode::StaticClass()))
 		{
-			ServerParameters.m_sessionToken = TCHAR_TO_UTF8(*glAnywhereSessionToken);
+			UE_LOG(GameServerLog, Error, TEXT("Game session requested game mode %s, which is not an AOdinFleetGameMode, keeping the map's game mode"), UTF8_TO_TCHAR(Mode));
+			bChangeMode = false;
 		}
-
-		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_YELLOW);
-		UE_LOG(GameServerLog, Log, TEXT(">>>> WebSocket URL: %s"), *ServerParameters.m_webSocketUrl);
-		UE_LOG(GameServerLog, Log, TEXT(">>>> Fleet ID: %s"), *ServerParameters.m_fleetId);
-		UE_LOG(GameServerLog, Log, TEXT(">>>> Process ID: %s"), *ServerParameters.m_processId);
-		UE_LOG(GameServerLog, Log, TEXT(">>>> Host ID (Compute Name): %s"), *ServerParameters.m_hostId);
-		UE_LOG(GameServerLog, Log, TEXT(">>>> Auth Token: %s"), *ServerParameters.m_authToken);
-		UE_LOG(GameServerLog, Log, TEXT(">>>> Aws Region: %s"), *ServerParameters.m_awsRegion);
-		UE_LOG(GameServerLog, Log, TEXT(">>>> Access Key: %s"), *ServerParameters.m_accessKey);
-		UE_LOG(GameServerLog, Log, TEXT(">>>> Secret Key: %s"), *ServerParameters.m_secretKey);
-		UE_LOG(GameServerLog, Log, TEXT(">>>> Session Token: %s"), *ServerParameters.m_sessionToken);
-		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_NONE);
 	}
 
-	FGameLiftGenericOutcome InitSdkOutcome = GameLiftServerSdkModule->InitSDK();
-	if (InitSdkOutcome.IsSuccess())
+	if (Map && *Map)
 	{
-		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_GREEN);
-		UE_LOG(GameServerLog, Log, TEXT("GameLift InitSDK succeeded!"));
-		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_NONE);
-	}else
+		// Remember the request so the next process start prewarms it, without waiting on the disk here.
+		Async(EAsyncExecution::ThreadPool, [MapPackageName, File = GetRecentMapsFile(), MaxCount = FMath::Max(PrewarmRecentMapCount, 1)]()
+		{
+			FScopeLock Lock(&RecentMapsFileLock);
+			TArray<FString> RecentMaps;
+			FFileHelper::LoadFileToStringArray(RecentMaps, *File);
+			RecentMaps.Remove(MapPackageName);
+			RecentMaps.Insert(MapPackageName, 0);
+			RecentMaps.SetNum(FMath::Min(RecentMaps.Num(), MaxCount));
+			FFileHelper::SaveStringArrayToFile(RecentMaps, *File);
+		});
+	}
+
+	if (MapPackageName == CurrentMapPackageName && !bChangeMode)
 	{
-		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_RED);
-		UE_LOG(GameServerLog, Log, TEXT("ERROR: InitSDK failed : ("));
-		FGameLiftError GameLiftError = InitSdkOutcome.GetError();
-		UE_LOG(GameServerLog, Log, TEXT("ERROR: %s"), *GameLiftError.m_errorMessage);
-		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_NONE);
+		ActivatePendingGameSession();
 		return;
 	}
-	ProcessParameters = MakeShared<FProcessParameters>();
 
-	ProcessParameters->OnStartGameSession.BindLambda([=](Aws::GameLift::Server::Model::GameSession InGameSession)
-	{
-		FString GameSessionId = FString(InGameSession.GetGameSessionId());
-		UE_LOG(GameServerLog, Log, TEXT("GameSession Initializing: %s"), *GameSessionId);
-		GameLiftServerSdkModule->ActivateGameSession();
-	});
-	ProcessParameters->OnUpdateGameSession.BindLambda([=](Aws::GameLift::Server::Model::UpdateGameSession InGameSession)
+	if (!FPackageName::DoesPackageExist(MapPackageName))
 	{
-		UE_LOG(GameServerLog, Log, TEXT("Game SessionUpdating"));
-		Aws::GameLift::Server::Model::UpdateReason c = InGameSession.GetUpdateReason();
-		Aws::GameLift::Server::Model::GameSession r = InGameSession.GetGameSession();
+		UE_LOG(GameServerLog, Error, TEXT("Game session requested unknown map %s, staying on %s"), *MapPackageName, *CurrentMapPackageName);
+		ActivatePendingGameSession();
 		return;
-	});
-	ProcessParameters->OnTerminate.BindLambda([=]()
+	}
+
+	FString TravelURL = MapPackageName;
+	if (bChangeMode)
 	{
-		UE_LOG(GameServerLog, Log, TEXT("Game Server Process is terminating"));
-		FGameLiftGenericOutcome processEndingOutcome = GameLiftServerSdkModule->ProcessEnding();
+		TravelURL += FString::Printf(TEXT("?game=%s"), UTF8_TO_TCHAR(Mode));
+	}
+	UE_LOG(GameServerLog, Log, TEXT("Travelling to %s for the game session"), *TravelURL);
+
+	// Seamless travel keeps connected clients and picks up the prewarmed map package from memory;
+	// OnPostLoadMap activates the session once the map is loaded.
+	GameLiftProcess.bActivationTravelled = true;
+	GameLiftProcess.ActivationMapPackageName = MapPackageName;
+	bUseSeamlessTravel = true;
+	GetWorld()->ServerTravel(TravelURL, true);
+#endif
+}
 
-		FGameLiftGenericOutcome destroyOutcome = GameLiftServerSdkModule->Destroy();
-		if (processEndingOutcome.IsSuccess() && destroyOutcome.IsSuccess())
+void AOdinFleetGameMode::ActivatePendingGameSession()
+{
+#if WITH_GAMELIFT
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+	GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+		[](FGameLiftServerSDKModule& Module) { return Module.ActivateGameSession(); },
+		[](const FGameLiftGenericOutcome& ActivateOutcome)
 		{
-			UE_LOG(GameServerLog, Log, TEXT("Server process ending successfully"));
-			FGenericPlatformMisc::RequestExit(false);
-		}else{
-			if (!processEndingOutcome.IsSuccess()) {
-				const FGameLiftError& error = processEndingOutcome.GetError();
-				UE_LOG(GameServerLog, Error, TEXT("ProcessEnding() failed. Error: %s"),
-				error.m_errorMessage.IsEmpty() ? TEXT("Unknown error") : *error.m_errorMessage);
+			const double ActivationTime = (FPlatformTime::Seconds() - GameLiftProcess.ActivationStartTime) * 1000.0;
+			GameLiftProcess.ActivationStartTime = 0.0;
+			if (ActivateOutcome.IsSuccess())
+			{
+				GameLiftProcess.bSessionActive = true;
+				UE_LOG(GameServerLog, Log, TEXT("Game session activated in %.1f ms (%s)"), ActivationTime,
+					GameLiftProcess.bActivationTravelled ? TEXT("with travel") : TEXT("without travel"));
+				if (GameLiftProcess.bDenyingPlayers)
+				{
+					UpdatePlayerSessionCreationPolicy(INDEX_NONE);
+				}
 			}
-			if (!destroyOutcome.IsSuccess()) {
-				const FGameLiftError& error = destroyOutcome.GetError();
-				UE_LOG(GameServerLog, Error, TEXT("Destroy() failed. Error: %s"),
-				error.m_errorMessage.IsEmpty() ? TEXT("Unknown error") : *error.m_errorMessage);
+			else
+			{
+				UE_LOG(GameServerLog, Error, TEXT("ActivateGameSession() failed after %.1f ms. Error: %s"), ActivationTime, *ActivateOutcome.GetError().m_errorMessage);
 			}
-		}
-	});
-
+		});
+#endif
+}
 
-	ProcessParameters->OnHealthCheck.BindLambda([=]()
+void AOdinFleetGameMode::PreLoginAsync(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, const FOnPreLoginCompleteDelegate& OnComplete)
+{
+#if WITH_GAMELIFT
+	// This game mode does not override PreLogin, and AGameModeBase's only asks GameSession->ApproveLogin,
+	// a local check of player capacity and spectator options. It makes no SDK or network call, so it is
+	// safe to run synchronously here; the GameLift round trip happens in DispatchAdmissions.
+	FString ErrorMessage;
+	PreLogin(Options, Address, UniqueId, ErrorMessage);
+	if (!ErrorMessage.IsEmpty())
 	{
-		UE_LOG(GameServerLog, Log, TEXT("Performing Health Check"));
-		return true;
-	});
-
-
-	ProcessParameters->port = FURL::UrlConfig.DefaultPort;
-	
-
-	TArray<FString> CommandLineTokens;
-	TArray<FString> CommandLineSwitches;
-
-	FCommandLine::Parse(FCommandLine::Get(),CommandLineTokens,CommandLineSwitches);
+		OnComplete.ExecuteIfBound(ErrorMessage);
+		return;
+	}
 
-	for (FString Switch : CommandLineSwitches)
+	int32 SessionSlot = 0;
+	if (GameLiftProcess.SessionSlots.Num() > 1)
 	{
-		FString Key;
-		FString Value;
-
-		if (Switch.Split("=",&Key,&Value))
+		SessionSlot = FindSessionSlot(Options);
+		if (SessionSlot == INDEX_NONE)
 		{
-		    UE_LOG(GameServerLog, Log, TEXT("KEY: %s"), *Key);
-		    UE_LOG(GameServerLog, Log, TEXT("VALUE: %s"), *Value);
-			if (Key.Equals("extport"))
-			{
-				UE_LOG(GameServerLog, Log, TEXT("EXTPORT EXIST"));
-				ProcessParameters->port = FCString::Atoi(*Value);
-			}
+			UE_LOG(GameServerLog, Warning, TEXT("Rejecting login from %s without the GameSessionId of an active game session"), *Address);
+			OnComplete.ExecuteIfBound(TEXT("Unknown GameSessionId"));
+			return;
 		}
 	}
-	if (UNetDriver* Driver = GetWorld()->GetNetDriver())
+
+	const FString PlayerSessionId = UGameplayStatics::ParseOption(Options, TEXT("PlayerSessionId"));
+	if (PlayerSessionId.IsEmpty())
 	{
-		TSharedPtr<const FInternetAddr> LocalAddr = Driver->GetLocalAddr();
-		
-		if (LocalAddr.IsValid())
+		if (bRequirePlayerSessionId)
 		{
-			UE_LOG(GameServerLog, Log, TEXT("PORT %i!"),LocalAddr->GetPort());
+			UE_LOG(GameServerLog, Warning, TEXT("Rejecting login from %s without a PlayerSessionId"), *Address);
+			OnComplete.ExecuteIfBound(TEXT("Missing PlayerSessionId"));
+			return;
 		}
+		// Clients that join the session's address directly have no player session to accept.
+		UE_LOG(GameServerLog, Log, TEXT("Admitting %s without a PlayerSessionId"), *Address);
+		OnComplete.ExecuteIfBound(FString());
+		return;
 	}
 
-	TArray<FString> LogFiles;
-	LogFiles.Add(TEXT("OdinFleet/Saved/Logs/server.log"));
-	ProcessParameters->logParameters = LogFiles;
+	AdmissionTimings.FindOrAdd(PlayerSessionId).QueuedTime = FPlatformTime::Seconds();
+	PendingAdmissions.Add({ PlayerSessionId, OnComplete, SessionSlot });
+	DispatchAdmissions();
+#else
+	Super::PreLoginAsync(Options, Address, UniqueId, OnComplete);
+#endif
+}
 
-	UE_LOG(GameServerLog, Log, TEXT("Calling Process Ready..."));
+void AOdinFleetGameMode::DispatchAdmissions()
+{
+#if WITH_GAMELIFT
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+
+	while (PendingAdmissions.Num() > 0 && AdmissionsInFlight < MaxAdmissionsInFlight)
+	{
+		FPendingAdmission Admission = PendingAdmissions[0];
+		PendingAdmissions.RemoveAt(0);
+		++AdmissionsInFlight;
+		AdmissionTimings.FindOrAdd(Admission.PlayerSessionId).DispatchedTime = FPlatformTime::Seconds();
+
+		// Player sessions of slots other than 0 are accepted by the slot's logical server process.
+		TSharedPtr<FGameLiftLogicalServerProcess, ESPMode::ThreadSafe> Process;
+		if (GameLiftProcess.SessionSlots.IsValidIndex(Admission.SessionSlot))
+		{
+			Process = GameLiftProcess.SessionSlots[Admission.SessionSlot].Process;
+		}
 
-	FGameLiftGenericOutcome ProcessReadyOutcome = GameLiftServerSdkModule->ProcessReady(*ProcessParameters);
+		// Each admission is its own pool task, so the accepts wait on the service side by side.
+		TWeakObjectPtr<AOdinFleetGameMode> WeakThis(this);
+		GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+			[PlayerSessionId = Admission.PlayerSessionId, Process = MoveTemp(Process)](FGameLiftServerSDKModule& Module)
+			{
+				return Process.IsValid() ? Process->AcceptPlayerSession(PlayerSessionId) : Module.AcceptPlayerSession(PlayerSessionId);
+			},
+			[WeakThis, Admission = MoveTemp(Admission)](const FGameLiftGenericOutcome& Outcome)
+			{
+				// The login is completed even if the game mode is gone, so no connection is left waiting.
+				AOdinFleetGameMode* GameMode = WeakThis.Get();
+				if (Outcome.IsSuccess())
+				{
+					if (GameMode)
+					{
+						GameMode->AdmissionTimings.FindOrAdd(Admission.PlayerSessionId).AcceptedTime = FPlatformTime::Seconds();
+					}
+					Admission.OnComplete.ExecuteIfBound(FString());
+				}
+				else
+				{
+					const FString& ErrorMessage = Outcome.GetError().m_errorMessage;
+					UE_LOG(GameServerLog, Warning, TEXT("AcceptPlayerSession(%s) failed. Error: %s"), *Admission.PlayerSessionId, *ErrorMessage);
+					if (GameMode)
+					{
+						GameMode->AdmissionTimings.Remove(Admission.PlayerSessionId);
+					}
+					Admission.OnComplete.ExecuteIfBound(ErrorMessage.IsEmpty() ? TEXT("Player session was not accepted") : ErrorMessage);
+				}
+
+				if (GameMode)
+				{
+					--GameMode->AdmissionsInFlight;
+					GameMode->DispatchAdmissions();
+				}
+			});
+	}
+#endif
+}
 
-	if (ProcessReadyOutcome.IsSuccess())
+FString AOdinFleetGameMode::InitNewPlayer(APlayerController* NewPlayerController, const FUniqueNetIdRepl& UniqueId, const FString& Options, const FString& Portal)
+{
+	const FString ErrorMessage = Super::InitNewPlayer(NewPlayerController, UniqueId, Options, Portal);
+#if WITH_GAMELIFT
+	const FString PlayerSessionId = UGameplayStatics::ParseOption(Options, TEXT("PlayerSessionId"));
+	if (FAdmissionTiming* Timing = AdmissionTimings.Find(PlayerSessionId))
 	{
-		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_GREEN);
-		UE_LOG(GameServerLog, Log, TEXT("Process Ready!"));
-		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_NONE);
+		Timing->LoggedInTime = FPlatformTime::Seconds();
+		PlayerSessionIds.Add(NewPlayerController, PlayerSessionId);
 	}
-	else
+	if (GameLiftProcess.SessionSlots.Num() > 1)
+	{
+		const int32 SessionSlot = FindSessionSlot(Options);
+		if (SessionSlot != INDEX_NONE)
+		{
+			PlayerSessionSlots.Add(NewPlayerController, SessionSlot);
+		}
+	}
+#endif
+	return ErrorMessage;
+}
+
+void AOdinFleetGameMode::HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer)
+{
+	Super::HandleStartingNewPlayer_Implementation(NewPlayer);
+#if WITH_GAMELIFT
+	FString PlayerSessionId;
+	FAdmissionTiming Timing;
+	if (PlayerSessionIds.RemoveAndCopyValue(NewPlayer, PlayerSessionId) && AdmissionTimings.RemoveAndCopyValue(PlayerSessionId, Timing))
+	{
+		const double SpawnedTime = FPlatformTime::Seconds();
+		UE_LOG(GameServerLog, Log, TEXT("Admitted %s: queued %.1f ms, accept %.1f ms, login %.1f ms, spawn %.1f ms, total %.1f ms"),
+			*PlayerSessionId,
+			(Timing.DispatchedTime - Timing.QueuedTime) * 1000.0,
+			(Timing.AcceptedTime - Timing.DispatchedTime) * 1000.0,
+			(Timing.LoggedInTime - Timing.AcceptedTime) * 1000.0,
+			(SpawnedTime - Timing.LoggedInTime) * 1000.0,
+			(SpawnedTime - Timing.QueuedTime) * 1000.0);
+	}
+#endif
+}
+
+void AOdinFleetGameMode::Logout(AController* Exiting)
+{
+#if WITH_GAMELIFT
+	FString PlayerSessionId;
+	if (PlayerSessionIds.RemoveAndCopyValue(Cast<APlayerController>(Exiting), PlayerSessionId))
+	{
+		AdmissionTimings.Remove(PlayerSessionId);
+	}
+	int32 SessionSlot = INDEX_NONE;
+	PlayerSessionSlots.RemoveAndCopyValue(Exiting, SessionSlot);
+#endif
+	Super::Logout(Exiting);
+#if WITH_GAMELIFT
+	if (GameLiftProcess.SessionSlots.Num() > 1)
+	{
+		if (GameLiftProcess.SessionSlots.IsValidIndex(SessionSlot) && GameLiftProcess.SessionSlots[SessionSlot].bSessionActive)
+		{
+			bool bSlotOccupied = false;
+			for (const TPair<TObjectKey<AController>, int32>& PlayerSlot : PlayerSessionSlots)
+			{
+				bSlotOccupied |= PlayerSlot.Value == SessionSlot;
+			}
+			if (!bSlotOccupied)
+			{
+				UE_LOG(GameServerLog, Log, TEXT("Last player left the game session in slot %d"), SessionSlot);
+				EndSessionSlot(SessionSlot, true);
+			}
+		}
+	}
+	// The exiting controller is still counted until it is destroyed.
+	else if (GameLiftProcess.bSessionActive && Cast<APlayerController>(Exiting) && GetNumPlayers() <= 1)
+	{
+		UE_LOG(GameServerLog, Log, TEXT("Last player left the game session"));
+		EndGameSession();
+	}
+#endif
+}
+
+void AOdinFleetGameMode::EndGameSession()
+{
+#if WITH_GAMELIFT
+	if (GameLiftProcess.SessionSlots.Num() > 1)
+	{
+		for (int32 SlotIndex = 0; SlotIndex < GameLiftProcess.SessionSlots.Num(); ++SlotIndex)
+		{
+			if (GameLiftProcess.SessionSlots[SlotIndex].bSessionActive)
+			{
+				EndSessionSlot(SlotIndex, true);
+			}
+		}
+		return;
+	}
+
+	if (!GameLiftProcess.bSessionActive)
+	{
+		return;
+	}
+	GameLiftProcess.bSessionActive = false;
+
+	if (!bRecycleSessions && !FParse::Param(FCommandLine::Get(), TEXT("recycle")))
+	{
+		ShutDownProcess();
+		return;
+	}
+
+	UE_LOG(GameServerLog, Log, TEXT("Recycling the process for the next game session"));
+	GameLiftProcess.RecycleStartTime = FPlatformTime::Seconds();
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		if (APlayerController* PlayerController = Iterator->Get())
+		{
+			GameSession->KickPlayer(PlayerController, NSLOCTEXT("OdinFleet", "GameSessionEnded", "The game session has ended."));
+		}
+	}
+
+	// Reloading the map discards every actor, the game mode with its scores, and all timers.
+	// Nobody is left to travel along, so this is a plain map load.
+	bUseSeamlessTravel = false;
+	GetWorld()->ServerTravel(GetWorld()->GetOutermost()->GetName(), true);
+#endif
+}
+
+void AOdinFleetGameMode::CompleteRecycle()
+{
+#if WITH_GAMELIFT
+	// Drop what the last match allocated before the next one starts.
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+	FMemory::Trim();
+	if (UOdinFleetServerHealthSubsystem* Health = GetServerHealth())
+	{
+		Health->IgnoreNextFrame();
+	}
+	EndProcessThenReportReady();
+#endif
+}
+
+void AOdinFleetGameMode::EndProcessThenReportReady()
+{
+#if WITH_GAMELIFT
+	// The finished game session ends with the process's registration; ProcessReady then registers it
+	// again, without a game session. Both wait on the service, so keep them off the game thread.
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+	GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+		[](FGameLiftServerSDKModule& Module) { return Module.ProcessEnding(); },
+		[](const FGameLiftGenericOutcome& ProcessEndingOutcome)
+		{
+			AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get();
+			if (ProcessEndingOutcome.IsSuccess())
+			{
+				if (GameMode)
+				{
+					GameMode->ReportProcessReady();
+				}
+				return;
+			}
+			UE_LOG(GameServerLog, Warning, TEXT("ProcessEnding failed while recycling. Error: %s"), *ProcessEndingOutcome.GetError().m_errorMessage);
+			GameLiftProcess.RecycleStartTime = 0.0;
+			if (GameLiftProcess.SessionSlots.Num() > 1 && GameMode)
+			{
+				GameMode->RetireSessionSlot(0);
+			}
+			else
+			{
+				ShutDownProcess();
+			}
+		});
+#endif
+}
+
+void AOdinFleetGameMode::ShutDownProcess()
+{
+#if WITH_GAMELIFT
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+
+	// The logical server processes of other session slots end along with this one.
+	TArray<TSharedPtr<FGameLiftLogicalServerProcess, ESPMode::ThreadSafe>> LogicalProcesses;
+	for (FSessionSlot& Slot : GameLiftProcess.SessionSlots)
+	{
+		if (Slot.Process.IsValid())
+		{
+			LogicalProcesses.Add(MoveTemp(Slot.Process));
+		}
+		Slot.bRetired = true;
+	}
+
+	// ProcessEnding and Destroy wait on the service, so keep them off the game thread.
+	const bool bEndProcess = !GameLiftProcess.bProcessEnded;
+	GameLiftProcess.bProcessEnded = true;
+	GameLiftServerSdkModule->CallAsync<TPair<FGameLiftGenericOutcome, FGameLiftGenericOutcome>>(
+		[LogicalProcesses = MoveTemp(LogicalProcesses), bEndProcess](FGameLiftServerSDKModule& Module)
+		{
+			for (const TSharedPtr<FGameLiftLogicalServerProcess, ESPMode::ThreadSafe>& LogicalProcess : LogicalProcesses)
+			{
+				LogicalProcess->ProcessEnding();
+			}
+			FGameLiftGenericOutcome ProcessEndingOutcome = bEndProcess ? Module.ProcessEnding() : FGameLiftGenericOutcome(nullptr);
+			FGameLiftGenericOutcome DestroyOutcome = Module.Destroy();
+			return TPair<FGameLiftGenericOutcome, FGameLiftGenericOutcome>(ProcessEndingOutcome, DestroyOutcome);
+		},
+		[](const TPair<FGameLiftGenericOutcome, FGameLiftGenericOutcome>& Outcomes)
+		{
+			const FGameLiftGenericOutcome& processEndingOutcome = Outcomes.Key;
+			const FGameLiftGenericOutcome& destroyOutcome = Outcomes.Value;
+			if (processEndingOutcome.IsSuccess() && destroyOutcome.IsSuccess())
+			{
+				UE_LOG(GameServerLog, Log, TEXT("Server process ending successfully"));
+				FGenericPlatformMisc::RequestExit(false);
+			}else{
+				if (!processEndingOutcome.IsSuccess()) {
+					const FGameLiftError& error = processEndingOutcome.GetError();
+					UE_LOG(GameServerLog, Error, TEXT("ProcessEnding() failed. Error: %s"),
+					error.m_errorMessage.IsEmpty() ? TEXT("Unknown error") : *error.m_errorMessage);
+				}
+				if (!destroyOutcome.IsSuccess()) {
+					const FGameLiftError& error = destroyOutcome.GetError();
+					UE_LOG(GameServerLog, Error, TEXT("Destroy() failed. Error: %s"),
+					error.m_errorMessage.IsEmpty() ? TEXT("Unknown error") : *error.m_errorMessage);
+				}
+			}
+		});
+#endif
+}
+
+void AOdinFleetGameMode::InitGameLift()
+{
+#if WITH_GAMELIFT
+	UE_LOG(GameServerLog, Log, TEXT("Game Lift initialized"));
+	if (LoadReportIntervalSeconds > 0.0f)
+	{
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float DeltaTime)
+		{
+			ReportSessionLoad();
+			return true;
+		}), LoadReportIntervalSeconds);
+	}
+	GameLiftProcess.GameThreadCpus = FPlatformMisc::GetEnvironmentVariable(GameThreadCpusVariable);
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+
+	FServerParameters ServerParameters;
+	bool bIsAnywhereActive = false;
+	if (FParse::Param(FCommandLine::Get(), TEXT("glAnywhere")))
+	{
+		bIsAnywhereActive = true;
+	}
+	if (bIsAnywhereActive)
+	{
+		FString glAnywhereWebSocketUrl = "";
+		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereWebSocketUrl="),glAnywhereWebSocketUrl))
+		{
+			ServerParameters.m_webSocketUrl = TCHAR_TO_UTF8(*glAnywhereWebSocketUrl);
+		}
+
+		FString glAnywhereFleetId = "";
+		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereFleetId="),glAnywhereFleetId))
+		{
+			ServerParameters.m_fleetId = TCHAR_TO_UTF8(*glAnywhereFleetId);
+		}
+
+		FString glAnywhereProcessId = "";
+		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereProcessId="),glAnywhereProcessId))
+		{
+			ServerParameters.m_processId = TCHAR_TO_UTF8(*glAnywhereProcessId);
+		}else
+		{
+			FString TimeString = FString::FromInt(std::time(nullptr));
+			FString ProcessId = "ProcessId_" +TimeString;
+			ServerParameters.m_processId = TCHAR_TO_UTF8(*ProcessId);
+		}
+
+		FString glAnywhereHostId = "";
+		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereHostId="), glAnywhereHostId))
+		{
+			ServerParameters.m_hostId = TCHAR_TO_UTF8(*glAnywhereHostId);
+		}
+		
+		FString glAnywhereAuthToken = "";
+		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereAuthToken="),glAnywhereAuthToken))
+		{
+			ServerParameters.m_authToken = TCHAR_TO_UTF8(*glAnywhereAuthToken);
+		}
+
+		FString glAnywhereAwsRegion = "";
+		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereAwsRegion="),glAnywhereAwsRegion))
+		{
+			ServerParameters.m_awsRegion = TCHAR_TO_UTF8(*glAnywhereAwsRegion);
+		}
+
+		FString glAnywhereAccessKey = "";
+		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereAccessKey="),glAnywhereAccessKey))
+		{
+			ServerParameters.m_accessKey = TCHAR_TO_UTF8(*glAnywhereAccessKey);
+		}
+
+		FString glAnywhereSecretKey = "";
+		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereSecretKey="),glAnywhereSecretKey))
+		{
+			ServerParameters.m_secretKey = TCHAR_TO_UTF8(*glAnywhereSecretKey);
+		}
+
+		FString glAnywhereSessionToken  = "";
+		if (FParse::Value(FCommandLine::Get(), TEXT("glAnywhereSessionToken="),glAnywhereSessionToken))
+		{
+			ServerParameters.m_sessionToken = TCHAR_TO_UTF8(*glAnywhereSessionToken);
+		}
+
+		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_YELLOW);
+		UE_LOG(GameServerLog, Log, TEXT(">>>> WebSocket URL: %s"), *ServerParameters.m_webSocketUrl);
+		UE_LOG(GameServerLog, Log, TEXT(">>>> Fleet ID: %s"), *ServerParameters.m_fleetId);
+		UE_LOG(GameServerLog, Log, TEXT(">>>> Process ID: %s"), *ServerParameters.m_processId);
+		UE_LOG(GameServerLog, Log, TEXT(">>>> Host ID (Compute Name): %s"), *ServerParameters.m_hostId);
+		UE_LOG(GameServerLog, Log, TEXT(">>>> Auth Token: %s"), *ServerParameters.m_authToken);
+		UE_LOG(GameServerLog, Log, TEXT(">>>> Aws Region: %s"), *ServerParameters.m_awsRegion);
+		UE_LOG(GameServerLog, Log, TEXT(">>>> Access Key: %s"), *ServerParameters.m_accessKey);
+		UE_LOG(GameServerLog, Log, TEXT(">>>> Secret Key: %s"), *ServerParameters.m_secretKey);
+		UE_LOG(GameServerLog, Log, TEXT(">>>> Session Token: %s"), *ServerParameters.m_sessionToken);
+		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_NONE);
+	}
+
+	GameLiftProcess.ServerParameters = ServerParameters;
+#if PLATFORM_UNIX
+	const FString WarmPoolFd = FPlatformMisc::GetEnvironmentVariable(WarmPoolFdVariable);
+	if (!WarmPoolFd.IsEmpty())
+	{
+		// Boot and prewarm now; the launcher supplies the GameLift connection once it promotes the process.
+		GameLiftProcess.WarmPoolFd = FCString::Atoi(*WarmPoolFd);
+		UE_LOG(GameServerLog, Log, TEXT("Started for the launcher's warm pool, InitSDK waits for promotion"));
+	}
+	else
+#endif
+	{
+		FGameLiftGenericOutcome InitSdkOutcome = GameLiftServerSdkModule->InitSDK();
+		if (InitSdkOutcome.IsSuccess())
+		{
+			UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_GREEN);
+			UE_LOG(GameServerLog, Log, TEXT("GameLift InitSDK succeeded!"));
+			UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_NONE);
+		}
+		else
+		{
+			UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_RED);
+			UE_LOG(GameServerLog, Log, TEXT("ERROR: InitSDK failed : ("));
+			FGameLiftError GameLiftError = InitSdkOutcome.GetError();
+			UE_LOG(GameServerLog, Log, TEXT("ERROR: %s"), *GameLiftError.m_errorMessage);
+			UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_NONE);
+			return;
+		}
+	}
+
+	const int32 SlotCount = GetSessionSlotCount();
+	if (SlotCount > 1)
+	{
+		UE_LOG(GameServerLog, Log, TEXT("Hosting up to %d game sessions in this process"), SlotCount);
+		GameLiftProcess.SessionSlots.SetNum(SlotCount);
+	}
+
+	ProcessParameters = MakeShared<FProcessParameters>();
+
+	ProcessParameters->OnStartGameSession.BindLambda([=](const Aws::GameLift::Server::Model::GameSession& InGameSession)
+	{
+		FString GameSessionId = FString(InGameSession.GetGameSessionId());
+		UE_LOG(GameServerLog, Log, TEXT("GameSession Initializing: %s"), *GameSessionId);
+		GameLiftProcess.GameSessionId = GameSessionId;
+		// Delivered on the game thread; the game mode that called InitGameLift may have been replaced by travel.
+		if (AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get())
+		{
+			GameMode->StartGameSession(InGameSession);
+		}
+	});
+	ProcessParameters->OnUpdateGameSession.BindLambda([=](const Aws::GameLift::Server::Model::UpdateGameSession& InGameSession)
+	{
+		UE_LOG(GameServerLog, Log, TEXT("Game SessionUpdating"));
+		Aws::GameLift::Server::Model::UpdateReason c = InGameSession.GetUpdateReason();
+		const Aws::GameLift::Server::Model::GameSession& r = InGameSession.GetGameSession();
+		return;
+	});
+	ProcessParameters->OnTerminate.BindLambda([=]()
+	{
+		UE_LOG(GameServerLog, Log, TEXT("Game Server Process is terminating"));
+		GameLiftProcess.bSessionActive = false;
+		GameLiftProcess.RecycleStartTime = 0.0;
+		ShutDownProcess();
+	});
+
+
+	ProcessParameters->OnHealthCheck.BindLambda([=]()
+	{
+		UE_LOG(GameServerLog, Log, TEXT("Performing Health Check"));
+		return CheckServerHealth();
+	});
+	if (UOdinFleetServerHealthSubsystem* Health = GetGameInstance()->GetSubsystem<UOdinFleetServerHealthSubsystem>())
+	{
+		Health->OnOverloadChanged.AddLambda([](bool bOverloaded)
+		{
+			GameLiftProcess.bDenyingPlayers = bOverloaded;
+			UpdatePlayerSessionCreationPolicy(INDEX_NONE);
+		});
+	}
+
+
+	ProcessParameters->port = FURL::UrlConfig.DefaultPort;
+	
+
+	TArray<FString> CommandLineTokens;
+	TArray<FString> CommandLineSwitches;
+
+	FCommandLine::Parse(FCommandLine::Get(),CommandLineTokens,CommandLineSwitches);
+
+	for (FString Switch : CommandLineSwitches)
+	{
+		FString Key;
+		FString Value;
+
+		if (Switch.Split("=",&Key,&Value))
+		{
+		    UE_LOG(GameServerLog, Log, TEXT("KEY: %s"), *Key);
+		    UE_LOG(GameServerLog, Log, TEXT("VALUE: %s"), *Value);
+			if (Key.Equals("extport"))
+			{
+				UE_LOG(GameServerLog, Log, TEXT("EXTPORT EXIST"));
+				ProcessParameters->port = FCString::Atoi(*Value);
+			}
+		}
+	}
+	if (UNetDriver* Driver = GetWorld()->GetNetDriver())
+	{
+		TSharedPtr<const FInternetAddr> LocalAddr = Driver->GetLocalAddr();
+		
+		if (LocalAddr.IsValid())
+		{
+			UE_LOG(GameServerLog, Log, TEXT("PORT %i!"),LocalAddr->GetPort());
+		}
+	}
+
+	TArray<FString> LogFiles;
+	LogFiles.Add(TEXT("OdinFleet/Saved/Logs/server.log"));
+	ProcessParameters->logParameters = LogFiles;
+
+	GameLiftProcess.ProcessParameters = ProcessParameters;
+	Prewarm();
+	UE_LOG(GameServerLog, Log, TEXT("InitGameLift completed!"));
+	#endif
+}
+
+void AOdinFleetGameMode::ReportProcessReady()
+{
+#if WITH_GAMELIFT
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+
+	UE_LOG(GameServerLog, Log, TEXT("Calling Process Ready..."));
+
+	// ProcessReady waits for the service, so keep it off the game thread.
+	GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+		[Parameters = *GameLiftProcess.ProcessParameters](FGameLiftServerSDKModule& Module) mutable { return Module.ProcessReady(Parameters); },
+		[](const FGameLiftGenericOutcome& ProcessReadyOutcome)
+		{
+			if (AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get())
+			{
+				GameMode->OnProcessReady(ProcessReadyOutcome.IsSuccess(), ProcessReadyOutcome.IsSuccess() ? FString() : ProcessReadyOutcome.GetError().m_errorMessage);
+			}
+		});
+#endif
+}
+
+void AOdinFleetGameMode::OnProcessReady(bool bSuccess, const FString& ErrorMessage)
+{
+#if WITH_GAMELIFT
+	if (bSuccess)
+	{
+		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_GREEN);
+		UE_LOG(GameServerLog, Log, TEXT("Process Ready!"));
+		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_NONE);
+
+		if (GameLiftProcess.RecycleStartTime > 0.0)
+		{
+			UE_LOG(GameServerLog, Log, TEXT("Recycled into the ready pool in %.1f ms; a restart took %.1f ms to reach ready"),
+				(FPlatformTime::Seconds() - GameLiftProcess.RecycleStartTime) * 1000.0, GameLiftProcess.ColdStartSeconds * 1000.0);
+			GameLiftProcess.RecycleStartTime = 0.0;
+		}
+		else if (GameLiftProcess.ColdStartSeconds == 0.0)
+		{
+			if (GameLiftProcess.PromotionStartTime > 0.0)
+			{
+				// A restart would pay for the warmup as well as the promotion.
+				const double PromotionSeconds = FPlatformTime::Seconds() - GameLiftProcess.PromotionStartTime;
+				GameLiftProcess.ColdStartSeconds = GameLiftProcess.WarmSeconds + PromotionSeconds;
+				GameLiftProcess.PromotionStartTime = 0.0;
+				UE_LOG(GameServerLog, Log, TEXT("Promoted from the warm pool and ready in %.1f ms; warming up took %.1f ms"),
+					PromotionSeconds * 1000.0, GameLiftProcess.WarmSeconds * 1000.0);
+			}
+			else
+			{
+				GameLiftProcess.ColdStartSeconds = FPlatformTime::Seconds() - GStartTime;
+				UE_LOG(GameServerLog, Log, TEXT("Process ready %.1f ms after engine start"), GameLiftProcess.ColdStartSeconds * 1000.0);
+			}
+			PinGameThread();
+			if (UOdinFleetServerHealthSubsystem* Health = GetServerHealth())
+			{
+				Health->StartMonitoring();
+			}
+			ConnectSessionSlots();
+		}
+	}
+	else if (GameLiftProcess.SessionSlots.Num() > 1 && GameLiftProcess.ColdStartSeconds > 0.0)
+	{
+		// Session slot 0 was recycled; the other slots keep hosting.
+		UE_LOG(GameServerLog, Warning, TEXT("ProcessReady failed for session slot 0, retiring it. Error: %s"), *ErrorMessage);
+		GameLiftProcess.bProcessEnded = true;
+		RetireSessionSlot(0);
+	}
+	else if (GameLiftProcess.RecycleStartTime > 0.0)
+	{
+		// The fleet would not take the process back; end it and let a fresh one take its place.
+		UE_LOG(GameServerLog, Warning, TEXT("ProcessReady failed while recycling, ending the process. Error: %s"), *ErrorMessage);
+		GameLiftProcess.RecycleStartTime = 0.0;
+		ShutDownProcess();
+	}
+	else
 	{
 		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_RED);
 		UE_LOG(GameServerLog, Log, TEXT("ERROR: Process Ready Failed!"));
-		FGameLiftError ProcessReadyError = ProcessReadyOutcome.GetError();
-		UE_LOG(GameServerLog, Log, TEXT("ERROR: %s"), *ProcessReadyError.m_errorMessage);
+		UE_LOG(GameServerLog, Log, TEXT("ERROR: %s"), *ErrorMessage);
 		UE_LOG(GameServerLog, SetColor, TEXT("%s"), COLOR_NONE);
 	}
-	UE_LOG(GameServerLog, Log, TEXT("InitGameLift completed!"));
 	#endif
 }
 
+void AOdinFleetGameMode::WaitForPromotion()
+{
+#if WITH_GAMELIFT && PLATFORM_UNIX
+	const int32 Fd = GameLiftProcess.WarmPoolFd;
+	GameLiftProcess.WarmSeconds = FPlatformTime::Seconds() - GStartTime;
+	UE_LOG(GameServerLog, Log, TEXT("Warm %.1f ms after engine start, waiting for promotion"), GameLiftProcess.WarmSeconds * 1000.0);
+
+	static const ANSICHAR WarmMessage[] = "WARM\n";
+	send(Fd, WarmMessage, sizeof(WarmMessage) - 1, MSG_NOSIGNAL);
+
+	// The launcher sends KEY=VALUE lines ending with an empty line, then closes its end. If it closes
+	// without a message it is gone, and this process has nothing left to wait for.
+	Async(EAsyncExecution::Thread, [Fd]()
+	{
+		TArray<ANSICHAR> Message;
+		bool bComplete = false;
+		while (!bComplete)
+		{
+			ANSICHAR Buffer[1024];
+			const ssize_t Received = recv(Fd, Buffer, sizeof(Buffer), 0);
+			if (Received <= 0)
+			{
+				break;
+			}
+			Message.Append(Buffer, Received);
+			bComplete = Message.Num() >= 2 && Message.Last() == '\n' && Message.Last(1) == '\n';
+		}
+		close(Fd);
+
+		FString Text(Message.Num(), Message.GetData());
+		AsyncTask(ENamedThreads::GameThread, [bComplete, Text = MoveTemp(Text)]()
+		{
+			AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get();
+			if (!bComplete || !GameMode)
+			{
+				UE_LOG(GameServerLog, Warning, TEXT("The launcher closed the warm pool socket without promoting this process, exiting"));
+				FGenericPlatformMisc::RequestExit(false);
+				return;
+			}
+			GameMode->CompletePromotion(Text);
+		});
+	});
+#endif
+}
+
+void AOdinFleetGameMode::CompletePromotion(const FString& Message)
+{
+#if WITH_GAMELIFT
+	GameLiftProcess.WarmPoolFd = -1;
+	GameLiftProcess.PromotionStartTime = FPlatformTime::Seconds();
+
+	FServerParameters& ServerParameters = GameLiftProcess.ServerParameters;
+	TArray<FString> Lines;
+	Message.ParseIntoArrayLines(Lines);
+	for (const FString& Line : Lines)
+	{
+		FString Key;
+		FString Value;
+		if (!Line.Split(TEXT("="), &Key, &Value))
+		{
+			continue;
+		}
+		if (Key == TEXT("GAMELIFT_SDK_WEBSOCKET_URL"))
+		{
+			ServerParameters.m_webSocketUrl = Value;
+		}
+		else if (Key == TEXT("GAMELIFT_SDK_AUTH_TOKEN"))
+		{
+			ServerParameters.m_authToken = Value;
+		}
+		else if (Key == TEXT("GAMELIFT_SDK_PROCESS_ID"))
+		{
+			ServerParameters.m_processId = Value;
+		}
+		else if (Key == TEXT("GAMELIFT_SDK_HOST_ID"))
+		{
+			ServerParameters.m_hostId = Value;
+		}
+		else if (Key == TEXT("GAMELIFT_SDK_FLEET_ID"))
+		{
+			ServerParameters.m_fleetId = Value;
+		}
+		else if (Key == GameThreadCpusVariable)
+		{
+			GameLiftProcess.GameThreadCpus = Value;
+		}
+	}
+	UE_LOG(GameServerLog, Log, TEXT("Promoted from the warm pool as process %s"), *ServerParameters.m_processId);
+
+	// InitSDK opens the websocket, so keep it off the game thread.
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+	GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+		[ServerParameters = ServerParameters](FGameLiftServerSDKModule& Module) { return Module.InitSDK(ServerParameters); },
+		[](const FGameLiftGenericOutcome& InitSdkOutcome)
+		{
+			if (!InitSdkOutcome.IsSuccess())
+			{
+				// The launcher counts the early exit as a failed start and replaces the process.
+				UE_LOG(GameServerLog, Error, TEXT("InitSDK failed after promotion, exiting. Error: %s"), *InitSdkOutcome.GetError().m_errorMessage);
+				FGenericPlatformMisc::RequestExit(false);
+				return;
+			}
+			if (AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get())
+			{
+				GameMode->ReportProcessReady();
+			}
+		});
+#endif
+}
+
+void AOdinFleetGameMode::PinGameThread()
+{
+#if WITH_GAMELIFT
+	if (GameLiftProcess.GameThreadCpus.IsEmpty())
+	{
+		return;
+	}
+
+	// A cpulist such as "2-3,10".
+	uint64 AffinityMask = 0;
+	TArray<FString> Ranges;
+	GameLiftProcess.GameThreadCpus.ParseIntoArray(Ranges, TEXT(","));
+	for (const FString& Range : Ranges)
+	{
+		FString First = Range;
+		FString Last = Range;
+		Range.Split(TEXT("-"), &First, &Last);
+		for (int32 Cpu = FCString::Atoi(*First); Cpu <= FCString::Atoi(*Last) && Cpu < 64; ++Cpu)
+		{
+			AffinityMask |= 1ull << Cpu;
+		}
+	}
+	if (AffinityMask == 0)
+	{
+		UE_LOG(GameServerLog, Warning, TEXT("Ignoring game thread CPUs %s"), *GameLiftProcess.GameThreadCpus);
+		return;
+	}
+
+	FPlatformProcess::SetThreadAffinityMask(AffinityMask);
+	UE_LOG(GameServerLog, Log, TEXT("Pinned the game thread to CPUs %s"), *GameLiftProcess.GameThreadCpus);
+	if (UOdinFleetServerHealthSubsystem* Health = GetServerHealth())
+	{
+		Health->SetGameThreadCpus(GameLiftProcess.GameThreadCpus);
+	}
+#endif
+}
+
+int32 AOdinFleetGameMode::GetSessionSlotCount() const
+{
+	int32 Count = SessionSlotCount;
+	FParse::Value(FCommandLine::Get(), TEXT("sessions="), Count);
+	return FMath::Max(Count, 1);
+}
+
+void AOdinFleetGameMode::ConnectSessionSlots()
+{
+#if WITH_GAMELIFT
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+
+	for (int32 SlotIndex = 1; SlotIndex < GameLiftProcess.SessionSlots.Num(); ++SlotIndex)
+	{
+		FSessionSlot& Slot = GameLiftProcess.SessionSlots[SlotIndex];
+		Slot.Process = MakeShared<FGameLiftLogicalServerProcess, ESPMode::ThreadSafe>(FString::Printf(TEXT("-slot%d"), SlotIndex));
+
+		// Same port, log files and health check as slot 0; only the game session events differ.
+		Slot.ProcessParameters = *GameLiftProcess.ProcessParameters;
+		Slot.ProcessParameters.OnStartGameSession.BindLambda([SlotIndex](const Aws::GameLift::Server::Model::GameSession& InGameSession)
+		{
+			UE_LOG(GameServerLog, Log, TEXT("GameSession Initializing in slot %d: %s"), SlotIndex, UTF8_TO_TCHAR(InGameSession.GetGameSessionId()));
+			if (AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get())
+			{
+				GameMode->StartSessionSlot(SlotIndex, InGameSession);
+			}
+		});
+		Slot.ProcessParameters.OnUpdateGameSession.Unbind();
+		Slot.ProcessParameters.OnHealthCheck.BindLambda([]() { return CheckServerHealth(); });
+		Slot.ProcessParameters.OnTerminate.BindLambda([SlotIndex]()
+		{
+			UE_LOG(GameServerLog, Log, TEXT("Logical server process of slot %d is terminating"), SlotIndex);
+			if (AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get())
+			{
+				GameMode->EndSessionSlot(SlotIndex, false);
+			}
+		});
+
+		// Connecting opens a websocket and waits for the service, so keep it off the game thread.
+		// The GAMELIFT_SDK_* environment overrides these, as it did for InitSDK; a process promoted from the
+		// warm pool has none and uses what the launcher sent.
+		TSharedPtr<FGameLiftLogicalServerProcess, ESPMode::ThreadSafe> Process = Slot.Process;
+		const FServerParameters ServerParameters = GameLiftProcess.ServerParameters;
+		GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+			[Process, ServerParameters](FGameLiftServerSDKModule& Module) { return Process->Connect(ServerParameters); },
+			[SlotIndex](const FGameLiftGenericOutcome& ConnectOutcome)
+			{
+				if (!GameLiftProcess.SessionSlots.IsValidIndex(SlotIndex) || GameLiftProcess.SessionSlots[SlotIndex].bRetired)
+				{
+					return;
+				}
+				if (!ConnectOutcome.IsSuccess())
+				{
+					UE_LOG(GameServerLog, Error, TEXT("Could not register the logical server process of slot %d. Error: %s"), SlotIndex, *ConnectOutcome.GetError().m_errorMessage);
+					GameLiftProcess.SessionSlots[SlotIndex].Process.Reset();
+					GameLiftProcess.SessionSlots[SlotIndex].bRetired = true;
+					return;
+				}
+				if (AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get())
+				{
+					GameMode->ReportSessionSlotReady(SlotIndex);
+				}
+			});
+	}
+#endif
+}
+
+void AOdinFleetGameMode::ReportSessionSlotReady(int32 SlotIndex)
+{
+#if WITH_GAMELIFT
+	if (!GameLiftProcess.SessionSlots.IsValidIndex(SlotIndex) || !GameLiftProcess.SessionSlots[SlotIndex].Process.IsValid())
+	{
+		return;
+	}
+	const FSessionSlot& Slot = GameLiftProcess.SessionSlots[SlotIndex];
+
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+	GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+		[Process = Slot.Process, Parameters = Slot.ProcessParameters](FGameLiftServerSDKModule& Module) mutable { return Process->ProcessReady(Parameters); },
+		[SlotIndex](const FGameLiftGenericOutcome& ProcessReadyOutcome)
+		{
+			if (ProcessReadyOutcome.IsSuccess())
+			{
+				UE_LOG(GameServerLog, Log, TEXT("Session slot %d ready"), SlotIndex);
+				return;
+			}
+			UE_LOG(GameServerLog, Warning, TEXT("ProcessReady failed for session slot %d, retiring it. Error: %s"), SlotIndex, *ProcessReadyOutcome.GetError().m_errorMessage);
+			if (AOdinFleetGameMode* GameMode = GameLiftProcess.ActiveGameMode.Get())
+			{
+				GameMode->RetireSessionSlot(SlotIndex);
+			}
+		});
+#endif
+}
+
+void AOdinFleetGameMode::StartSessionSlot(int32 SlotIndex, const Aws::GameLift::Server::Model::GameSession& InGameSession)
+{
+#if WITH_GAMELIFT
+	if (!GameLiftProcess.SessionSlots.IsValidIndex(SlotIndex))
+	{
+		return;
+	}
+	FSessionSlot& Slot = GameLiftProcess.SessionSlots[SlotIndex];
+	Slot.GameSessionId = UTF8_TO_TCHAR(InGameSession.GetGameSessionId());
+	Slot.ActivationStartTime = FPlatformTime::Seconds();
+
+	const char* Map = FindGamePropertyValue(InGameSession, "map");
+	const char* Mode = FindGamePropertyValue(InGameSession, "mode");
+	const FString MapPackageName = (Map && *Map) ? ResolveMapPackageName(UTF8_TO_TCHAR(Map)) : GetWorld()->GetOutermost()->GetName();
+	if (Mode && *Mode)
+	{
+		UE_LOG(GameServerLog, Warning, TEXT("Ignoring game mode %s for slot %d; session slots share the game mode of the process"), UTF8_TO_TCHAR(Mode), SlotIndex);
+	}
+
+	// Each slot gets its own copy of the map, far enough from the others that their actors do not meet.
+	// The slots still share one world: see AOdinFleetGameMode::SessionSlotCount for what they share.
+	bool bLoaded = false;
+	const FVector Location = SessionSlotSpacing * (SlotIndex + 1);
+	const FString LevelName = FString::Printf(TEXT("SessionSlot%d_%d"), SlotIndex, ++GameLiftProcess.LevelInstanceCount);
+	ULevelStreamingDynamic* Level = FPackageName::DoesPackageExist(MapPackageName)
+		? ULevelStreamingDynamic::LoadLevelInstance(GetWorld(), MapPackageName, Location, FRotator::ZeroRotator, bLoaded, LevelName)
+		: nullptr;
+	if (!Level || !bLoaded)
+	{
+		UE_LOG(GameServerLog, Error, TEXT("Could not load %s for session slot %d, hosting it in the persistent level"), *MapPackageName, SlotIndex);
+		ActivateSessionSlot(SlotIndex);
+		return;
+	}
+
+	UE_LOG(GameServerLog, Log, TEXT("Loading %s for session slot %d"), *MapPackageName, SlotIndex);
+	Slot.Level = Level;
+	Level->OnLevelShown.AddDynamic(this, &AOdinFleetGameMode::OnSessionLevelShown);
+#endif
+}
+
+void AOdinFleetGameMode::OnSessionLevelShown()
+{
+#if WITH_GAMELIFT
+	for (int32 SlotIndex = 0; SlotIndex < GameLiftProcess.SessionSlots.Num(); ++SlotIndex)
+	{
+		ULevelStreamingDynamic* Level = GameLiftProcess.SessionSlots[SlotIndex].Level.Get();
+		if (Level && Level->IsLevelVisible() && Level->OnLevelShown.IsAlreadyBound(this, &AOdinFleetGameMode::OnSessionLevelShown))
+		{
+			Level->OnLevelShown.RemoveDynamic(this, &AOdinFleetGameMode::OnSessionLevelShown);
+			ActivateSessionSlot(SlotIndex);
+		}
+	}
+#endif
+}
+
+void AOdinFleetGameMode::ActivateSessionSlot(int32 SlotIndex)
+{
+#if WITH_GAMELIFT
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+	GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+		[Process = GameLiftProcess.SessionSlots[SlotIndex].Process](FGameLiftServerSDKModule& Module)
+		{
+			return Process.IsValid() ? Process->ActivateGameSession() : Module.ActivateGameSession();
+		},
+		[SlotIndex](const FGameLiftGenericOutcome& ActivateOutcome)
+		{
+			if (!GameLiftProcess.SessionSlots.IsValidIndex(SlotIndex))
+			{
+				return;
+			}
+			FSessionSlot& Slot = GameLiftProcess.SessionSlots[SlotIndex];
+			const double ActivationTime = (FPlatformTime::Seconds() - Slot.ActivationStartTime) * 1000.0;
+			Slot.ActivationStartTime = 0.0;
+			if (ActivateOutcome.IsSuccess())
+			{
+				Slot.bSessionActive = true;
+				UE_LOG(GameServerLog, Log, TEXT("Game session %s activated in slot %d in %.1f ms"), *Slot.GameSessionId, SlotIndex, ActivationTime);
+				if (GameLiftProcess.bDenyingPlayers)
+				{
+					UpdatePlayerSessionCreationPolicy(SlotIndex);
+				}
+			}
+			else
+			{
+				UE_LOG(GameServerLog, Error, TEXT("ActivateGameSession() failed for slot %d after %.1f ms. Error: %s"), SlotIndex, ActivationTime, *ActivateOutcome.GetError().m_errorMessage);
+			}
+		});
+#endif
+}
+
+void AOdinFleetGameMode::UpdatePlayerSessionCreationPolicy(int32 SlotIndex)
+{
+#if WITH_GAMELIFT
+	const EPlayerSessionCreationPolicy Policy = GameLiftProcess.bDenyingPlayers ? EPlayerSessionCreationPolicy::DENY_ALL : EPlayerSessionCreationPolicy::ACCEPT_ALL;
+	FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+	auto OnComplete = [Policy](const FGameLiftGenericOutcome& PolicyOutcome)
+	{
+		if (!PolicyOutcome.IsSuccess())
+		{
+			UE_LOG(GameServerLog, Error, TEXT("Could not set the player session creation policy to %s. Error: %s"),
+				*GetNameForPlayerSessionCreationPolicy(Policy), *PolicyOutcome.GetError().m_errorMessage);
+		}
+	};
+
+	if (GameLiftProcess.SessionSlots.Num() == 0)
+	{
+		if (GameLiftProcess.bSessionActive)
+		{
+			GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+				[Policy](FGameLiftServerSDKModule& Module) { return Module.UpdatePlayerSessionCreationPolicy(Policy); },
+				OnComplete);
+		}
+		return;
+	}
+
+	for (int32 Index = 0; Index < GameLiftProcess.SessionSlots.Num(); ++Index)
+	{
+		const FSessionSlot& Slot = GameLiftProcess.SessionSlots[Index];
+		if ((SlotIndex != INDEX_NONE && Index != SlotIndex) || !Slot.bSessionActive)
+		{
+			continue;
+		}
+		GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+			[Policy, Process = Slot.Process](FGameLiftServerSDKModule& Module)
+			{
+				return Process.IsValid() ? Process->UpdatePlayerSessionCreationPolicy(Policy) : Module.UpdatePlayerSessionCreationPolicy(Policy);
+			},
+			OnComplete);
+	}
+#endif
+}
+
+void AOdinFleetGameMode::EndSessionSlot(int32 SlotIndex, bool bAllowRecycle)
+{
+#if WITH_GAMELIFT
+	if (!GameLiftProcess.SessionSlots.IsValidIndex(SlotIndex) || GameLiftProcess.SessionSlots[SlotIndex].bRetired)
+	{
+		return;
+	}
+	FSessionSlot& Slot = GameLiftProcess.SessionSlots[SlotIndex];
+	Slot.bSessionActive = false;
+	Slot.ActivationStartTime = 0.0;
+	Slot.GameSessionId.Reset();
+
+	TArray<APlayerController*> SlotPlayers;
+	for (const TPair<TObjectKey<AController>, int32>& PlayerSlot : PlayerSessionSlots)
+	{
+		APlayerController* PlayerController = Cast<APlayerController>(PlayerSlot.Key.ResolveObjectPtr());
+		if (PlayerSlot.Value == SlotIndex && PlayerController)
+		{
+			SlotPlayers.Add(PlayerController);
+		}
+	}
+	for (APlayerController* PlayerController : SlotPlayers)
+	{
+		GameSession->KickPlayer(PlayerController, NSLOCTEXT("OdinFleet", "GameSessionEnded", "The game session has ended."));
+	}
+
+	// Unloading the level instance discards everything the match spawned into it.
+	if (ULevelStreamingDynamic* Level = Slot.Level.Get())
+	{
+		Level->OnLevelShown.RemoveDynamic(this, &AOdinFleetGameMode::OnSessionLevelShown);
+		Level->SetIsRequestingUnloadAndRemoval(true);
+	}
+	Slot.Level.Reset();
+
+	if (!bAllowRecycle || (!bRecycleSessions && !FParse::Param(FCommandLine::Get(), TEXT("recycle"))))
+	{
+		RetireSessionSlot(SlotIndex);
+	}
+	else if (SlotIndex == 0)
+	{
+		UE_LOG(GameServerLog, Log, TEXT("Recycling session slot 0"));
+		EndProcessThenReportReady();
+	}
+	else
+	{
+		UE_LOG(GameServerLog, Log, TEXT("Recycling session slot %d"), SlotIndex);
+		ReportSessionSlotReady(SlotIndex);
+	}
+#endif
+}
+
+void AOdinFleetGameMode::RetireSessionSlot(int32 SlotIndex)
+{
+#if WITH_GAMELIFT
+	if (!GameLiftProcess.SessionSlots.IsValidIndex(SlotIndex) || GameLiftProcess.SessionSlots[SlotIndex].bRetired)
+	{
+		return;
+	}
+	FSessionSlot& Slot = GameLiftProcess.SessionSlots[SlotIndex];
+	Slot.bRetired = true;
+
+	bool bLastSlot = true;
+	for (const FSessionSlot& OtherSlot : GameLiftProcess.SessionSlots)
+	{
+		bLastSlot &= OtherSlot.bRetired;
+	}
+
+	// Slot 0 is the process-wide instance. Its registration ends here while other slots keep hosting;
+	// as the last slot it ends with the process in ShutDownProcess.
+	TSharedPtr<FGameLiftLogicalServerProcess, ESPMode::ThreadSafe> Process = MoveTemp(Slot.Process);
+	const bool bEndProcess = SlotIndex == 0 && !bLastSlot && !GameLiftProcess.bProcessEnded;
+	if (bEndProcess)
+	{
+		GameLiftProcess.bProcessEnded = true;
+	}
+	if (Process.IsValid() || bEndProcess)
+	{
+		FGameLiftServerSDKModule* GameLiftServerSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+		GameLiftServerSdkModule->CallAsync<FGameLiftGenericOutcome>(
+			[Process](FGameLiftServerSDKModule& Module) { return Process.IsValid() ? Process->ProcessEnding() : Module.ProcessEnding(); },
+			[SlotIndex](const FGameLiftGenericOutcome& ProcessEndingOutcome)
+			{
+				if (!ProcessEndingOutcome.IsSuccess())
+				{
+					UE_LOG(GameServerLog, Error, TEXT("ProcessEnding() failed for slot %d. Error: %s"), SlotIndex, *ProcessEndingOutcome.GetError().m_errorMessage);
+				}
+			});
+	}
+	UE_LOG(GameServerLog, Log, TEXT("Session slot %d retired"), SlotIndex);
+
+	if (bLastSlot)
+	{
+		ShutDownProcess();
+	}
+#endif
+}
 
+AActor* AOdinFleetGameMode::ChoosePlayerStart_Implementation(AController* Player)
+{
+#if WITH_GAMELIFT
+	// Players of a session slot start in the slot's level instance.
+	const int32* SessionSlot = PlayerSessionSlots.Find(Player);
+	if (SessionSlot && GameLiftProcess.SessionSlots.IsValidIndex(*SessionSlot))
+	{
+		const ULevelStreamingDynamic* Level = GameLiftProcess.SessionSlots[*SessionSlot].Level.Get();
+		const ULevel* LoadedLevel = Level ? Level->GetLoadedLevel() : nullptr;
+		TArray<APlayerStart*> SlotStarts;
+		for (TActorIterator<APlayerStart> It(GetWorld()); It && LoadedLevel; ++It)
+		{
+			if (It->GetLevel() == LoadedLevel)
+			{
+				SlotStarts.Add(*It);
+			}
+		}
+		if (SlotStarts.Num() > 0)
+		{
+			return SlotStarts[FMath::RandRange(0, SlotStarts.Num() - 1)];
+		}
+	}
+#endif
+	return Super::ChoosePlayerStart_Implementation(Player);
+}
@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/PrimaryAssetId.h"
+#include "UObject/SoftObjectPath.h"
 #include "OdinFleetGameMode.generated.h"
 
 /**
@@ -12,9 +15,11 @@
 
 struct FProcessParameters;
 
+namespace Aws { namespace GameLift { namespace Server { namespace Model { class GameSession; } } } }
+
 DECLARE_LOG_CATEGORY_EXTERN(GameServerLog, Log, All);
 
-UCLASS(MinimalAPI)
+UCLASS(MinimalAPI, Config=Game)
 class AOdinFleetGameMode : public AGameModeBase
 {
 	GENERATED_BODY()
@@ -22,14 +27,196 @@ class AOdinFleetGameMode : public AGameModeBase
 public:
 	AOdinFleetGameMode();
 
+	/**
+	 * Clients joining with ?PlayerSessionId=<id> are held until GameLift accepts the player session,
+	 * without blocking the game thread. Clients without one are admitted unless bRequirePlayerSessionId.
+	 */
+	virtual void PreLoginAsync(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, const FOnPreLoginCompleteDelegate& OnComplete) override;
+	virtual FString InitNewPlayer(APlayerController* NewPlayerController, const FUniqueNetIdRepl& UniqueId, const FString& Options, const FString& Portal = TEXT("")) override;
+	virtual void HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer) override;
+	virtual void Logout(AController* Exiting) override;
+	virtual void PostSeamlessTravel() override;
+	virtual AActor* ChoosePlayerStart_Implementation(AController* Player) override;
+
+	/**
+	 * Ends the current game session. With session recycling enabled the world is reset and the
+	 * process returns to the ready pool; otherwise the process ends. Also called when the last
+	 * player leaves an active session. With several session slots, ends every active session.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameLift")
+	void EndGameSession();
+
 protected:
 	virtual void BeginPlay() override;
 
+	/** Maps loaded before the process reports ready, e.g. /Game/Maps/Lvl_FirstPerson. */
+	UPROPERTY(Config)
+	TArray<FString> PrewarmMaps;
+
+	/** Assets loaded before the process reports ready. */
+	UPROPERTY(Config)
+	TArray<FSoftObjectPath> PrewarmAssets;
+
+	/** Primary assets loaded with PrewarmBundles before the process reports ready. */
+	UPROPERTY(Config)
+	TArray<FPrimaryAssetId> PrewarmPrimaryAssets;
+
+	UPROPERTY(Config)
+	TArray<FName> PrewarmBundles;
+
+	/** How many of the maps most recently requested through the "map" game property are also prewarmed. */
+	UPROPERTY(Config)
+	int32 PrewarmRecentMapCount = 4;
+
+	/**
+	 * Reuse the process for the next game session instead of exiting when one ends. Also enabled
+	 * by the -recycle command line switch.
+	 */
+	UPROPERTY(Config)
+	bool bRecycleSessions = false;
+
+	/**
+	 * Game sessions co-hosted by this process, each registered with GameLift as its own server process
+	 * and played in its own level instance. Also set by -sessions=N.
+	 *
+	 * This is co-hosting, not isolation. The level instances are offset copies of the map in one world:
+	 * every client receives the GameState and the PlayerStates of all slots, only distance culling keeps
+	 * the other replicated actors apart, and all slots share one game mode instance. A "mode" game
+	 * property is ignored for slots. Only use it for sessions that tolerate this, e.g. bot benchmarks.
+	 */
+	UPROPERTY(Config)
+	int32 SessionSlotCount = 1;
+
+	/** Offset between the level instances of neighbouring session slots, beyond net cull distance and physics contact. */
+	UPROPERTY(Config)
+	FVector SessionSlotSpacing = FVector(0.0, 1000000.0, 0.0);
+
+	/**
+	 * How often the server's load is sent to the backend for every active game session, so session
+	 * search can prefer lightly loaded servers. 0 disables the reports.
+	 */
+	UPROPERTY(Config)
+	float LoadReportIntervalSeconds = 15.0f;
+
+	/**
+	 * Reject clients that join without ?PlayerSessionId=<id>. Off by default, since the session browser
+	 * joins a session's address directly and has no player session to pass.
+	 */
+	UPROPERTY(Config)
+	bool bRequirePlayerSessionId = false;
+
 private:
 	void InitGameLift();
 
+	/**
+	 * Loads the configured and recently requested maps and assets, then calls ReportProcessReady, or
+	 * WaitForPromotion when the launcher started this process for its warm pool.
+	 */
+	void Prewarm();
+
+	/** Calls ProcessReady off the game thread; OnProcessReady handles the outcome on the game thread. */
+	void ReportProcessReady();
+	void OnProcessReady(bool bSuccess, const FString& ErrorMessage);
+
+	/** Tells the launcher this warm pool process is warm, then waits off the game thread to be promoted. */
+	void WaitForPromotion();
+
+	/** Connects to GameLift with the GAMELIFT_SDK_* values the launcher sent, then calls ReportProcessReady. */
+	void CompletePromotion(const FString& Message);
+
+	/**
+	 * Pins the game thread to the cores the launcher dedicated to this process, if any. Threads started
+	 * from the game thread afterwards inherit the mask, so this waits until the SDK's threads are up.
+	 */
+	void PinGameThread();
+
+	/**
+	 * Travels to the map and game mode named by the "map" and "mode" game properties, if they differ
+	 * from the current ones, and activates the game session once there. A mode must be an
+	 * AOdinFleetGameMode, or the map's own game mode is kept.
+	 */
+	void StartGameSession(const Aws::GameLift::Server::Model::GameSession& InGameSession);
+	static void ActivatePendingGameSession();
+
+	/**
+	 * Bound to PostLoadMapWithWorld for the lifetime of the process. Tracks the game mode of each loaded
+	 * map and activates a pending game session once the map it travelled to is loaded.
+	 */
+	static void OnPostLoadMap(UWorld* World);
+
+	/** Finishes a recycle started by EndGameSession, once the reset world has begun play. */
+	void CompleteRecycle();
+
+	/**
+	 * Ends the finished game session with ProcessEnding, then registers the process again through
+	 * ReportProcessReady. Ends the process instead if ProcessEnding fails.
+	 */
+	void EndProcessThenReportReady();
+
+	/** Calls ProcessEnding and Destroy off the game thread, then exits. */
+	static void ShutDownProcess();
+
+	/** Sends queued admissions to GameLift while fewer than MaxAdmissionsInFlight are outstanding. */
+	void DispatchAdmissions();
+
+	int32 GetSessionSlotCount() const;
+
+	/** Registers the logical server processes of session slots 1 and up, once slot 0 is ready. */
+	void ConnectSessionSlots();
+	void ReportSessionSlotReady(int32 SlotIndex);
+
+	/** Loads the requested map as a level instance for the slot and activates its session once it is shown. */
+	void StartSessionSlot(int32 SlotIndex, const Aws::GameLift::Server::Model::GameSession& InGameSession);
+	void ActivateSessionSlot(int32 SlotIndex);
+
+	UFUNCTION()
+	void OnSessionLevelShown();
+
+	/** Kicks the slot's players and unloads its level, then readies the slot again or retires it. */
+	void EndSessionSlot(int32 SlotIndex, bool bAllowRecycle);
+
+	/**
+	 * Ends the slot's registration with GameLift, for slot 0 the process-wide one; the process ends once
+	 * every slot is retired.
+	 */
+	void RetireSessionSlot(int32 SlotIndex);
+
+	/**
+	 * Denies new player sessions while the server is overloaded and accepts them again once it has
+	 * recovered, for the slot's session or, with INDEX_NONE, every active one.
+	 */
+	static void UpdatePlayerSessionCreationPolicy(int32 SlotIndex);
+
 private:
+	// Admissions beyond this wait in PendingAdmissions, so a burst of joins cannot occupy the whole thread pool.
+	static constexpr int32 MaxAdmissionsInFlight = 16;
+
+	struct FPendingAdmission
+	{
+		FString PlayerSessionId;
+		FOnPreLoginCompleteDelegate OnComplete;
+		int32 SessionSlot = 0;
+	};
+
+	/** FPlatformTime::Seconds() at each stage a joining player passes, for connect-to-spawn latency. */
+	struct FAdmissionTiming
+	{
+		double QueuedTime = 0.0;
+		double DispatchedTime = 0.0;
+		double AcceptedTime = 0.0;
+		double LoggedInTime = 0.0;
+	};
+
 	TSharedPtr<FProcessParameters> ProcessParameters;
+
+	TArray<FPendingAdmission> PendingAdmissions;
+	int32 AdmissionsInFlight = 0;
+
+	TMap<FString, FAdmissionTiming> AdmissionTimings;
+	TMap<TObjectKey<APlayerController>, FString> PlayerSessionIds;
+
+	// The session slot each player joined, when hosting several.
+	TMap<TObjectKey<AController>, int32> PlayerSessionSlots;
 };
 
 
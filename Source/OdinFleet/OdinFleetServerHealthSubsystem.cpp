@@ -0,0 +1,281 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OdinFleetServerHealthSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "OdinFleetGameMode.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	float GetPercentile(TArray<float>& Values, int32 Percentile)
+	{
+		Values.Sort();
+		return Values[FMath::Min(Values.Num() - 1, Values.Num() * Percentile / 100)];
+	}
+}
+
+bool UOdinFleetServerHealthSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UOdinFleetServerHealthSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	FWorldDelegates::OnWorldTickStart.AddUObject(this, &UOdinFleetServerHealthSubsystem::OnWorldTickStart);
+	FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UOdinFleetServerHealthSubsystem::OnWorldPostActorTick);
+	FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &UOdinFleetServerHealthSubsystem::OnPreLoadMap);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &UOdinFleetServerHealthSubsystem::OnPostLoadMap);
+
+	if (FParse::Value(FCommandLine::Get(), TEXT("benchmarkcsv="), BenchmarkCsvPath))
+	{
+		FFileHelper::SaveStringToFile(TEXT("Players,TickMsMean,TickMsP95,FrameTimeMs,UsedMemoryMB,BandwidthKBps,BandwidthKBpsPerPlayer\n"), *BenchmarkCsvPath);
+		UE_LOG(GameServerLog, Log, TEXT("Recording density benchmark to %s"), *BenchmarkCsvPath);
+		StartMonitoring();
+	}
+}
+
+void UOdinFleetServerHealthSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldTickStart.RemoveAll(this);
+	FWorldDelegates::OnWorldPostActorTick.RemoveAll(this);
+	FCoreUObjectDelegates::PreLoadMap.RemoveAll(this);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.RemoveAll(this);
+	Super::Deinitialize();
+}
+
+void UOdinFleetServerHealthSubsystem::IgnoreNextFrame()
+{
+	bIgnoreNextFrame = true;
+}
+
+void UOdinFleetServerHealthSubsystem::OnPreLoadMap(const FString& MapName)
+{
+	IgnoreNextFrame();
+}
+
+void UOdinFleetServerHealthSubsystem::OnPostLoadMap(UWorld* World)
+{
+	IgnoreNextFrame();
+}
+
+void UOdinFleetServerHealthSubsystem::StartMonitoring()
+{
+	bMonitoring = true;
+	FrameTimeMs = 0.0;
+	HitchTimes.Reset();
+	MemoryBaselineMB = FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+	MemoryGrowthMB = 0.0;
+	NextSampleTime = 0.0;
+	UE_LOG(GameServerLog, Log, TEXT("Monitoring server health from %.0f MB of used memory"), MemoryBaselineMB);
+}
+
+FString UOdinFleetServerHealthSubsystem::Describe() const
+{
+	return FString::Printf(TEXT("frame time %.1f ms, %d hitch(es) in %.0f s, memory +%.0f MB, net saturation %.0f%%"),
+		FrameTimeMs, HitchTimes.Num(), WindowSeconds, MemoryGrowthMB, NetSaturation * 100.0);
+}
+
+FGameSessionLoad UOdinFleetServerHealthSubsystem::GetLoad() const
+{
+	FGameSessionLoad Load;
+	Load.bValid = bMonitoring;
+	Load.TickMsP95 = TickMsP95;
+	Load.CpuPercent = FPlatformTime::GetCPUTime().CPUTimePctRelative;
+	Load.FreeMemoryMB = FPlatformMemory::GetStats().AvailablePhysical / (1024.0 * 1024.0);
+	Load.BandwidthKBps = BandwidthKBps;
+	return Load;
+}
+
+void UOdinFleetServerHealthSubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World->IsGameWorld())
+	{
+		TickStartTime = FPlatformTime::Seconds();
+	}
+}
+
+void UOdinFleetServerHealthSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (!World->IsGameWorld() || TickStartTime == 0.0)
+	{
+		return;
+	}
+	const double Now = FPlatformTime::Seconds();
+	const float TickMilliseconds = static_cast<float>((Now - TickStartTime) * 1000.0);
+	TickStartTime = 0.0;
+	ReportTickMilliseconds.Add(TickMilliseconds);
+	WindowTickMilliseconds.Add(TickMilliseconds);
+
+	if (TickWindowStartTime == 0.0)
+	{
+		TickWindowStartTime = Now;
+	}
+	if (Now - TickWindowStartTime >= WindowSeconds)
+	{
+		TickMsP95 = GetPercentile(WindowTickMilliseconds, 95);
+		if (!BenchmarkCsvPath.IsEmpty())
+		{
+			RecordBenchmarkWindow(World);
+		}
+		WindowTickMilliseconds.Reset();
+		TickWindowStartTime = Now;
+	}
+
+	if (TickReportTime == 0.0)
+	{
+		TickReportTime = Now;
+	}
+	if (Now - TickReportTime >= TickReportIntervalSeconds)
+	{
+		double Sum = 0.0;
+		double SumOfSquares = 0.0;
+		for (float Milliseconds : ReportTickMilliseconds)
+		{
+			Sum += Milliseconds;
+			SumOfSquares += Milliseconds * Milliseconds;
+		}
+		const double Mean = Sum / ReportTickMilliseconds.Num();
+		const double StdDev = FMath::Sqrt(FMath::Max(0.0, SumOfSquares / ReportTickMilliseconds.Num() - Mean * Mean));
+		const float P99 = GetPercentile(ReportTickMilliseconds, 99);
+		UE_LOG(GameServerLog, Log, TEXT("[metrics] world tick over %d frames: mean %.2f ms, stddev %.2f ms, p99 %.2f ms, max %.2f ms, game thread CPUs %s"),
+			ReportTickMilliseconds.Num(), Mean, StdDev, P99, ReportTickMilliseconds.Last(), GameThreadCpus.IsEmpty() ? TEXT("unpinned") : *GameThreadCpus);
+		ReportTickMilliseconds.Reset();
+		TickReportTime = Now;
+	}
+}
+
+void UOdinFleetServerHealthSubsystem::RecordBenchmarkWindow(UWorld* World)
+{
+	const AGameModeBase* GameMode = World->GetAuthGameMode();
+	const int32 PlayerCount = GameMode ? GameMode->GetNumPlayers() : 0;
+	const int32 StartPlayerCount = WindowPlayerCount;
+	WindowPlayerCount = PlayerCount;
+	// A window in which bots joined or left measures neither player count.
+	if (StartPlayerCount != PlayerCount)
+	{
+		return;
+	}
+
+	double Sum = 0.0;
+	for (float Milliseconds : WindowTickMilliseconds)
+	{
+		Sum += Milliseconds;
+	}
+	const double TickMsMean = Sum / WindowTickMilliseconds.Num();
+
+	const double UsedMemoryMB = FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+	const FString Row = FString::Printf(TEXT("%d,%.2f,%.2f,%.2f,%.0f,%.1f,%.2f\n"), PlayerCount, TickMsMean, TickMsP95, FrameTimeMs,
+		UsedMemoryMB, BandwidthKBps, PlayerCount > 0 ? BandwidthKBps / PlayerCount : 0.0);
+	FFileHelper::SaveStringToFile(Row, *BenchmarkCsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	UE_LOG(GameServerLog, Log, TEXT("[metrics] benchmark %d player(s): tick mean %.2f ms, p95 %.2f ms, memory %.0f MB, bandwidth %.1f KB/s"),
+		PlayerCount, TickMsMean, TickMsP95, UsedMemoryMB, BandwidthKBps);
+}
+
+void UOdinFleetServerHealthSubsystem::Tick(float DeltaTime)
+{
+	if (!bMonitoring)
+	{
+		return;
+	}
+
+	// A frame spanning a map load or a recycle measures the load, not the server's tick.
+	const double Now = FPlatformTime::Seconds();
+	const bool bIgnoreFrame = bIgnoreNextFrame;
+	bIgnoreNextFrame = false;
+
+	// An exponential moving average over WindowSeconds, weighting each frame by its duration. A single
+	// long frame is clamped to twice the unhealthy frame time, so one hitch is a bump in the average
+	// rather than most of it; the hitch count still records it.
+	if (!bIgnoreFrame)
+	{
+		const double DeltaMs = FMath::Min(DeltaTime * 1000.0, 2.0 * UnhealthyFrameTimeMs);
+		const double Weight = 1.0 - FMath::Exp(-DeltaMs / 1000.0 / FMath::Max(WindowSeconds, 0.1f));
+		FrameTimeMs = FrameTimeMs == 0.0 ? DeltaMs : FrameTimeMs + Weight * (DeltaMs - FrameTimeMs);
+		if (DeltaTime * 1000.0 >= HitchFrameTimeMs)
+		{
+			HitchTimes.Add(Now);
+		}
+	}
+	while (HitchTimes.Num() > 0 && Now - HitchTimes[0] > WindowSeconds)
+	{
+		HitchTimes.RemoveAt(0);
+	}
+
+	if (Now >= NextSampleTime)
+	{
+		NextSampleTime = Now + SampleIntervalSeconds;
+		Sample();
+	}
+	Evaluate();
+}
+
+void UOdinFleetServerHealthSubsystem::Sample()
+{
+	MemoryGrowthMB = FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0) - MemoryBaselineMB;
+
+	double Saturation = 0.0;
+	double OutBytesPerSecond = 0.0;
+	int32 ConnectionCount = 0;
+	const UWorld* World = GetGameInstance()->GetWorld();
+	if (const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr)
+	{
+		for (const UNetConnection* Connection : NetDriver->ClientConnections)
+		{
+			if (Connection)
+			{
+				OutBytesPerSecond += Connection->OutBytesPerSecond;
+			}
+			if (Connection && Connection->CurrentNetSpeed > 0)
+			{
+				Saturation += FMath::Min(1.0, static_cast<double>(Connection->OutBytesPerSecond) / Connection->CurrentNetSpeed);
+				++ConnectionCount;
+			}
+		}
+	}
+	NetSaturation = ConnectionCount > 0 ? Saturation / ConnectionCount : 0.0;
+	BandwidthKBps = OutBytesPerSecond / 1024.0;
+}
+
+void UOdinFleetServerHealthSubsystem::Evaluate()
+{
+	const bool bWasHealthy = bHealthy;
+	bHealthy = FrameTimeMs < UnhealthyFrameTimeMs && MemoryGrowthMB < UnhealthyMemoryGrowthMB;
+	if (bHealthy != bWasHealthy)
+	{
+		UE_LOG(GameServerLog, Warning, TEXT("Server is %s: %s"), bHealthy ? TEXT("healthy again") : TEXT("unhealthy"), *Describe());
+	}
+
+	// Recover only well below the thresholds, so the policy does not flap around them.
+	const double Scale = bOverloaded ? RecoveryFraction : 1.0;
+	const bool bShouldBeOverloaded = !bHealthy
+		|| FrameTimeMs > OverloadedFrameTimeMs * Scale
+		|| HitchTimes.Num() > OverloadedHitchCount * Scale
+		|| MemoryGrowthMB > OverloadedMemoryGrowthMB * Scale
+		|| NetSaturation > OverloadedNetSaturation * Scale;
+	if (bShouldBeOverloaded != bOverloaded)
+	{
+		bOverloaded = bShouldBeOverloaded;
+		UE_LOG(GameServerLog, Warning, TEXT("Server %s: %s"), bOverloaded ? TEXT("overloaded, denying new players") : TEXT("recovered, accepting players"), *Describe());
+		OnOverloadChanged.Broadcast(bOverloaded);
+	}
+}
+
+TStatId UOdinFleetServerHealthSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UOdinFleetServerHealthSubsystem, STATGROUP_Tickables);
+}
+
+ETickableTickType UOdinFleetServerHealthSubsystem::GetTickableTickType() const
+{
+	// The class default object also constructs FTickableGameObject.
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Always;
+}
@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "GLBSServiceConnector.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "OdinFleetServerHealthSubsystem.generated.h"
+
+/**
+ *  Watches the dedicated server's frame time, hitches, memory growth and net saturation. The game mode
+ *  reports IsHealthy through OnHealthCheck, denies new player sessions while IsOverloaded, and reports
+ *  GetLoad to the backend for session placement. With -benchmarkcsv=<path> it also records tick time,
+ *  memory and bandwidth per player count, see Scripts/RunDensityBenchmark.sh.
+ */
+UCLASS(Config=Game)
+class UOdinFleetServerHealthSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnOverloadChanged, bool /* bOverloaded */);
+
+	/** Broadcast on the game thread when the server becomes overloaded or recovers. */
+	FOnOverloadChanged OnOverloadChanged;
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Starts judging the server, from the moment it reports ready. Loading hitches before that do not
+	 * count, and memory growth is measured from here.
+	 */
+	void StartMonitoring();
+
+	/** Leaves the next frame out of the frame time and hitches, for one known to stall, e.g. a forced garbage collection. */
+	void IgnoreNextFrame();
+
+	/** The cpulist the game thread is pinned to, for the world tick [metrics] line. */
+	void SetGameThreadCpus(const FString& Cpus) { GameThreadCpus = Cpus; }
+
+	/** False while the server is too slow or has grown too much to host sessions. */
+	bool IsHealthy() const { return bHealthy; }
+
+	/** True while new players should be denied. */
+	bool IsOverloaded() const { return bOverloaded; }
+
+	/** The latest measurements, for logs. */
+	FString Describe() const;
+
+	/** The load vector the backend places sessions by; ReportTime is left to the backend. */
+	FGameSessionLoad GetLoad() const;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickableWhenPaused() const override { return true; }
+
+protected:
+	/** Time constant of the rolling frame time, and the window hitches are counted in. */
+	UPROPERTY(Config)
+	float WindowSeconds = 10.0f;
+
+	/** Rolling frame time above which new players are denied, 50 ms being 20 Hz. */
+	UPROPERTY(Config)
+	float OverloadedFrameTimeMs = 50.0f;
+
+	/** Rolling frame time above which the server reports unhealthy, 200 ms being 5 Hz. */
+	UPROPERTY(Config)
+	float UnhealthyFrameTimeMs = 200.0f;
+
+	/** A frame this long is a hitch. */
+	UPROPERTY(Config)
+	float HitchFrameTimeMs = 100.0f;
+
+	/** More hitches than this within WindowSeconds deny new players. */
+	UPROPERTY(Config)
+	int32 OverloadedHitchCount = 5;
+
+	/** Growth of the used physical memory since StartMonitoring that denies new players. */
+	UPROPERTY(Config)
+	float OverloadedMemoryGrowthMB = 1024.0f;
+
+	/** Growth of the used physical memory since StartMonitoring that reports unhealthy. */
+	UPROPERTY(Config)
+	float UnhealthyMemoryGrowthMB = 2048.0f;
+
+	/** Average share of the client connections' net speed in use that denies new players. */
+	UPROPERTY(Config)
+	float OverloadedNetSaturation = 0.9f;
+
+	/** An overloaded server accepts players again once every measurement is below this share of its threshold. */
+	UPROPERTY(Config)
+	float RecoveryFraction = 0.8f;
+
+private:
+	// Memory and connections are sampled this often; frame times every frame.
+	static constexpr double SampleIntervalSeconds = 1.0;
+	// How often world tick durations are logged, to compare CPU placements.
+	static constexpr double TickReportIntervalSeconds = 60.0;
+
+	void Sample();
+	void Evaluate();
+
+	/** Appends a row for the tick window that just closed to the -benchmarkcsv file, if its player count held. */
+	void RecordBenchmarkWindow(UWorld* World);
+
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	// Map loads stall the game thread; the frame that spans one is ignored.
+	void OnPreLoadMap(const FString& MapName);
+	void OnPostLoadMap(UWorld* World);
+
+	bool bMonitoring = false;
+	bool bHealthy = true;
+	bool bOverloaded = false;
+	bool bIgnoreNextFrame = false;
+
+	double FrameTimeMs = 0.0;
+	TArray<double> HitchTimes;
+	double MemoryBaselineMB = 0.0;
+	double MemoryGrowthMB = 0.0;
+	double NetSaturation = 0.0;
+	double BandwidthKBps = 0.0;
+	double NextSampleTime = 0.0;
+
+	double TickStartTime = 0.0;
+	// World tick durations since the last report, and since the last TickMsP95 update.
+	TArray<float> ReportTickMilliseconds;
+	TArray<float> WindowTickMilliseconds;
+	double TickReportTime = 0.0;
+	double TickWindowStartTime = 0.0;
+	double TickMsP95 = 0.0;
+	// Empty while the game thread is unpinned.
+	FString GameThreadCpus;
+
+	// Set by -benchmarkcsv=<path>, which also starts monitoring right away.
+	FString BenchmarkCsvPath;
+	// Players when the current tick window started, INDEX_NONE before the first one.
+	int32 WindowPlayerCount = INDEX_NONE;
+};
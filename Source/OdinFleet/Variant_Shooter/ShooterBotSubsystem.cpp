@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "Variant_Shooter/ShooterBotSubsystem.h"
+#include "Misc/CommandLine.h"
+#include "OdinFleet.h"
+
+namespace
+{
+	/** Marks the processes the first bot started, so they do not start bots of their own */
+	const TCHAR* BotChildSwitch = TEXT("botchild");
+}
+
+bool UShooterBotSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	int32 BotCount = 0;
+	return !IsRunningDedicatedServer() && FParse::Value(FCommandLine::Get(), TEXT("bots="), BotCount) && BotCount > 0 && Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+void UShooterBotSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (FParse::Param(FCommandLine::Get(), BotChildSwitch))
+	{
+		return;
+	}
+
+	int32 BotCount = 1;
+	FParse::Value(FCommandLine::Get(), TEXT("bots="), BotCount);
+
+	// the copies connect to the same server URL with the same switches, e.g. -nullrhi
+	const FString Params = FString::Printf(TEXT("%s -%s"), FCommandLine::Get(), BotChildSwitch);
+
+	for (int32 BotIndex = 1; BotIndex < BotCount; ++BotIndex)
+	{
+		FProcHandle Process = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *Params, false, true, true, nullptr, 0, nullptr, nullptr);
+
+		if (Process.IsValid())
+		{
+			BotProcesses.Add(Process);
+
+		} else {
+
+			UE_LOG(LogOdinFleet, Error, TEXT("Could not start the process of bot %d."), BotIndex);
+
+		}
+	}
+
+	UE_LOG(LogOdinFleet, Log, TEXT("Started %d of %d bot process(es) besides this one"), BotProcesses.Num(), BotCount - 1);
+}
+
+void UShooterBotSubsystem::Deinitialize()
+{
+	for (FProcHandle& Process : BotProcesses)
+	{
+		FPlatformProcess::TerminateProc(Process);
+		FPlatformProcess::CloseProc(Process);
+	}
+	BotProcesses.Reset();
+
+	Super::Deinitialize();
+}
@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ShooterBotSubsystem.generated.h"
+
+/**
+ *  Turns a client started with -bots=N into headless bot players for server density benchmarks
+ *  Every bot is a client process of its own, with its own connection: this process plays the first bot
+ *  and starts N-1 copies of itself for the others
+ *  The possessed AShooterPlayerController drives the bot, see AShooterPlayerController::TickBot
+ */
+UCLASS()
+class ODINFLEET_API UShooterBotSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Only created on clients started with -bots=N, never in shipping builds */
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	/** Starts the other bots' processes */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Stops the other bots' processes */
+	virtual void Deinitialize() override;
+
+private:
+
+	/** Processes started for the other bots; only the first bot has any */
+	TArray<FProcHandle> BotProcesses;
+};
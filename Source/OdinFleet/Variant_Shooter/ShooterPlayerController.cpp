@@ -8,8 +8,11 @@
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerStart.h"
 #include "ShooterCharacter.h"
+#include "ShooterBotSubsystem.h"
 #include "ShooterBulletCounterUI.h"
 #include "OdinFleet.h"
+#include "Engine/NetConnection.h"
+#include "Misc/CommandLine.h"
 #include "Widgets/Input/SVirtualJoystick.h"
 
 void AShooterPlayerController::BeginPlay()
@@ -19,6 +22,11 @@ void AShooterPlayerController::BeginPlay()
 	// only spawn touch controls on local player controllers
 	if (IsLocalPlayerController())
 	{
+#if !UE_BUILD_SHIPPING
+		// headless bot clients drive their own input
+		bIsBot = GetGameInstance()->GetSubsystem<UShooterBotSubsystem>() != nullptr;
+#endif
+
 		if (SVirtualJoystick::ShouldDisplayTouchInterface())
 		{
 			// spawn the mobile controls widget
@@ -77,6 +85,19 @@ void AShooterPlayerController::SetupInputComponent()
 	}
 }
 
+void AShooterPlayerController::PlayerTick(float DeltaTime)
+{
+#if !UE_BUILD_SHIPPING
+	// add the bot's input before it is processed for this frame
+	if (bIsBot)
+	{
+		TickBot(DeltaTime);
+	}
+#endif
+
+	Super::PlayerTick(DeltaTime);
+}
+
 void AShooterPlayerController::OnPossess(APawn* InPawn)
 {
 	Super::OnPossess(InPawn);
@@ -140,3 +161,95 @@ void AShooterPlayerController::OnPawnDamaged(float LifePercent)
 		BulletCounterUI->BP_Damaged(LifePercent);
 	}
 }
+
+#if !UE_BUILD_SHIPPING
+void AShooterPlayerController::TickBot(float DeltaTime)
+{
+	AShooterCharacter* ShooterCharacter = Cast<AShooterCharacter>(GetPawn());
+
+	if (!ShooterCharacter)
+	{
+		return;
+	}
+
+	// is it time for the next decision?
+	BotDecisionTime -= DeltaTime;
+
+	if (BotDecisionTime <= 0.0f)
+	{
+		BotDecisionTime = FMath::FRandRange(BotDecisionInterval.X, BotDecisionInterval.Y);
+
+		// mostly run forward, strafing and turning at random
+		BotMove = FVector2D(FMath::FRandRange(-1.0f, 1.0f), FMath::FRandRange(0.0f, 1.0f));
+		BotTurnRate = FMath::FRandRange(-BotMaxTurnRate, BotMaxTurnRate);
+
+		if (FMath::FRand() < BotFireToggleChance)
+		{
+			bBotFiring = !bBotFiring;
+			ServerSetBotFiring(bBotFiring);
+		}
+
+		if (FMath::FRand() < BotSwitchWeaponChance)
+		{
+			ServerSwitchBotWeapon();
+		}
+	}
+
+	// movement and aim replicate through the character movement like a player's
+	ShooterCharacter->DoMove(BotMove.X, BotMove.Y);
+	ShooterCharacter->DoAim(BotTurnRate * DeltaTime, 0.0f);
+}
+
+bool AShooterPlayerController::IsServerFlaggedBot() const
+{
+	// the bot clients connect with ?Bot, see Scripts/RunDensityBenchmark.sh
+	const UNetConnection* Connection = GetNetConnection();
+	return Connection && Connection->URL.HasOption(TEXT("Bot")) && FParse::Param(FCommandLine::Get(), TEXT("allowbots"));
+}
+#endif
+
+bool AShooterPlayerController::ServerSetBotFiring_Validate(bool bFiring)
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return IsServerFlaggedBot();
+#endif
+}
+
+void AShooterPlayerController::ServerSetBotFiring_Implementation(bool bFiring)
+{
+#if !UE_BUILD_SHIPPING
+	if (AShooterCharacter* ShooterCharacter = Cast<AShooterCharacter>(GetPawn()))
+	{
+		if (bFiring)
+		{
+			ShooterCharacter->DoStartFiring();
+
+		} else {
+
+			ShooterCharacter->DoStopFiring();
+
+		}
+	}
+#endif
+}
+
+bool AShooterPlayerController::ServerSwitchBotWeapon_Validate()
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return IsServerFlaggedBot();
+#endif
+}
+
+void AShooterPlayerController::ServerSwitchBotWeapon_Implementation()
+{
+#if !UE_BUILD_SHIPPING
+	if (AShooterCharacter* ShooterCharacter = Cast<AShooterCharacter>(GetPawn()))
+	{
+		ShooterCharacter->DoSwitchWeapon();
+	}
+#endif
+}
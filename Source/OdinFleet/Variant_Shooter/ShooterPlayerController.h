@@ -52,6 +52,33 @@ protected:
 	/** Pointer to the bullet counter UI widget */
 	TObjectPtr<UShooterBulletCounterUI> BulletCounterUI;
 
+	/** Range of time between two decisions of a bot, see UShooterBotSubsystem */
+	UPROPERTY(EditAnywhere, Category="Shooter|Bot", meta = (ClampMin = 0, ClampMax = 10, Units = "s"))
+	FVector2D BotDecisionInterval = FVector2D(0.5f, 2.0f);
+
+	/** Fastest a bot turns, in degrees per second */
+	UPROPERTY(EditAnywhere, Category="Shooter|Bot", meta = (ClampMin = 0, ClampMax = 720))
+	float BotMaxTurnRate = 90.0f;
+
+	/** Chance of a bot toggling its fire at each decision */
+	UPROPERTY(EditAnywhere, Category="Shooter|Bot", meta = (ClampMin = 0, ClampMax = 1))
+	float BotFireToggleChance = 0.5f;
+
+	/** Chance of a bot switching weapons at each decision */
+	UPROPERTY(EditAnywhere, Category="Shooter|Bot", meta = (ClampMin = 0, ClampMax = 1))
+	float BotSwitchWeaponChance = 0.1f;
+
+	/** True if this local player is a headless bot */
+	bool bIsBot = false;
+
+	/** Current input of the bot, held until its next decision */
+	FVector2D BotMove = FVector2D::ZeroVector;
+	float BotTurnRate = 0.0f;
+	bool bBotFiring = false;
+
+	/** Time left until the bot's next decision */
+	float BotDecisionTime = 0.0f;
+
 protected:
 
 	/** Gameplay Initialization */
@@ -60,6 +87,9 @@ protected:
 	/** Initialize input bindings */
 	virtual void SetupInputComponent() override;
 
+	/** Drives the bot, if this is one */
+	virtual void PlayerTick(float DeltaTime) override;
+
 	/** Pawn initialization */
 	virtual void OnPossess(APawn* InPawn) override;
 
@@ -74,4 +104,23 @@ protected:
 	/** Called when the possessed pawn is damaged */
 	UFUNCTION()
 	void OnPawnDamaged(float LifePercent);
+
+#if !UE_BUILD_SHIPPING
+	/** Feeds the bot's move, aim, fire and switch weapon input to the possessed character */
+	void TickBot(float DeltaTime);
+
+	/** True on the server for a client that logged in with ?Bot to a server started with -allowbots */
+	bool IsServerFlaggedBot() const;
+#endif
+
+	/**
+	 *  Fires for a bot on the server, where shots are simulated
+	 *  Other callers, and every caller in shipping builds, are disconnected
+	 */
+	UFUNCTION(Server, Reliable, WithValidation)
+	void ServerSetBotFiring(bool bFiring);
+
+	/** Switches weapons for a bot on the server, with the same validation as ServerSetBotFiring */
+	UFUNCTION(Server, Reliable, WithValidation)
+	void ServerSwitchBotWeapon();
 };
@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "ShooterExplosionQueue.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace
+{
+	/** An overlapped actor to damage, found in the dedup pass */
+	struct FExplosionDamage
+	{
+		int32 ExplosionIndex;
+		AActor* Actor;
+		UPrimitiveComponent* Component;
+		FVector Direction;
+	};
+}
+
+void UShooterExplosionQueue::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	OverlapDelegate.BindUObject(this, &UShooterExplosionQueue::OnOverlapCompleted);
+}
+
+UShooterExplosionQueue* UShooterExplosionQueue::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UShooterExplosionQueue>() : nullptr;
+}
+
+void UShooterExplosionQueue::Queue(const FShooterProjectileHit& Hit, const FVector& Center, const FCollisionObjectQueryParams& ObjectParams, const FCollisionShape& Shape, const FCollisionQueryParams& QueryParams)
+{
+	const uint32 ExplosionId = NextExplosionId++;
+
+	FShooterExplosion& Explosion = PendingExplosions.Add(ExplosionId);
+	Explosion.Hit = Hit;
+	Explosion.Center = Center;
+
+	GetWorld()->AsyncOverlapByObjectType(Center, FQuat::Identity, ObjectParams, Shape, QueryParams, &OverlapDelegate, ExplosionId);
+}
+
+void UShooterExplosionQueue::OnOverlapCompleted(const FTraceHandle& TraceHandle, FOverlapDatum& OverlapDatum)
+{
+	FShooterExplosion Explosion;
+	if (PendingExplosions.RemoveAndCopyValue(OverlapDatum.UserData, Explosion))
+	{
+		Explosion.Overlaps = MoveTemp(OverlapDatum.OutOverlaps);
+		CompletedExplosions.Add(MoveTemp(Explosion));
+	}
+}
+
+void UShooterExplosionQueue::Tick(float DeltaTime)
+{
+	if (CompletedExplosions.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UShooterExplosionQueue::ApplyExplosions);
+
+	// take the batch, so explosions completing while damage is applied wait for the next one
+	const TArray<FShooterExplosion> Explosions = MoveTemp(CompletedExplosions);
+	CompletedExplosions.Reset();
+
+	// overlaps may return the same actor multiple times per each component overlapped
+	// ensure each explosion only damages each actor once
+	TArray<FExplosionDamage> Damages;
+	for (int32 ExplosionIndex = 0; ExplosionIndex < Explosions.Num(); ++ExplosionIndex)
+	{
+		const FShooterExplosion& Explosion = Explosions[ExplosionIndex];
+
+		DamagedActors.Reset();
+		DamagedActors.Reserve(Explosion.Overlaps.Num());
+		Damages.Reserve(Damages.Num() + Explosion.Overlaps.Num());
+
+		for (const FOverlapResult& CurrentOverlap : Explosion.Overlaps)
+		{
+			AActor* OverlapActor = CurrentOverlap.GetActor();
+			if (!OverlapActor)
+			{
+				continue;
+			}
+
+			bool bAlreadyDamaged = false;
+			DamagedActors.Add(OverlapActor, &bAlreadyDamaged);
+			if (bAlreadyDamaged)
+			{
+				continue;
+			}
+
+			// apply physics force away from the explosion
+			const FVector ExplosionDir = OverlapActor->GetActorLocation() - Explosion.Center;
+			Damages.Add({ ExplosionIndex, OverlapActor, CurrentOverlap.GetComponent(), ExplosionDir.GetSafeNormal() });
+		}
+	}
+
+	// push and/or damage the overlapped actors. Earlier damage may have destroyed them
+	for (const FExplosionDamage& Damage : Damages)
+	{
+		if (IsValid(Damage.Actor))
+		{
+			const FShooterExplosion& Explosion = Explosions[Damage.ExplosionIndex];
+			Explosion.Hit.Apply(Damage.Actor, IsValid(Damage.Component) ? Damage.Component : nullptr, Explosion.Center, Damage.Direction);
+		}
+	}
+}
+
+TStatId UShooterExplosionQueue::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterExplosionQueue, STATGROUP_Tickables);
+}
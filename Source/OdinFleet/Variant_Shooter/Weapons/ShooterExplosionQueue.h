@@ -0,0 +1,73 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/OverlapResult.h"
+#include "WorldCollision.h"
+#include "ShooterProjectile.h"
+#include "ShooterExplosionQueue.generated.h"
+
+/**
+ *  An explosion waiting for its overlap query, or for its damage to be applied
+ */
+struct FShooterExplosion
+{
+	/** Shot and hit settings of the exploding projectile */
+	FShooterProjectileHit Hit;
+
+	/** Center of the explosion */
+	FVector Center = FVector::ZeroVector;
+
+	/** Components within the explosion radius, once the query completed */
+	TArray<FOverlapResult> Overlaps;
+};
+
+/**
+ *  Per world queue of projectile explosions
+ *  Explosions query their radius with async overlaps, so the queries of every explosion in a frame run together in the async trace batch
+ *  The completed explosions are applied together on the next tick: each actor is damaged once per explosion, however many of its components overlap
+ */
+UCLASS()
+class ODINFLEET_API UShooterExplosionQueue : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+	/** Explosions waiting for their overlap query, by the query's user data */
+	TMap<uint32, FShooterExplosion> PendingExplosions;
+
+	/** Explosions whose query completed, waiting for the next tick */
+	TArray<FShooterExplosion> CompletedExplosions;
+
+	/** Identifies the next explosion's query */
+	uint32 NextExplosionId = 0;
+
+	/** Called by the world when an overlap query completes */
+	FOverlapDelegate OverlapDelegate;
+
+	/** Scratch space for the damage pass, kept to avoid reallocating every frame */
+	TSet<AActor*> DamagedActors;
+
+public:
+
+	/** Binds the overlap delegate */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Returns the queue of the given world, if it has one */
+	static UShooterExplosionQueue* Get(const UWorld* World);
+
+	/** Starts the overlap query of an explosion; its damage is applied after the query completes */
+	void Queue(const FShooterProjectileHit& Hit, const FVector& Center, const FCollisionObjectQueryParams& ObjectParams, const FCollisionShape& Shape, const FCollisionQueryParams& QueryParams);
+
+	/** Applies the damage of the completed explosions */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Returns the stat id for the tick */
+	virtual TStatId GetStatId() const override;
+
+protected:
+
+	/** Moves a completed query's overlaps to its explosion */
+	void OnOverlapCompleted(const FTraceHandle& TraceHandle, FOverlapDatum& OverlapDatum);
+};
@@ -2,6 +2,8 @@
 
 
 #include "ShooterProjectile.h"
+#include "ShooterProjectilePool.h"
+#include "ShooterExplosionQueue.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "GameFramework/Character.h"
@@ -9,7 +11,6 @@
 #include "GameFramework/DamageType.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/Controller.h"
-#include "Engine/OverlapResult.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 
@@ -65,6 +66,22 @@ void AShooterProjectile::NotifyHit(class UPrimitiveComponent* MyComp, AActor* Ot
 	// disable collision on the projectile
 	CollisionComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
+	ApplyHit(Other, OtherComp, Hit);
+
+	// check if we should schedule deferred destruction of the projectile
+	if (DeferredDestructionTime > 0.0f)
+	{
+		GetWorld()->GetTimerManager().SetTimer(DestructionTimer, this, &AShooterProjectile::OnDeferredDestruction, DeferredDestructionTime, false);
+
+	} else {
+
+		// destroy or pool the projectile right away
+		Recycle();
+	}
+}
+
+void AShooterProjectile::ApplyHit(AActor* Other, UPrimitiveComponent* OtherComp, const FHitResult& Hit)
+{
 	// make AI perception noise
 	MakeNoise(NoiseLoudness, GetInstigator(), GetActorLocation(), NoiseRange, NoiseTag);
 
@@ -83,23 +100,39 @@ void AShooterProjectile::NotifyHit(class UPrimitiveComponent* MyComp, AActor* Ot
 
 	// pass control to BP for any extra effects
 	BP_OnProjectileHit(Hit);
+}
 
-	// check if we should schedule deferred destruction of the projectile
-	if (DeferredDestructionTime > 0.0f)
-	{
-		GetWorld()->GetTimerManager().SetTimer(DestructionTimer, this, &AShooterProjectile::OnDeferredDestruction, DeferredDestructionTime, false);
+void AShooterProjectile::ApplySimulatedHit(AActor* ShotOwner, APawn* ShotInstigator, const FHitResult& Hit)
+{
+	// stand in for the shot at its impact point, so noise and explosions originate there
+	SetOwner(ShotOwner);
+	SetInstigator(ShotInstigator);
+	SetActorLocation(Hit.Location);
 
-	} else {
+	ApplyHit(Hit.GetActor(), Hit.GetComponent(), Hit);
+}
 
-		// destroy the projectile right away
-		Destroy();
+FVector AShooterProjectile::GetLaunchVelocity(const FQuat& Rotation) const
+{
+	// as UProjectileMovementComponent::InitializeComponent does on spawn
+	const UProjectileMovementComponent* DefaultMovement = GetClass()->GetDefaultObject<AShooterProjectile>()->ProjectileMovement;
+	FVector LaunchVelocity = DefaultMovement->Velocity;
+	if (DefaultMovement->InitialSpeed > 0.0f)
+	{
+		LaunchVelocity = LaunchVelocity.GetSafeNormal() * DefaultMovement->InitialSpeed;
 	}
+
+	return DefaultMovement->bInitialVelocityInLocalSpace ? Rotation.RotateVector(LaunchVelocity) : LaunchVelocity;
 }
 
 void AShooterProjectile::ExplosionCheck(const FVector& ExplosionCenter)
 {
-	// do a sphere overlap check look for nearby actors to damage
-	TArray<FOverlapResult> Overlaps;
+	// queue a sphere overlap check to look for nearby actors to damage. The queries of all explosions run together and complete next frame
+	UShooterExplosionQueue* Explosions = UShooterExplosionQueue::Get(GetWorld());
+	if (!Explosions)
+	{
+		return;
+	}
 
 	FCollisionShape OverlapShape;
 	OverlapShape.SetSphere(ExplosionRadius);
@@ -116,44 +149,43 @@ void AShooterProjectile::ExplosionCheck(const FVector& ExplosionCenter)
 		QueryParams.AddIgnoredActor(GetInstigator());
 	}
 
-	GetWorld()->OverlapMultiByObjectType(Overlaps, ExplosionCenter, FQuat::Identity, ObjectParams, OverlapShape, QueryParams);
-
-	TArray<AActor*> DamagedActors;
-
-	// process the overlap results
-	for (const FOverlapResult& CurrentOverlap : Overlaps)
-	{
-		// overlaps may return the same actor multiple times per each component overlapped
-		// ensure we only damage each actor once by adding it to a damaged list
-		if (DamagedActors.Find(CurrentOverlap.GetActor()) == INDEX_NONE)
-		{
-			DamagedActors.Add(CurrentOverlap.GetActor());
-
-			// apply physics force away from the explosion
-			const FVector& ExplosionDir = CurrentOverlap.GetActor()->GetActorLocation() - GetActorLocation();
+	Explosions->Queue(MakeHit(), ExplosionCenter, ObjectParams, OverlapShape, QueryParams);
+}
 
-			// push and/or damage the overlapped actor
-			ProcessHit(CurrentOverlap.GetActor(), CurrentOverlap.GetComponent(), GetActorLocation(), ExplosionDir.GetSafeNormal());
-		}
-			
-	}
+FShooterProjectileHit AShooterProjectile::MakeHit()
+{
+	FShooterProjectileHit ProjectileHit;
+	ProjectileHit.Projectile = this;
+	ProjectileHit.Owner = GetOwner();
+	ProjectileHit.Instigator = GetInstigator();
+	ProjectileHit.HitDamage = HitDamage;
+	ProjectileHit.HitDamageType = HitDamageType;
+	ProjectileHit.PhysicsForce = PhysicsForce;
+	ProjectileHit.bDamageOwner = bDamageOwner;
+	return ProjectileHit;
 }
 
 void AShooterProjectile::ProcessHit(AActor* HitActor, UPrimitiveComponent* HitComp, const FVector& HitLocation, const FVector& HitDirection)
+{
+	MakeHit().Apply(HitActor, HitComp, HitLocation, HitDirection);
+}
+
+void FShooterProjectileHit::Apply(AActor* HitActor, UPrimitiveComponent* HitComp, const FVector& HitLocation, const FVector& HitDirection) const
 {
 	// have we hit a character?
 	if (ACharacter* HitCharacter = Cast<ACharacter>(HitActor))
 	{
 		// ignore the owner of this projectile
-		if (HitCharacter != GetOwner() || bDamageOwner)
+		if (HitCharacter != Owner.Get() || bDamageOwner)
 		{
 			// apply damage to the character
-			UGameplayStatics::ApplyDamage(HitCharacter, HitDamage, GetInstigator()->GetController(), this, HitDamageType);
+			APawn* InstigatorPawn = Instigator.Get();
+			UGameplayStatics::ApplyDamage(HitCharacter, HitDamage, InstigatorPawn ? InstigatorPawn->GetController() : nullptr, Projectile.Get(), HitDamageType);
 		}
 	}
 
 	// have we hit a physics object?
-	if (HitComp->IsSimulatingPhysics())
+	if (HitComp && HitComp->IsSimulatingPhysics())
 	{
 		// give some physics impulse to the object
 		HitComp->AddImpulseAtLocation(HitDirection * PhysicsForce, HitLocation);
@@ -162,6 +194,59 @@ void AShooterProjectile::ProcessHit(AActor* HitActor, UPrimitiveComponent* HitCo
 
 void AShooterProjectile::OnDeferredDestruction()
 {
-	// destroy this actor
-	Destroy();
+	// return this actor to its pool or destroy it
+	Recycle();
+}
+
+void AShooterProjectile::Recycle()
+{
+	if (UShooterProjectilePool* ProjectilePool = Pool.Get())
+	{
+		ProjectilePool->Release(this);
+
+	} else {
+
+		Destroy();
+
+	}
+}
+
+void AShooterProjectile::ActivateFromPool(const FTransform& Transform, AActor* NewOwner, APawn* NewInstigator)
+{
+	bInPool = false;
+	bHit = false;
+
+	SetOwner(NewOwner);
+	SetInstigator(NewInstigator);
+
+	// move while collision is still off so the teleport can't hit anything
+	SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+
+	// ignore the pawn that shot this projectile, and only that one
+	CollisionComponent->ClearMoveIgnoreActors();
+	CollisionComponent->IgnoreActorWhenMoving(NewInstigator, true);
+	CollisionComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+
+	// restart the movement with the initial velocity, as on spawn. Bounces or a stop may have changed both since
+	ProjectileMovement->SetUpdatedComponent(CollisionComponent);
+	ProjectileMovement->Velocity = GetLaunchVelocity(Transform.GetRotation());
+	ProjectileMovement->UpdateComponentVelocity();
+	ProjectileMovement->Activate(true);
+
+	SetActorHiddenInGame(false);
+	SetActorTickEnabled(true);
+}
+
+void AShooterProjectile::DeactivateToPool()
+{
+	bInPool = true;
+
+	GetWorld()->GetTimerManager().ClearTimer(DestructionTimer);
+
+	CollisionComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ProjectileMovement->StopMovementImmediately();
+	ProjectileMovement->Deactivate();
+
+	SetActorHiddenInGame(true);
+	SetActorTickEnabled(false);
 }
@@ -10,6 +10,32 @@ class USphereComponent;
 class UProjectileMovementComponent;
 class ACharacter;
 class UPrimitiveComponent;
+class UShooterProjectilePool;
+class APawn;
+class UDamageType;
+class AShooterProjectile;
+
+/**
+ *  Who fired a projectile and what its hits do
+ *  Enough to apply a hit after the projectile has been destroyed or fired again, e.g. when an explosion query completes
+ */
+struct FShooterProjectileHit
+{
+	/** Projectile that caused the hit */
+	TWeakObjectPtr<AShooterProjectile> Projectile;
+
+	/** Owner and instigator of the shot */
+	TWeakObjectPtr<AActor> Owner;
+	TWeakObjectPtr<APawn> Instigator;
+
+	float HitDamage = 0.0f;
+	TSubclassOf<UDamageType> HitDamageType;
+	float PhysicsForce = 0.0f;
+	bool bDamageOwner = false;
+
+	/** Damages and pushes the given actor */
+	void Apply(AActor* HitActor, UPrimitiveComponent* HitComp, const FVector& HitLocation, const FVector& HitDirection) const;
+};
 
 /**
  *  Simple projectile class for a first person shooter game
@@ -75,11 +101,41 @@ protected:
 	/** Timer to handle deferred destruction of this projectile */
 	FTimerHandle DestructionTimer;
 
+	/** Pool this projectile returns to instead of being destroyed, if it was fired from one */
+	TWeakObjectPtr<UShooterProjectilePool> Pool;
+
+	/** If true, this projectile is inactive in its pool */
+	bool bInPool = false;
+
 public:	
 
 	/** Constructor */
 	AShooterProjectile();
 
+	/** Sets the pool this projectile returns to */
+	void SetPool(UShooterProjectilePool* InPool) { Pool = InPool; }
+
+	/** Returns true if this projectile is inactive in its pool */
+	bool IsInPool() const { return bInPool; }
+
+	/** Fires this pooled projectile again from the given transform, resetting its hit, collision and movement state */
+	void ActivateFromPool(const FTransform& Transform, AActor* NewOwner, APawn* NewInstigator);
+
+	/** Hides this projectile and stops its collision, movement and timers until it is fired again */
+	void DeactivateToPool();
+
+	/** Runs the hit logic of this projectile for a shot simulated without an actor, see UShooterProjectileSimulation */
+	void ApplySimulatedHit(AActor* ShotOwner, APawn* ShotInstigator, const FHitResult& Hit);
+
+	/** Returns the velocity a shot of this projectile starts with when fired with the given rotation */
+	FVector GetLaunchVelocity(const FQuat& Rotation) const;
+
+	/** Returns the collision component */
+	USphereComponent* GetCollisionComponent() const { return CollisionComponent; }
+
+	/** Returns the projectile movement component */
+	UProjectileMovementComponent* GetProjectileMovement() const { return ProjectileMovement; }
+
 protected:
 	
 	/** Gameplay initialization */
@@ -93,9 +149,15 @@ protected:
 
 protected:
 
-	/** Looks up actors within the explosion radius and damages them */
+	/** Makes noise, damages what was hit and passes control to Blueprint */
+	void ApplyHit(AActor* Other, UPrimitiveComponent* OtherComp, const FHitResult& Hit);
+
+	/** Queues a lookup of actors within the explosion radius, which damages them once it completes */
 	void ExplosionCheck(const FVector& ExplosionCenter);
 
+	/** Captures the shot and hit settings of this projectile */
+	FShooterProjectileHit MakeHit();
+
 	/** Processes a projectile hit for the given actor */
 	void ProcessHit(AActor* HitActor, UPrimitiveComponent* HitComp, const FVector& HitLocation, const FVector& HitDirection);
 
@@ -106,4 +168,7 @@ protected:
 	/** Called from the destruction timer to destroy this projectile */
 	void OnDeferredDestruction();
 
+	/** Returns this projectile to its pool, or destroys it if it has none */
+	void Recycle();
+
 };
@@ -0,0 +1,205 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "ShooterProjectilePool.h"
+#include "ShooterProjectile.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "OdinFleet.h"
+
+namespace
+{
+	FAutoConsoleCommandWithWorld ProjectilePoolStatsCommand(
+		TEXT("Shooter.ProjectilePool.Stats"),
+		TEXT("Logs the projectile pool hits, misses and the spawn time saved"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UShooterProjectilePool* Pool = UShooterProjectilePool::Get(World))
+			{
+				Pool->LogStats();
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs ProjectilePoolBenchmarkCommand(
+		TEXT("Shooter.ProjectilePool.Benchmark"),
+		TEXT("Shooter.ProjectilePool.Benchmark [Shots]: fires the given number of shots of every pooled projectile class with and without the pool and logs the cost per shot"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UShooterProjectilePool* Pool = UShooterProjectilePool::Get(World))
+			{
+				Pool->RunBenchmark(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000);
+			}
+		}));
+
+	double ToMicroseconds(double Seconds, int64 Count)
+	{
+		return Count > 0 ? Seconds * 1000000.0 / Count : 0.0;
+	}
+}
+
+double FShooterProjectilePoolStats::GetSavedSeconds() const
+{
+	return SpawnCount > 0 ? Hits * SpawnSeconds / SpawnCount - ReuseSeconds : 0.0;
+}
+
+bool UShooterProjectilePool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UShooterProjectilePool::Deinitialize()
+{
+	if (Stats.Hits + Stats.Misses > 0)
+	{
+		LogStats();
+	}
+	FreeLists.Reset();
+
+	Super::Deinitialize();
+}
+
+UShooterProjectilePool* UShooterProjectilePool::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UShooterProjectilePool>() : nullptr;
+}
+
+void UShooterProjectilePool::Prewarm(TSubclassOf<AShooterProjectile> ProjectileClass, int32 Count)
+{
+	if (!ProjectileClass)
+	{
+		return;
+	}
+
+	FShooterProjectileFreeList& FreeList = FreeLists.FindOrAdd(ProjectileClass);
+	while (FreeList.SpawnedCount < Count && FreeList.Projectiles.Num() < MaxFreePerClass)
+	{
+		AShooterProjectile* Projectile = SpawnProjectile(ProjectileClass, FTransform::Identity, nullptr, nullptr);
+		if (!Projectile)
+		{
+			break;
+		}
+		Release(Projectile);
+	}
+}
+
+AShooterProjectile* UShooterProjectilePool::Acquire(TSubclassOf<AShooterProjectile> ProjectileClass, const FTransform& Transform, AActor* Owner, APawn* Instigator)
+{
+	if (!ProjectileClass)
+	{
+		return nullptr;
+	}
+
+	FShooterProjectileFreeList& FreeList = FreeLists.FindOrAdd(ProjectileClass);
+
+	// skip any projectile destroyed while it waited, e.g. by a level streaming out
+	while (FreeList.Projectiles.Num() > 0)
+	{
+		AShooterProjectile* Projectile = FreeList.Projectiles.Pop(EAllowShrinking::No);
+		if (IsValid(Projectile))
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Projectile->ActivateFromPool(Transform, Owner, Instigator);
+			Stats.ReuseSeconds += FPlatformTime::Seconds() - StartTime;
+			++Stats.Hits;
+			return Projectile;
+		}
+		--FreeList.SpawnedCount;
+	}
+
+	++Stats.Misses;
+	return SpawnProjectile(ProjectileClass, Transform, Owner, Instigator);
+}
+
+void UShooterProjectilePool::Release(AShooterProjectile* Projectile)
+{
+	if (!IsValid(Projectile) || Projectile->IsInPool())
+	{
+		return;
+	}
+
+	FShooterProjectileFreeList& FreeList = FreeLists.FindOrAdd(Projectile->GetClass());
+	if (FreeList.Projectiles.Num() >= MaxFreePerClass)
+	{
+		++Stats.Overflows;
+		--FreeList.SpawnedCount;
+		Projectile->Destroy();
+		return;
+	}
+
+	Projectile->DeactivateToPool();
+	FreeList.Projectiles.Add(Projectile);
+}
+
+AShooterProjectile* UShooterProjectilePool::SpawnProjectile(TSubclassOf<AShooterProjectile> ProjectileClass, const FTransform& Transform, AActor* Owner, APawn* Instigator)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.TransformScaleMethod = ESpawnActorScaleMethod::OverrideRootScale;
+	SpawnParams.Owner = Owner;
+	SpawnParams.Instigator = Instigator;
+
+	const double StartTime = FPlatformTime::Seconds();
+	AShooterProjectile* Projectile = GetWorld()->SpawnActor<AShooterProjectile>(ProjectileClass, Transform, SpawnParams);
+	Stats.SpawnSeconds += FPlatformTime::Seconds() - StartTime;
+	++Stats.SpawnCount;
+
+	if (Projectile)
+	{
+		Projectile->SetPool(this);
+		++FreeLists.FindOrAdd(ProjectileClass).SpawnedCount;
+	}
+	return Projectile;
+}
+
+void UShooterProjectilePool::LogStats() const
+{
+	const int64 Shots = Stats.Hits + Stats.Misses;
+	UE_LOG(LogOdinFleet, Log, TEXT("[metrics] projectile pool: %lld shot(s), %lld hit(s) (%.0f%%), %lld miss(es), %lld overflow(s), spawn %.1f us, reuse %.1f us, %.1f ms of spawning saved"),
+		Shots, Stats.Hits, Shots > 0 ? Stats.Hits * 100.0 / Shots : 0.0, Stats.Misses, Stats.Overflows,
+		ToMicroseconds(Stats.SpawnSeconds, Stats.SpawnCount), ToMicroseconds(Stats.ReuseSeconds, Stats.Hits), Stats.GetSavedSeconds() * 1000.0);
+}
+
+void UShooterProjectilePool::RunBenchmark(int32 Count)
+{
+	if (Count <= 0 || FreeLists.Num() == 0)
+	{
+		UE_LOG(LogOdinFleet, Warning, TEXT("Nothing to benchmark: fire a weapon first so the pool knows its projectile class"));
+		return;
+	}
+
+	// the benchmark shots should not count towards the stats of the match
+	const FShooterProjectilePoolStats MatchStats = Stats;
+
+	TArray<TSubclassOf<AShooterProjectile>> ProjectileClasses;
+	FreeLists.GetKeys(ProjectileClasses);
+
+	for (const TSubclassOf<AShooterProjectile>& ProjectileClass : ProjectileClasses)
+	{
+		// spawn and destroy every shot, as weapons did without the pool. Garbage collecting the destroyed actors comes on top
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Shot = 0; Shot < Count; ++Shot)
+		{
+			if (AShooterProjectile* Projectile = SpawnProjectile(ProjectileClass, FTransform::Identity, nullptr, nullptr))
+			{
+				--FreeLists.FindOrAdd(ProjectileClass).SpawnedCount;
+				Projectile->Destroy();
+			}
+		}
+		const double SpawnSeconds = FPlatformTime::Seconds() - StartTime;
+
+		// fire from the pool, as sustained fire does once every projectile in flight has been spawned
+		Prewarm(ProjectileClass, 1);
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Shot = 0; Shot < Count; ++Shot)
+		{
+			Release(Acquire(ProjectileClass, FTransform::Identity, nullptr, nullptr));
+		}
+		const double PoolSeconds = FPlatformTime::Seconds() - StartTime;
+
+		UE_LOG(LogOdinFleet, Log, TEXT("[metrics] projectile pool benchmark %s, %d shot(s): spawn and destroy %.1f us per shot, acquire and release %.1f us per shot, %.1f ms saved"),
+			*ProjectileClass->GetName(), Count, ToMicroseconds(SpawnSeconds, Count), ToMicroseconds(PoolSeconds, Count), (SpawnSeconds - PoolSeconds) * 1000.0);
+	}
+
+	Stats = MatchStats;
+}
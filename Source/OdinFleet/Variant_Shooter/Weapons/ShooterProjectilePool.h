@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterProjectilePool.generated.h"
+
+class AShooterProjectile;
+class APawn;
+
+/**
+ *  Inactive projectiles of one class, ready to be fired again
+ */
+USTRUCT()
+struct FShooterProjectileFreeList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AShooterProjectile>> Projectiles;
+
+	/** Projectiles of this class the pool has spawned, fired or not */
+	int32 SpawnedCount = 0;
+};
+
+/**
+ *  Counters of a projectile pool since the world started
+ */
+struct FShooterProjectilePoolStats
+{
+	/** Shots served by a pooled projectile */
+	int64 Hits = 0;
+
+	/** Shots that had to spawn a new projectile */
+	int64 Misses = 0;
+
+	/** Projectiles destroyed on release because their free list was full */
+	int64 Overflows = 0;
+
+	/** Time spent spawning projectiles for misses and prewarming */
+	double SpawnSeconds = 0.0;
+	int64 SpawnCount = 0;
+
+	/** Time spent reactivating pooled projectiles for hits */
+	double ReuseSeconds = 0.0;
+
+	/** Estimated time saved by reusing projectiles instead of spawning them */
+	double GetSavedSeconds() const;
+};
+
+/**
+ *  Per world pool of shooter projectiles
+ *  Weapons fire projectiles out of the pool instead of spawning them, and projectiles return to it instead of being destroyed,
+ *  so sustained fire neither spawns actors nor leaves them to the garbage collector
+ *  Shooter.ProjectilePool.Stats logs the pool counters, Shooter.ProjectilePool.Benchmark compares spawning with reuse
+ */
+UCLASS()
+class ODINFLEET_API UShooterProjectilePool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	/** Inactive projectiles by class */
+	UPROPERTY()
+	TMap<TSubclassOf<AShooterProjectile>, FShooterProjectileFreeList> FreeLists;
+
+	/** Counters for the stats */
+	FShooterProjectilePoolStats Stats;
+
+public:
+
+	/** Most inactive projectiles kept per class; projectiles released beyond it are destroyed */
+	int32 MaxFreePerClass = 256;
+
+	/** Only pools projectiles in game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Logs the pool stats */
+	virtual void Deinitialize() override;
+
+	/** Returns the pool of the given world, if it has one */
+	static UShooterProjectilePool* Get(const UWorld* World);
+
+	/** Makes sure at least Count projectiles of the class exist, spawning the missing ones inactive */
+	void Prewarm(TSubclassOf<AShooterProjectile> ProjectileClass, int32 Count);
+
+	/** Fires a projectile of the class from the transform, reusing an inactive one if there is any */
+	AShooterProjectile* Acquire(TSubclassOf<AShooterProjectile> ProjectileClass, const FTransform& Transform, AActor* Owner, APawn* Instigator);
+
+	/** Deactivates a projectile and keeps it for the next shot */
+	void Release(AShooterProjectile* Projectile);
+
+	/** Returns the counters since the world started */
+	const FShooterProjectilePoolStats& GetStats() const { return Stats; }
+
+	/** Logs the counters */
+	void LogStats() const;
+
+	/** Fires and releases Count projectiles of every pooled class with and without the pool, and logs the cost of each */
+	void RunBenchmark(int32 Count);
+
+protected:
+
+	/** Spawns a new projectile of the class, active and fired from the transform */
+	AShooterProjectile* SpawnProjectile(TSubclassOf<AShooterProjectile> ProjectileClass, const FTransform& Transform, AActor* Owner, APawn* Instigator);
+};
@@ -0,0 +1,214 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "ShooterProjectileSimulation.h"
+#include "ShooterProjectile.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/WorldSettings.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarProjectileSimulation(
+		TEXT("Shooter.ProjectileSimulation"),
+		true,
+		TEXT("If true, dedicated servers simulate projectiles as data instead of spawning projectile actors. Read when a world starts"));
+}
+
+bool UShooterProjectileSimulation::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return IsRunningDedicatedServer() && CVarProjectileSimulation.GetValueOnGameThread() && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UShooterProjectileSimulation::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UShooterProjectileSimulation* UShooterProjectileSimulation::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UShooterProjectileSimulation>() : nullptr;
+}
+
+void UShooterProjectileSimulation::Fire(TSubclassOf<AShooterProjectile> ProjectileClass, const FTransform& Transform, AActor* Owner, APawn* Instigator)
+{
+	if (!ProjectileClass)
+	{
+		return;
+	}
+
+	const int32 ClassIndex = FindOrAddFlightClass(ProjectileClass);
+	if (ClassIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	Positions.Add(Transform.GetLocation());
+	Velocities.Add(ProjectileClass->GetDefaultObject<AShooterProjectile>()->GetLaunchVelocity(Transform.GetRotation()));
+	ClassIndices.Add(ClassIndex);
+	Owners.Add(Owner);
+	Instigators.Add(Instigator);
+}
+
+int32 UShooterProjectileSimulation::FindOrAddFlightClass(TSubclassOf<AShooterProjectile> ProjectileClass)
+{
+	// the hit proxy never moves or collides, it only runs the hit logic at the impact point
+	auto SpawnHitProxy = [this, ProjectileClass]() -> AShooterProjectile*
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		AShooterProjectile* HitProxy = GetWorld()->SpawnActor<AShooterProjectile>(ProjectileClass, FTransform::Identity, SpawnParams);
+		if (HitProxy)
+		{
+			HitProxy->DeactivateToPool();
+		}
+		return HitProxy;
+	};
+
+	const int32 ExistingIndex = FlightClasses.IndexOfByPredicate([ProjectileClass](const FShooterProjectileFlightClass& FlightClass) { return FlightClass.ProjectileClass == ProjectileClass; });
+	if (ExistingIndex != INDEX_NONE)
+	{
+		// the hit logic may destroy the proxy, e.g. through a Blueprint override; replace it so the class keeps hitting
+		FShooterProjectileFlightClass& FlightClass = FlightClasses[ExistingIndex];
+		if (!IsValid(FlightClass.HitProxy))
+		{
+			FlightClass.HitProxy = SpawnHitProxy();
+			if (!FlightClass.HitProxy)
+			{
+				return INDEX_NONE;
+			}
+		}
+		return ExistingIndex;
+	}
+
+	AShooterProjectile* HitProxy = SpawnHitProxy();
+	if (!HitProxy)
+	{
+		return INDEX_NONE;
+	}
+
+	const AShooterProjectile* Defaults = ProjectileClass->GetDefaultObject<AShooterProjectile>();
+	const USphereComponent* Collision = Defaults->GetCollisionComponent();
+	const UProjectileMovementComponent* Movement = Defaults->GetProjectileMovement();
+
+	FShooterProjectileFlightClass& FlightClass = FlightClasses.AddDefaulted_GetRef();
+	FlightClass.ProjectileClass = ProjectileClass;
+	FlightClass.HitProxy = HitProxy;
+	FlightClass.Radius = Collision->GetScaledSphereRadius();
+	FlightClass.GravityZ = GetWorld()->GetGravityZ() * Movement->ProjectileGravityScale;
+	FlightClass.MaxSpeed = Movement->GetMaxSpeed();
+	FlightClass.ObjectType = Collision->GetCollisionObjectType();
+	FlightClass.ResponseParams = FCollisionResponseParams(Collision->GetCollisionResponseToChannels());
+	return FlightClasses.Num() - 1;
+}
+
+void UShooterProjectileSimulation::Tick(float DeltaTime)
+{
+	if (Positions.Num() == 0 || DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	Integrate(DeltaTime);
+	Sweep();
+
+	// resolve the hits last, as the hit logic may kill characters and with them their weapons
+	ResolveImpacts();
+}
+
+void UShooterProjectileSimulation::Integrate(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UShooterProjectileSimulation::Integrate);
+
+	const int32 ShotCount = Positions.Num();
+	MoveDeltas.SetNumUninitialized(ShotCount, EAllowShrinking::No);
+
+	// a tight pass over contiguous arrays, without queries or calls into other objects, which the compiler can vectorize
+	const double HalfDeltaTime = 0.5 * DeltaTime;
+	for (int32 Index = 0; Index < ShotCount; ++Index)
+	{
+		const FShooterProjectileFlightClass& FlightClass = FlightClasses[ClassIndices[Index]];
+		const FVector Velocity = Velocities[Index];
+		FVector NewVelocity = Velocity + FVector(0.0, 0.0, FlightClass.GravityZ * DeltaTime);
+		NewVelocity = FlightClass.MaxSpeed > 0.0 ? NewVelocity.GetClampedToMaxSize(FlightClass.MaxSpeed) : NewVelocity;
+
+		Velocities[Index] = NewVelocity;
+		MoveDeltas[Index] = (Velocity + NewVelocity) * HalfDeltaTime;
+	}
+}
+
+void UShooterProjectileSimulation::Sweep()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UShooterProjectileSimulation::Sweep);
+
+	UWorld* World = GetWorld();
+	const AWorldSettings* WorldSettings = World->GetWorldSettings();
+	const double KillZ = WorldSettings && WorldSettings->bEnableWorldBoundsChecks ? WorldSettings->KillZ : -UE_BIG_NUMBER;
+
+	Impacts.Reset();
+
+	// backwards, so the shots swapped in by removals have been swept already
+	for (int32 Index = Positions.Num() - 1; Index >= 0; --Index)
+	{
+		const FShooterProjectileFlightClass& FlightClass = FlightClasses[ClassIndices[Index]];
+		const FVector Start = Positions[Index];
+		const FVector End = Start + MoveDeltas[Index];
+
+		// ignore the pawn that shot this projectile, as the projectile actor does
+		const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ShooterProjectileSweep), false, Instigators[Index].Get());
+
+		FHitResult Hit;
+		if (World->SweepSingleByChannel(Hit, Start, End, FQuat::Identity, FlightClass.ObjectType, FCollisionShape::MakeSphere(FlightClass.Radius), QueryParams, FlightClass.ResponseParams))
+		{
+			FShooterProjectileImpact& Impact = Impacts.AddDefaulted_GetRef();
+			Impact.ClassIndex = ClassIndices[Index];
+			Impact.Owner = Owners[Index];
+			Impact.Instigator = Instigators[Index];
+			Impact.Hit = MoveTemp(Hit);
+			RemoveShot(Index);
+
+		} else if (End.Z < KillZ) {
+
+			// fell out of the world, as CheckStillInWorld destroys projectile actors
+			RemoveShot(Index);
+
+		} else {
+
+			Positions[Index] = End;
+
+		}
+	}
+}
+
+void UShooterProjectileSimulation::ResolveImpacts()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UShooterProjectileSimulation::ResolveImpacts);
+
+	for (const FShooterProjectileImpact& Impact : Impacts)
+	{
+		AShooterProjectile* HitProxy = FlightClasses[Impact.ClassIndex].HitProxy;
+		if (IsValid(HitProxy))
+		{
+			HitProxy->ApplySimulatedHit(Impact.Owner.Get(), Impact.Instigator.Get(), Impact.Hit);
+		}
+	}
+	Impacts.Reset();
+}
+
+void UShooterProjectileSimulation::RemoveShot(int32 Index)
+{
+	Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ClassIndices.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Owners.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Instigators.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+TStatId UShooterProjectileSimulation::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterProjectileSimulation, STATGROUP_Tickables);
+}
@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollisionQueryParams.h"
+#include "Engine/HitResult.h"
+#include "ShooterProjectileSimulation.generated.h"
+
+class AShooterProjectile;
+class APawn;
+
+/**
+ *  How the shots of one projectile class fly, read from its class defaults
+ */
+USTRUCT()
+struct FShooterProjectileFlightClass
+{
+	GENERATED_BODY()
+
+	/** Projectile class the shots were fired as */
+	UPROPERTY()
+	TSubclassOf<AShooterProjectile> ProjectileClass;
+
+	/** Hidden projectile whose hit logic is run for the shots of this class when they hit */
+	UPROPERTY()
+	TObjectPtr<AShooterProjectile> HitProxy;
+
+	/** Radius of the projectile's collision sphere */
+	float Radius = 0.0f;
+
+	/** Gravity acceleration along Z, scaled for the projectile */
+	double GravityZ = 0.0;
+
+	/** Speed limit of the projectile, or 0 for none */
+	double MaxSpeed = 0.0;
+
+	/** Object type and responses the projectile's collision sweeps with */
+	ECollisionChannel ObjectType = ECC_WorldDynamic;
+	FCollisionResponseParams ResponseParams;
+};
+
+/**
+ *  A shot that hit something, kept until every shot has been swept
+ */
+struct FShooterProjectileImpact
+{
+	int32 ClassIndex = INDEX_NONE;
+	TWeakObjectPtr<AActor> Owner;
+	TWeakObjectPtr<APawn> Instigator;
+	FHitResult Hit;
+};
+
+/**
+ *  Simulates the projectiles fired on a dedicated server as data instead of actors
+ *  In-flight shots are kept in parallel arrays and advanced a pass at a time: integrate every shot, sweep every shot, then resolve the hits
+ *  A hit runs the same hit logic as a projectile actor, through a hidden projectile of the shot's class, see AShooterProjectile::ApplySimulatedHit
+ *  Nothing is rendered on a dedicated server and a projectile has no gameplay after its first hit, so no projectile actors are spawned there
+ *  Clients, listen servers and standalone games keep firing projectile actors from the UShooterProjectilePool
+ */
+UCLASS()
+class ODINFLEET_API UShooterProjectileSimulation : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+	/** Flight parameters of every class fired so far */
+	UPROPERTY()
+	TArray<FShooterProjectileFlightClass> FlightClasses;
+
+	/** In-flight shots, one entry per shot in every array */
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<int32> ClassIndices;
+	TArray<TWeakObjectPtr<AActor>> Owners;
+	TArray<TWeakObjectPtr<APawn>> Instigators;
+
+	/** Scratch space for the passes, kept to avoid reallocating every frame */
+	TArray<FVector> MoveDeltas;
+	TArray<FShooterProjectileImpact> Impacts;
+
+public:
+
+	/** Only created for game worlds on dedicated servers, unless Shooter.ProjectileSimulation is 0 */
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	/** Only simulates projectiles in game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Returns the simulation of the given world, if it has one */
+	static UShooterProjectileSimulation* Get(const UWorld* World);
+
+	/** Fires a shot of the projectile class from the transform */
+	void Fire(TSubclassOf<AShooterProjectile> ProjectileClass, const FTransform& Transform, AActor* Owner, APawn* Instigator);
+
+	/** Returns the number of shots in flight */
+	int32 GetShotCount() const { return Positions.Num(); }
+
+	/** Advances all shots */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Returns the stat id for the tick */
+	virtual TStatId GetStatId() const override;
+
+protected:
+
+	/** Returns the index of the class's flight parameters, adding them on its first shot */
+	int32 FindOrAddFlightClass(TSubclassOf<AShooterProjectile> ProjectileClass);
+
+	/** Updates the velocities and computes the move of every shot, as UProjectileMovementComponent does */
+	void Integrate(float DeltaTime);
+
+	/** Sweeps every shot along its move, advancing the ones that hit nothing and removing the others */
+	void Sweep();
+
+	/** Runs the hit logic for the shots that hit something */
+	void ResolveImpacts();
+
+	/** Removes the shot at the index, swapping the last one in */
+	void RemoveShot(int32 Index);
+};
@@ -5,6 +5,8 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Engine/World.h"
 #include "ShooterProjectile.h"
+#include "ShooterProjectilePool.h"
+#include "ShooterProjectileSimulation.h"
 #include "ShooterWeaponHolder.h"
 #include "Components/SceneComponent.h"
 #include "TimerManager.h"
@@ -50,6 +52,13 @@ void AShooterWeapon::BeginPlay()
 	// fill the first ammo clip
 	CurrentBullets = MagazineSize;
 
+	// spawn projectiles ahead of the first shot, unless this world simulates them without actors
+	UShooterProjectilePool* ProjectilePool = UShooterProjectilePool::Get(GetWorld());
+	if (ProjectilePool && !UShooterProjectileSimulation::Get(GetWorld()))
+	{
+		ProjectilePool->Prewarm(ProjectileClass, PrewarmedProjectiles);
+	}
+
 	// attach the meshes to the owner
 	WeaponOwner->AttachWeaponMeshes(this);
 }
@@ -164,14 +173,26 @@ void AShooterWeapon::FireProjectile(const FVector& TargetLocation)
 	// get the projectile transform
 	FTransform ProjectileTransform = CalculateProjectileSpawnTransform(TargetLocation);
 	
-	// spawn the projectile
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	SpawnParams.TransformScaleMethod = ESpawnActorScaleMethod::OverrideRootScale;
-	SpawnParams.Owner = GetOwner();
-	SpawnParams.Instigator = PawnOwner;
-
-	AShooterProjectile* Projectile = GetWorld()->SpawnActor<AShooterProjectile>(ProjectileClass, ProjectileTransform, SpawnParams);
+	// dedicated servers simulate the shot without an actor. Elsewhere, fire a pooled projectile, or spawn one in worlds without a pool
+	if (UShooterProjectileSimulation* ProjectileSimulation = UShooterProjectileSimulation::Get(GetWorld()))
+	{
+		ProjectileSimulation->Fire(ProjectileClass, ProjectileTransform, GetOwner(), PawnOwner);
+
+	} else if (UShooterProjectilePool* ProjectilePool = UShooterProjectilePool::Get(GetWorld())) {
+
+		ProjectilePool->Acquire(ProjectileClass, ProjectileTransform, GetOwner(), PawnOwner);
+
+	} else {
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParams.TransformScaleMethod = ESpawnActorScaleMethod::OverrideRootScale;
+		SpawnParams.Owner = GetOwner();
+		SpawnParams.Instigator = PawnOwner;
+
+		GetWorld()->SpawnActor<AShooterProjectile>(ProjectileClass, ProjectileTransform, SpawnParams);
+
+	}
 
 	// play the firing montage
 	WeaponOwner->PlayFiringMontage(FiringMontage);
@@ -48,6 +48,10 @@ protected:
 
 	/** Number of bullets in the current magazine */
 	int32 CurrentBullets = 0;
+
+	/** Projectiles to spawn into the world's projectile pool ahead of the first shot. Shared by all weapons that fire the same projectile class */
+	UPROPERTY(EditAnywhere, Category="Ammo", meta = (ClampMin = 0, ClampMax = 256))
+	int32 PrewarmedProjectiles = 20;
 	
 	/** Animation montage to play when firing this weapon */
 	UPROPERTY(EditAnywhere, Category="Animation")